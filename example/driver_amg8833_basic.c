@@ -121,6 +121,93 @@ uint8_t amg8833_basic_init(amg8833_address_t addr_pin)
     return 0;
 }
 
+/**
+ * @brief      basic example resume
+ * @param[in]  addr_pin is the iic device address
+ * @param[out] *warm points to a warm start buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 resume failed
+ * @note       a running chip is not reset, the interrupt and average mode are always written again
+ */
+uint8_t amg8833_basic_resume(amg8833_address_t addr_pin, amg8833_bool_t *warm)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, amg8833_interface_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, amg8833_interface_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, amg8833_interface_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, amg8833_interface_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, amg8833_interface_receive_callback);
+    
+    /* set the address */
+    res = amg8833_set_addr_pin(&gs_handle, addr_pin);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set addr pin failed.\n");
+       
+        return 1;
+    }
+    
+    /* resume with normal mode and the default frame rate */
+    res = amg8833_resume(&gs_handle, AMG8833_MODE_NORMAL, AMG8833_BASIC_DEFAULT_FRAME_RATE, warm);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: resume failed.\n");
+       
+        return 1;
+    }
+    
+    /* disable */
+    res = amg8833_set_interrupt(&gs_handle, AMG8833_BOOL_FALSE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set interrupt failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    
+    /* set average mode */
+    res = amg8833_set_average_mode(&gs_handle, AMG8833_BASIC_DEFAULT_AVERAGE_MODE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set average mode failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example wait until fresh frames are output
+ * @param[in]  frames is the fresh frame count
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait frame ready failed
+ * @note       use AMG8833_BASIC_DEFAULT_READY_FRAMES after the configuration and 1 frame to pace the reads
+ */
+uint8_t amg8833_basic_wait_frame_ready(uint8_t frames, uint32_t *elapsed)
+{
+    /* wait fresh frames */
+    if (amg8833_wait_frame_ready(&gs_handle, frames, AMG8833_BASIC_DEFAULT_READY_POLL,
+                                 AMG8833_BASIC_DEFAULT_READY_TIMEOUT, elapsed) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -185,3 +272,24 @@ uint8_t amg8833_basic_read_temperature(float *temp)
         return 0;
     }
 }
+
+/**
+ * @brief      basic example read the raw frame
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read frame failed
+ * @note       none
+ */
+uint8_t amg8833_basic_read_frame(amg8833_frame_t *frame)
+{
+    /* read frame */
+    if (amg8833_read_frame(&gs_handle, frame) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
@@ -55,6 +55,9 @@ extern "C"{
  */
 #define AMG8833_BASIC_DEFAULT_FRAME_RATE          AMG8833_FRAME_RATE_10_FPS        /**< 10 fps */
 #define AMG8833_BASIC_DEFAULT_AVERAGE_MODE        AMG8833_AVERAGE_MODE_TWICE       /**< twice */
+#define AMG8833_BASIC_DEFAULT_READY_FRAMES        2                                /**< 2 fresh frames */
+#define AMG8833_BASIC_DEFAULT_READY_POLL          10                               /**< 10 ms */
+#define AMG8833_BASIC_DEFAULT_READY_TIMEOUT       2000                             /**< 2000 ms */
 
 /**
  * @brief     basic example init
@@ -66,6 +69,28 @@ extern "C"{
  */
 uint8_t amg8833_basic_init(amg8833_address_t addr_pin);
 
+/**
+ * @brief      basic example resume
+ * @param[in]  addr_pin is the iic device address
+ * @param[out] *warm points to a warm start buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 resume failed
+ * @note       a running chip is not reset, the interrupt and average mode are always written again
+ */
+uint8_t amg8833_basic_resume(amg8833_address_t addr_pin, amg8833_bool_t *warm);
+
+/**
+ * @brief      basic example wait until fresh frames are output
+ * @param[in]  frames is the fresh frame count
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait frame ready failed
+ * @note       use AMG8833_BASIC_DEFAULT_READY_FRAMES after the configuration and 1 frame to pace the reads
+ */
+uint8_t amg8833_basic_wait_frame_ready(uint8_t frames, uint32_t *elapsed);
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -95,6 +120,16 @@ uint8_t amg8833_basic_read_temperature_array(float temp[8][8]);
  */
 uint8_t amg8833_basic_read_temperature(float *temp);
 
+/**
+ * @brief      basic example read the raw frame
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read frame failed
+ * @note       none
+ */
+uint8_t amg8833_basic_read_frame(amg8833_frame_t *frame);
+
 /**
  * @}
  */
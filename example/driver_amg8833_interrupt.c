@@ -89,6 +89,8 @@ uint8_t interrupt_interrupt_init(amg8833_address_t addr_pin,
     DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
     DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
     DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, callback);
+    DRIVER_AMG8833_LINK_LOCK(&gs_handle, amg8833_interface_lock);
+    DRIVER_AMG8833_LINK_UNLOCK(&gs_handle, amg8833_interface_unlock);
     
     /* set the address */
     res = amg8833_set_addr_pin(&gs_handle, addr_pin);
@@ -232,6 +234,28 @@ uint8_t interrupt_interrupt_init(amg8833_address_t addr_pin,
     return 0;
 }
 
+/**
+ * @brief      interrupt example wait until fresh frames are output
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait frame ready failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_wait_frame_ready(uint32_t *elapsed)
+{
+    /* wait fresh frames */
+    if (amg8833_wait_frame_ready(&gs_handle, AMG8833_INTERRUPT_DEFAULT_READY_FRAMES, AMG8833_INTERRUPT_DEFAULT_READY_POLL,
+                                 AMG8833_INTERRUPT_DEFAULT_READY_TIMEOUT, elapsed) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  interrupt example deinit
  * @return status code
@@ -272,6 +296,27 @@ uint8_t amg8833_interrupt_get_table(uint8_t table[8][1])
     }
 }
 
+/**
+ * @brief      interrupt example get interrupt mask
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ * @note       bit (row * 8 + col) is pixel [row][col] of the temperature array
+ */
+uint8_t amg8833_interrupt_get_mask(uint64_t *mask)
+{
+    /* get interrupt mask */
+    if (amg8833_get_interrupt_mask(&gs_handle, mask) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief      interrupt example read temperature array
  * @param[out] **temp points to a temperature array
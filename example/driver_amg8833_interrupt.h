@@ -54,6 +54,9 @@ extern "C"{
  */
 #define AMG8833_INTERRUPT_DEFAULT_FRAME_RATE          AMG8833_FRAME_RATE_1_FPS         /**< 1 fps */
 #define AMG8833_INTERRUPT_DEFAULT_AVERAGE_MODE        AMG8833_AVERAGE_MODE_TWICE       /**< twice */
+#define AMG8833_INTERRUPT_DEFAULT_READY_FRAMES        2                                /**< 2 fresh frames */
+#define AMG8833_INTERRUPT_DEFAULT_READY_POLL          100                              /**< 100 ms */
+#define AMG8833_INTERRUPT_DEFAULT_READY_TIMEOUT       5000                             /**< 5000 ms */
 
 /**
  * @brief  interrupt irq callback
@@ -84,6 +87,16 @@ uint8_t interrupt_interrupt_init(amg8833_address_t addr_pin,
                                  void (*callback)(uint8_t type) 
                                  );
 
+/**
+ * @brief      interrupt example wait until fresh frames are output
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait frame ready failed
+ * @note       none
+ */
+uint8_t amg8833_interrupt_wait_frame_ready(uint32_t *elapsed);
+
 /**
  * @brief  interrupt example deinit
  * @return status code
@@ -103,6 +116,16 @@ uint8_t amg8833_interrupt_deinit(void);
  */
 uint8_t amg8833_interrupt_get_table(uint8_t table[8][1]);
 
+/**
+ * @brief      interrupt example get interrupt mask
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ * @note       bit (row * 8 + col) is pixel [row][col] of the temperature array
+ */
+uint8_t amg8833_interrupt_get_mask(uint64_t *mask);
+
 /**
  * @brief      interrupt example read temperature array
  * @param[out] **temp points to a temperature array
@@ -115,6 +115,19 @@ void amg8833_interface_debug_print(const char *const fmt, ...);
  */
 void amg8833_interface_receive_callback(uint8_t type);
 
+/**
+ * @brief interface lock the iic bus
+ * @note  keep it empty when the irq handler and the reader never run concurrently,
+ *        otherwise block the other context, e.g. take a mutex or mask the interrupt
+ */
+void amg8833_interface_lock(void);
+
+/**
+ * @brief interface unlock the iic bus
+ * @note  keep it empty when the lock is empty, otherwise release what the lock took
+ */
+void amg8833_interface_unlock(void);
+
 /**
  * @}
  */
@@ -37,6 +37,7 @@
 #include "driver_amg8833_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <pthread.h>
 
 /**
  * @brief iic device name definition
@@ -48,6 +49,11 @@
  */
 static int gs_fd;                           /**< iic handle */
 
+/**
+ * @brief iic bus mutex definition
+ */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< iic bus mutex */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -169,3 +175,21 @@ void amg8833_interface_receive_callback(uint8_t type)
         }
     }
 }
+
+/**
+ * @brief interface lock the iic bus
+ * @note  none
+ */
+void amg8833_interface_lock(void)
+{
+    (void)pthread_mutex_lock(&gs_mutex);
+}
+
+/**
+ * @brief interface unlock the iic bus
+ * @note  none
+ */
+void amg8833_interface_unlock(void)
+{
+    (void)pthread_mutex_unlock(&gs_mutex);
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record_reader.h
+ * @brief     record reader header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RECORD_READER_H
+#define RECORD_READER_H
+
+#include "driver_amg8833_record.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup record_reader record reader function
+ * @brief    record reader function modules
+ * @{
+ */
+
+/**
+ * @brief record reader structure definition
+ */
+typedef struct record_reader_s
+{
+    int fd;                                /**< file handle */
+    uint8_t *map;                          /**< mapped recording */
+    size_t size;                           /**< recording size */
+    amg8833_record_block_t *block;         /**< block index */
+    uint32_t block_count;                  /**< block count */
+    uint32_t frame_count;                  /**< frame count */
+    uint16_t block_frames_max;             /**< max frames in one block */
+} record_reader_t;
+
+/**
+ * @brief     record reader map function type definition
+ * @param[in] *arg points to a user argument
+ * @param[in] *block points to the chunk block
+ * @param[in] *frame points to the decoded frames of the chunk
+ * @param[in] len is the decoded frame count
+ * @param[in] *result points to a cleared chunk result buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      it runs in a worker thread and must only write its own result buffer
+ */
+typedef uint8_t (*record_reader_map_t)(void *arg, const amg8833_record_block_t *block,
+                                       const amg8833_frame_t *frame, uint32_t len, void *result);
+
+/**
+ * @brief     record reader reduce function type definition
+ * @param[in] *arg points to a user argument
+ * @param[in] chunk is the chunk index
+ * @param[in] *result points to the chunk result buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 reduce failed
+ * @note      it runs in the calling thread and chunks are delivered in recording order
+ */
+typedef uint8_t (*record_reader_reduce_t)(void *arg, uint32_t chunk, void *result);
+
+/**
+ * @brief      record reader open
+ * @param[out] *reader points to a record reader structure
+ * @param[in]  *name points to a recording file name
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the recording is memory mapped and only the block headers are parsed
+ */
+uint8_t record_reader_open(record_reader_t *reader, const char *name);
+
+/**
+ * @brief     record reader close
+ * @param[in] *reader points to a record reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t record_reader_close(record_reader_t *reader);
+
+/**
+ * @brief     record reader run
+ * @param[in] *reader points to a record reader structure
+ * @param[in] threads is the worker thread number
+ * @param[in] result_size is the chunk result size
+ * @param[in] map points to a map function
+ * @param[in] reduce points to a reduce function
+ * @param[in] *arg points to a user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every block is one chunk, workers decode chunks into reused per-thread buffers and
+ *            at most 2 * threads chunk results are pending before they are reduced
+ */
+uint8_t record_reader_run(record_reader_t *reader, uint32_t threads, size_t result_size,
+                          record_reader_map_t map, record_reader_reduce_t reduce, void *arg);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,639 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     tool main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "record_reader.h"
+#include "driver_amg8833_upscale.h"
+#include <time.h>
+
+/**
+ * @brief stat result structure definition
+ */
+typedef struct stat_result_s
+{
+    int16_t min[64];            /**< per pixel min */
+    int16_t max[64];            /**< per pixel max */
+    int64_t sum[64];            /**< per pixel sum */
+    uint64_t count;             /**< frame count */
+    uint64_t interrupt;         /**< interrupt frame count */
+    uint64_t time_start;        /**< first timestamp */
+    uint64_t time_end;          /**< last timestamp */
+} stat_result_t;
+
+/**
+ * @brief     stat map function
+ * @param[in] *arg points to a user argument
+ * @param[in] *block points to the chunk block
+ * @param[in] *frame points to the decoded frames of the chunk
+ * @param[in] len is the decoded frame count
+ * @param[in] *result points to a cleared chunk result buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_stat_map(void *arg, const amg8833_record_block_t *block,
+                          const amg8833_frame_t *frame, uint32_t len, void *result)
+{
+    stat_result_t *stat = (stat_result_t *)result;
+    uint32_t i;
+    uint8_t j;
+    int16_t raw;
+    
+    (void)arg;
+    (void)block;
+    for (j = 0; j < 64; j++)
+    {
+        stat->min[j] = 0x7FFF;
+        stat->max[j] = -0x7FFF - 1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        for (j = 0; j < 64; j++)
+        {
+            raw = amg8833_frame_get_pixel(&frame[i], j);
+            stat->min[j] = (raw < stat->min[j]) ? raw : stat->min[j];
+            stat->max[j] = (raw > stat->max[j]) ? raw : stat->max[j];
+            stat->sum[j] += raw;
+        }
+        if ((frame[i].status & (1 << AMG8833_STATUS_INTF)) != 0)
+        {
+            stat->interrupt++;
+        }
+    }
+    stat->count = len;
+    stat->time_start = frame[0].timestamp;
+    stat->time_end = frame[len - 1].timestamp;
+    
+    return 0;
+}
+
+/**
+ * @brief     stat reduce function
+ * @param[in] *arg points to a user argument
+ * @param[in] chunk is the chunk index
+ * @param[in] *result points to the chunk result buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_stat_reduce(void *arg, uint32_t chunk, void *result)
+{
+    stat_result_t *total = (stat_result_t *)arg;
+    stat_result_t *stat = (stat_result_t *)result;
+    uint8_t j;
+    
+    if (chunk == 0)
+    {
+        memcpy(total, stat, sizeof(stat_result_t));
+        
+        return 0;
+    }
+    for (j = 0; j < 64; j++)
+    {
+        total->min[j] = (stat->min[j] < total->min[j]) ? stat->min[j] : total->min[j];
+        total->max[j] = (stat->max[j] > total->max[j]) ? stat->max[j] : total->max[j];
+        total->sum[j] += stat->sum[j];
+    }
+    total->count += stat->count;
+    total->interrupt += stat->interrupt;
+    total->time_end = stat->time_end;
+    
+    return 0;
+}
+
+/**
+ * @brief export format enumeration definition
+ */
+typedef enum
+{
+    EXPORT_FORMAT_PGM = 0x00,        /**< 8 bits gray pgm stills */
+    EXPORT_FORMAT_PFM = 0x01,        /**< float pfm stills in celsius */
+    EXPORT_FORMAT_RAW = 0x02,        /**< rgb24 raw video */
+} export_format_t;
+
+/**
+ * @brief export context structure definition
+ */
+typedef struct export_s
+{
+    export_format_t format;          /**< export format */
+    uint32_t size;                   /**< image width and height */
+    uint32_t image_size;             /**< image bytes */
+    float low;                       /**< palette low temperature */
+    float high;                      /**< palette high temperature */
+    const char *output;              /**< output name */
+    FILE *fp;                        /**< raw video file */
+    uint64_t count;                  /**< exported frames */
+} export_t;
+
+/**
+ * @brief export chunk result header structure definition
+ */
+typedef struct export_result_s
+{
+    uint32_t count;                  /**< image count */
+    uint32_t reserved;               /**< reserved */
+} export_result_t;
+
+/**
+ * @brief palette definition
+ */
+static uint8_t gs_palette[256][3];                        /**< iron palette */
+static const uint8_t gc_palette_point[5][3] =
+{
+    {0, 0, 0}, {32, 0, 140}, {204, 0, 119}, {255, 165, 0}, {255, 255, 255},
+};                                                        /**< palette control points */
+
+/**
+ * @brief  export palette init
+ * @note   none
+ */
+static void a_export_palette_init(void)
+{
+    uint32_t i;
+    uint32_t k;
+    uint32_t f;
+    uint8_t c;
+    
+    for (i = 0; i < 256; i++)
+    {
+        k = i / 64;
+        f = i % 64;
+        if (k >= 4)
+        {
+            k = 3;
+            f = 64;
+        }
+        for (c = 0; c < 3; c++)
+        {
+            gs_palette[i][c] = (uint8_t)((gc_palette_point[k][c] * (64 - f) + gc_palette_point[k + 1][c] * f) / 64);
+        }
+    }
+    memcpy(gs_palette[255], gc_palette_point[4], 3);
+}
+
+/**
+ * @brief      export upscale a frame
+ * @param[in]  *frame points to a frame structure
+ * @param[in]  size is the image width and height
+ * @param[out] *image points to a temperature image buffer
+ * @note       image[0][0] is temp[0][0] of amg8833_read_temperature_array
+ */
+static void a_export_upscale(const amg8833_frame_t *frame, uint32_t size, float *image)
+{
+    float temp[8][8];
+    uint32_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        temp[i / 8][i % 8] = (float)amg8833_frame_get_pixel(frame, (uint8_t)i) * 0.25f;
+    }
+    if (size == 8)
+    {
+        memcpy(image, temp, sizeof(temp));
+    }
+    else
+    {
+        (void)amg8833_upscale(AMG8833_UPSCALE_METHOD_BILINEAR, (amg8833_upscale_size_t)size, temp, image);
+    }
+}
+
+/**
+ * @brief     export map function
+ * @param[in] *arg points to an export context
+ * @param[in] *block points to the chunk block
+ * @param[in] *frame points to the decoded frames of the chunk
+ * @param[in] len is the decoded frame count
+ * @param[in] *result points to a cleared chunk result buffer
+ * @return    status code
+ *            - 0 success
+ * @note      every image is rendered in the final file byte order
+ */
+static uint8_t a_export_map(void *arg, const amg8833_record_block_t *block,
+                            const amg8833_frame_t *frame, uint32_t len, void *result)
+{
+    export_t *exp = (export_t *)arg;
+    export_result_t *header = (export_result_t *)result;
+    uint8_t *image = (uint8_t *)result + sizeof(export_result_t);
+    float temp[64 * 64];
+    uint32_t i, j;
+    uint32_t pixels;
+    float scale;
+    int32_t index;
+    
+    (void)block;
+    pixels = exp->size * exp->size;
+    scale = 255.0f / (exp->high - exp->low);
+    for (i = 0; i < len; i++)
+    {
+        a_export_upscale(&frame[i], exp->size, temp);
+        if (exp->format == EXPORT_FORMAT_PFM)
+        {
+            /* pfm rows are stored from the bottom to the top */
+            for (j = 0; j < exp->size; j++)
+            {
+                memcpy(&image[j * exp->size * sizeof(float)],
+                       &temp[(exp->size - 1 - j) * exp->size], exp->size * sizeof(float));
+            }
+        }
+        else
+        {
+            for (j = 0; j < pixels; j++)
+            {
+                index = (int32_t)((temp[j] - exp->low) * scale + 0.5f);
+                index = (index < 0) ? 0 : ((index > 255) ? 255 : index);
+                if (exp->format == EXPORT_FORMAT_PGM)
+                {
+                    image[j] = (uint8_t)index;
+                }
+                else
+                {
+                    memcpy(&image[j * 3], gs_palette[index], 3);
+                }
+            }
+        }
+        image += exp->image_size;
+    }
+    header->count = len;
+    
+    return 0;
+}
+
+/**
+ * @brief     export reduce function
+ * @param[in] *arg points to an export context
+ * @param[in] chunk is the chunk index
+ * @param[in] *result points to the chunk result buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 reduce failed
+ * @note      a raw video chunk is written with one call, every still is one file
+ */
+static uint8_t a_export_reduce(void *arg, uint32_t chunk, void *result)
+{
+    export_t *exp = (export_t *)arg;
+    export_result_t *header = (export_result_t *)result;
+    uint8_t *image = (uint8_t *)result + sizeof(export_result_t);
+    char name[4096];
+    char head[64];
+    FILE *fp;
+    uint32_t i;
+    int len;
+    
+    (void)chunk;
+    if (exp->format == EXPORT_FORMAT_RAW)
+    {
+        if (fwrite(image, exp->image_size, header->count, exp->fp) != header->count)
+        {
+            perror("amg8833_tool: write failed.");
+            
+            return 1;
+        }
+        exp->count += header->count;
+        
+        return 0;
+    }
+    for (i = 0; i < header->count; i++)
+    {
+        if (exp->format == EXPORT_FORMAT_PGM)
+        {
+            (void)snprintf(name, sizeof(name), "%s_%08llu.pgm", exp->output, (unsigned long long)exp->count);
+            len = snprintf(head, sizeof(head), "P5\n%u %u\n255\n", exp->size, exp->size);
+        }
+        else
+        {
+            (void)snprintf(name, sizeof(name), "%s_%08llu.pfm", exp->output, (unsigned long long)exp->count);
+            len = snprintf(head, sizeof(head), "Pf\n%u %u\n-1.0\n", exp->size, exp->size);
+        }
+        fp = fopen(name, "wb");
+        if (fp == NULL)
+        {
+            perror("amg8833_tool: open failed.");
+            
+            return 1;
+        }
+        if ((fwrite(head, 1, (size_t)len, fp) != (size_t)len) ||
+            (fwrite(image, 1, exp->image_size, fp) != exp->image_size))
+        {
+            perror("amg8833_tool: write failed.");
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        (void)fclose(fp);
+        image += exp->image_size;
+        exp->count++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ms
+ * @note   none
+ */
+static double a_time_ms(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+/**
+ * @brief     amg8833_tool full function
+ * @param[in] argc is arg numbers
+ * @param[in] **argv is the arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_tool(uint8_t argc, char **argv)
+{
+    if (argc == 1)
+    {
+        goto help;
+    }
+    else if (argc == 2)
+    {
+        if (strcmp("-h", argv[1]) == 0)
+        {
+            /* show amg8833_tool help */
+            
+            help:
+            printf("amg8833_tool -h\n\tshow amg8833_tool help.\n");
+            printf("amg8833_tool -c stat <threads> <file>\n\tprint the per pixel statistics of a recording.\n");
+            printf("amg8833_tool -c export (pgm | pfm | raw) <threads> <size> <low> <high> <file> <output>\n\texport a recording as heatmaps."
+                   "size is the image size and it can be 8, 16, 32 and 64.low and high are the palette range in celsius."
+                   "pgm and pfm write one still per frame named <output>_<index>, raw writes rgb24 video to the output file or \"-\" for stdout.\n");
+            
+            return 0;
+        }
+        /* param is invalid */
+        else
+        {
+            return 5;
+        }
+    }
+    else if (argc == 5)
+    {
+        /* run function */
+        if (strcmp("-c", argv[1]) == 0)
+        {
+            /* stat function */
+            if (strcmp("stat", argv[2]) == 0)
+            {
+                record_reader_t reader;
+                stat_result_t total;
+                uint8_t i, j;
+                double start;
+                double ms;
+                int threads;
+                
+                threads = atoi(argv[3]);
+                if (threads <= 0)
+                {
+                    return 5;
+                }
+                if (record_reader_open(&reader, argv[4]) != 0)
+                {
+                    return 1;
+                }
+                start = a_time_ms();
+                if (record_reader_run(&reader, (uint32_t)threads, sizeof(stat_result_t),
+                                      a_stat_map, a_stat_reduce, &total) != 0)
+                {
+                    (void)record_reader_close(&reader);
+                    
+                    return 1;
+                }
+                ms = a_time_ms() - start;
+                printf("amg8833: %d blocks, %d frames, %d interrupt frames.\n",
+                       (int)reader.block_count, (int)total.count, (int)total.interrupt);
+                printf("amg8833: timestamp from %llu ms to %llu ms.\n",
+                       (unsigned long long)total.time_start, (unsigned long long)total.time_end);
+                printf("amg8833: mean temperature is\n");
+                for (i = 0; i < 8; i++)
+                {
+                    for (j = 0; j < 8; j++)
+                    {
+                        printf("%0.2f ", (double)total.sum[i * 8 + j] / (double)total.count * 0.25);
+                    }
+                    printf("\n");
+                }
+                printf("amg8833: max temperature is\n");
+                for (i = 0; i < 8; i++)
+                {
+                    for (j = 0; j < 8; j++)
+                    {
+                        printf("%0.2f ", (double)total.max[i * 8 + j] * 0.25);
+                    }
+                    printf("\n");
+                }
+                printf("amg8833: processed in %0.1f ms with %d threads.\n", ms, threads);
+                (void)record_reader_close(&reader);
+                
+                return 0;
+            }
+            /* param is invalid */
+            else
+            {
+                return 5;
+            }
+        }
+        /* param is invalid */
+        else
+        {
+            return 5;
+        }
+    }
+    else if (argc == 10)
+    {
+        /* run function */
+        if (strcmp("-c", argv[1]) == 0)
+        {
+            /* export function */
+            if (strcmp("export", argv[2]) == 0)
+            {
+                record_reader_t reader;
+                export_t exp;
+                double start;
+                double ms;
+                int threads;
+                int size;
+                uint8_t res;
+                
+                memset(&exp, 0, sizeof(export_t));
+                if (strcmp("pgm", argv[3]) == 0)
+                {
+                    exp.format = EXPORT_FORMAT_PGM;
+                }
+                else if (strcmp("pfm", argv[3]) == 0)
+                {
+                    exp.format = EXPORT_FORMAT_PFM;
+                }
+                else if (strcmp("raw", argv[3]) == 0)
+                {
+                    exp.format = EXPORT_FORMAT_RAW;
+                }
+                else
+                {
+                    return 5;
+                }
+                threads = atoi(argv[4]);
+                size = atoi(argv[5]);
+                if ((threads <= 0) || ((size != 8) && (size != 16) && (size != 32) && (size != 64)))
+                {
+                    return 5;
+                }
+                exp.size = (uint32_t)size;
+                exp.low = (float)atof(argv[6]);
+                exp.high = (float)atof(argv[7]);
+                if (exp.high <= exp.low)
+                {
+                    return 5;
+                }
+                exp.output = argv[9];
+                if (exp.format == EXPORT_FORMAT_PGM)
+                {
+                    exp.image_size = exp.size * exp.size;
+                }
+                else if (exp.format == EXPORT_FORMAT_PFM)
+                {
+                    exp.image_size = exp.size * exp.size * (uint32_t)sizeof(float);
+                }
+                else
+                {
+                    exp.image_size = exp.size * exp.size * 3;
+                }
+                a_export_palette_init();
+                if (record_reader_open(&reader, argv[8]) != 0)
+                {
+                    return 1;
+                }
+                if (exp.format == EXPORT_FORMAT_RAW)
+                {
+                    exp.fp = (strcmp("-", exp.output) == 0) ? stdout : fopen(exp.output, "wb");
+                    if (exp.fp == NULL)
+                    {
+                        perror("amg8833_tool: open failed.");
+                        (void)record_reader_close(&reader);
+                        
+                        return 1;
+                    }
+                    (void)setvbuf(exp.fp, NULL, _IOFBF, 4 * 1024 * 1024);
+                }
+                start = a_time_ms();
+                res = record_reader_run(&reader, (uint32_t)threads,
+                                        sizeof(export_result_t) + (size_t)exp.image_size * reader.block_frames_max,
+                                        a_export_map, a_export_reduce, &exp);
+                if ((exp.fp != NULL) && (exp.fp != stdout))
+                {
+                    if (fclose(exp.fp) != 0)
+                    {
+                        perror("amg8833_tool: close failed.");
+                        res = 1;
+                    }
+                }
+                else if (exp.fp != NULL)
+                {
+                    (void)fflush(exp.fp);
+                }
+                ms = a_time_ms() - start;
+                (void)record_reader_close(&reader);
+                if (res != 0)
+                {
+                    return 1;
+                }
+                fprintf(stderr, "amg8833: exported %llu %dx%d frames in %0.1f ms with %d threads.\n",
+                        (unsigned long long)exp.count, size, size, ms, threads);
+                
+                return 0;
+            }
+            /* param is invalid */
+            else
+            {
+                return 5;
+            }
+        }
+        /* param is invalid */
+        else
+        {
+            return 5;
+        }
+    }
+    /* param is invalid */
+    else
+    {
+        return 5;
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc is arg numbers
+ * @param[in] **argv is the arg address
+ * @return    status code
+ *             - 0 success
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    
+    res = amg8833_tool((uint8_t)argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        fprintf(stderr, "amg8833_tool: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        fprintf(stderr, "amg8833_tool: param is invalid.\n");
+    }
+    else
+    {
+        fprintf(stderr, "amg8833_tool: unknow status code.\n");
+    }
+    
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record_reader.c
+ * @brief     record reader source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "record_reader.h"
+
+/**
+ * @brief record reader run context structure definition
+ */
+typedef struct record_run_s
+{
+    record_reader_t *reader;               /**< record reader */
+    record_reader_map_t map;               /**< map function */
+    void *arg;                             /**< user argument */
+    size_t result_size;                    /**< chunk result size */
+    uint32_t slots;                        /**< result slots */
+    uint8_t *result;                       /**< result buffers */
+    uint8_t *done;                         /**< result done flags */
+    uint32_t next_chunk;                   /**< next chunk to map */
+    uint32_t next_reduce;                  /**< next chunk to reduce */
+    uint8_t error;                         /**< error flag */
+    pthread_mutex_t mutex;                 /**< context mutex */
+    pthread_cond_t map_cond;               /**< slot released condition */
+    pthread_cond_t reduce_cond;            /**< chunk done condition */
+} record_run_t;
+
+/**
+ * @brief  record reader worker pthread
+ * @param  *p points to a run context
+ * @return NULL
+ * @note   none
+ */
+static void *a_record_reader_worker(void *p)
+{
+    record_run_t *run = (record_run_t *)p;
+    amg8833_frame_t *frame;
+    const amg8833_record_block_t *block;
+    const uint8_t *buf;
+    uint32_t chunk;
+    uint32_t slot;
+    uint32_t i;
+    uint8_t res;
+    
+    frame = (amg8833_frame_t *)malloc(sizeof(amg8833_frame_t) * run->reader->block_frames_max);        /* per thread buffer */
+    pthread_mutex_lock(&run->mutex);                                                                   /* lock */
+    if (frame == NULL)                                                                                 /* check the buffer */
+    {
+        run->error = 1;                                                                                /* set error */
+        pthread_cond_broadcast(&run->reduce_cond);                                                     /* wake the reducer */
+    }
+    while (run->error == 0)                                                                            /* run until error */
+    {
+        while ((run->error == 0) && (run->next_chunk < run->reader->block_count) &&
+               (run->next_chunk >= run->next_reduce + run->slots))                                    /* wait for a slot */
+        {
+            pthread_cond_wait(&run->map_cond, &run->mutex);                                            /* wait */
+        }
+        if ((run->error != 0) || (run->next_chunk >= run->reader->block_count))                        /* check the end */
+        {
+            break;                                                                                     /* break */
+        }
+        chunk = run->next_chunk;                                                                       /* get the chunk */
+        run->next_chunk++;                                                                             /* next chunk++ */
+        pthread_mutex_unlock(&run->mutex);                                                             /* unlock */
+        
+        block = &run->reader->block[chunk];                                                            /* get the block */
+        buf = run->reader->map + block->offset + AMG8833_RECORD_HEADER_SIZE;                           /* first frame */
+        for (i = 0; i < block->summary.frame_count; i++)                                               /* decode all frames */
+        {
+            amg8833_record_decode_frame(&buf[i * AMG8833_RECORD_FRAME_SIZE], &frame[i]);               /* decode the frame */
+        }
+        slot = chunk % run->slots;                                                                     /* get the slot */
+        memset(&run->result[slot * run->result_size], 0, run->result_size);                            /* clear the result */
+        res = run->map(run->arg, block, frame, block->summary.frame_count,
+                       &run->result[slot * run->result_size]);                                         /* map the chunk */
+        
+        pthread_mutex_lock(&run->mutex);                                                               /* lock */
+        if (res != 0)                                                                                  /* check the result */
+        {
+            run->error = 1;                                                                            /* set error */
+        }
+        run->done[slot] = 1;                                                                           /* set done */
+        pthread_cond_broadcast(&run->reduce_cond);                                                     /* wake the reducer */
+    }
+    pthread_cond_broadcast(&run->map_cond);                                                            /* wake other workers */
+    pthread_mutex_unlock(&run->mutex);                                                                 /* unlock */
+    free(frame);                                                                                       /* free the buffer */
+    
+    return NULL;                                                                                       /* return NULL */
+}
+
+/**
+ * @brief      record reader open
+ * @param[out] *reader points to a record reader structure
+ * @param[in]  *name points to a recording file name
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the recording is memory mapped and only the block headers are parsed
+ */
+uint8_t record_reader_open(record_reader_t *reader, const char *name)
+{
+    struct stat st;
+    amg8833_record_summary_t summary;
+    size_t offset;
+    uint32_t count;
+    
+    memset(reader, 0, sizeof(record_reader_t));                                                                  /* clear the reader */
+    reader->fd = open(name, O_RDONLY);                                                                           /* open the file */
+    if (reader->fd < 0)                                                                                          /* check error */
+    {
+        perror("record: open failed.");                                                                          /* open failed */
+        
+        return 1;                                                                                                /* return error */
+    }
+    if ((fstat(reader->fd, &st) < 0) || (st.st_size < AMG8833_RECORD_HEADER_SIZE))                               /* get the size */
+    {
+        perror("record: stat failed.");                                                                          /* stat failed */
+        (void)close(reader->fd);                                                                                 /* close the file */
+        
+        return 1;                                                                                                /* return error */
+    }
+    reader->size = (size_t)st.st_size;                                                                           /* set the size */
+    reader->map = (uint8_t *)mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, reader->fd, 0);                    /* map the file */
+    if (reader->map == MAP_FAILED)                                                                               /* check error */
+    {
+        perror("record: mmap failed.");                                                                          /* mmap failed */
+        (void)close(reader->fd);                                                                                 /* close the file */
+        
+        return 1;                                                                                                /* return error */
+    }
+    (void)madvise(reader->map, reader->size, MADV_WILLNEED);                                                     /* read ahead */
+    
+    count = 0;                                                                                                   /* init 0 */
+    offset = 0;                                                                                                  /* from the first block */
+    while (offset + AMG8833_RECORD_HEADER_SIZE <= reader->size)                                                  /* until the end of the file */
+    {
+        if (amg8833_record_parse_header(reader->map + offset, &summary) != 0)                                    /* parse the header */
+        {
+            break;                                                                                               /* stop at an invalid header */
+        }
+        offset += AMG8833_RECORD_HEADER_SIZE + (size_t)summary.frame_count * AMG8833_RECORD_FRAME_SIZE;          /* next block */
+        if (offset > reader->size)                                                                               /* check the block size */
+        {
+            break;                                                                                               /* stop at a truncated block */
+        }
+        count++;                                                                                                 /* count++ */
+    }
+    if (count == 0)                                                                                              /* check the count */
+    {
+        (void)fprintf(stderr, "record: no block found.\n");                                                      /* no block found */
+        (void)record_reader_close(reader);                                                                       /* close the reader */
+        
+        return 1;                                                                                                /* return error */
+    }
+    
+    reader->block = (amg8833_record_block_t *)malloc(sizeof(amg8833_record_block_t) * count);                    /* allocate the index */
+    if (reader->block == NULL)                                                                                   /* check the allocation */
+    {
+        (void)fprintf(stderr, "record: malloc failed.\n");                                                       /* malloc failed */
+        (void)record_reader_close(reader);                                                                       /* close the reader */
+        
+        return 1;                                                                                                /* return error */
+    }
+    offset = 0;                                                                                                  /* from the first block */
+    for (reader->block_count = 0; reader->block_count < count; reader->block_count++)                            /* all blocks */
+    {
+        (void)amg8833_record_parse_header(reader->map + offset, &reader->block[reader->block_count].summary);    /* parse the header */
+        reader->block[reader->block_count].offset = offset;                                                      /* set the offset */
+        reader->frame_count += reader->block[reader->block_count].summary.frame_count;                           /* add the frames */
+        if (reader->block[reader->block_count].summary.frame_count > reader->block_frames_max)                   /* check the max frames */
+        {
+            reader->block_frames_max = reader->block[reader->block_count].summary.frame_count;                   /* save the max frames */
+        }
+        offset += AMG8833_RECORD_HEADER_SIZE +
+                  (size_t)reader->block[reader->block_count].summary.frame_count * AMG8833_RECORD_FRAME_SIZE;    /* next block */
+    }
+    
+    return 0;                                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     record reader close
+ * @param[in] *reader points to a record reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t record_reader_close(record_reader_t *reader)
+{
+    uint8_t res;
+    
+    res = 0;                                                                    /* init 0 */
+    free(reader->block);                                                        /* free the index */
+    reader->block = NULL;                                                       /* clear the index */
+    reader->block_count = 0;                                                    /* clear the count */
+    if ((reader->map != NULL) && (munmap(reader->map, reader->size) < 0))       /* unmap the file */
+    {
+        perror("record: munmap failed.");                                       /* munmap failed */
+        res = 1;                                                                /* set error */
+    }
+    reader->map = NULL;                                                         /* clear the map */
+    if (close(reader->fd) < 0)                                                  /* close the file */
+    {
+        perror("record: close failed.");                                        /* close failed */
+        res = 1;                                                                /* set error */
+    }
+    
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     record reader run
+ * @param[in] *reader points to a record reader structure
+ * @param[in] threads is the worker thread number
+ * @param[in] result_size is the chunk result size
+ * @param[in] map points to a map function
+ * @param[in] reduce points to a reduce function
+ * @param[in] *arg points to a user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every block is one chunk, workers decode chunks into reused per-thread buffers and
+ *            at most 2 * threads chunk results are pending before they are reduced
+ */
+uint8_t record_reader_run(record_reader_t *reader, uint32_t threads, size_t result_size,
+                          record_reader_map_t map, record_reader_reduce_t reduce, void *arg)
+{
+    record_run_t run;
+    pthread_t *pid;
+    uint32_t created;
+    uint32_t i;
+    uint32_t slot;
+    uint8_t res;
+    
+    if ((threads == 0) || (result_size == 0) || (map == NULL) || (reduce == NULL))       /* check param */
+    {
+        (void)fprintf(stderr, "record: param is invalid.\n");                            /* param is invalid */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    memset(&run, 0, sizeof(record_run_t));                                               /* clear the context */
+    run.reader = reader;                                                                 /* set the reader */
+    run.map = map;                                                                       /* set map */
+    run.arg = arg;                                                                       /* set arg */
+    run.result_size = result_size;                                                       /* set result size */
+    run.slots = threads * 2;                                                             /* set slots */
+    run.result = (uint8_t *)malloc(result_size * run.slots);                             /* alloc results */
+    run.done = (uint8_t *)calloc(run.slots, 1);                                          /* alloc done flags */
+    pid = (pthread_t *)malloc(sizeof(pthread_t) * threads);                              /* alloc threads */
+    if ((run.result == NULL) || (run.done == NULL) || (pid == NULL))                     /* check the buffers */
+    {
+        (void)fprintf(stderr, "record: malloc failed.\n");                               /* malloc failed */
+        free(run.result);                                                                /* free results */
+        free(run.done);                                                                  /* free done flags */
+        free(pid);                                                                       /* free threads */
+        
+        return 1;                                                                        /* return error */
+    }
+    pthread_mutex_init(&run.mutex, NULL);                                                /* init mutex */
+    pthread_cond_init(&run.map_cond, NULL);                                              /* init map condition */
+    pthread_cond_init(&run.reduce_cond, NULL);                                           /* init reduce condition */
+    for (created = 0; created < threads; created++)                                      /* create the workers */
+    {
+        if (pthread_create(&pid[created], NULL, a_record_reader_worker, &run) != 0)      /* create a worker */
+        {
+            perror("record: creat pthread failed.");                                     /* create failed */
+            pthread_mutex_lock(&run.mutex);                                              /* lock */
+            run.error = 1;                                                               /* set error */
+            pthread_cond_broadcast(&run.map_cond);                                       /* stop the workers */
+            pthread_mutex_unlock(&run.mutex);                                            /* unlock */
+            
+            break;                                                                       /* break */
+        }
+    }
+    
+    for (i = 0; i < reader->block_count; i++)                                            /* reduce the blocks in order */
+    {
+        slot = i % run.slots;                                                            /* result slot */
+        pthread_mutex_lock(&run.mutex);                                                  /* lock */
+        while ((run.done[slot] == 0) && (run.error == 0))                                /* wait for the slot */
+        {
+            pthread_cond_wait(&run.reduce_cond, &run.mutex);                             /* wait the reduce condition */
+        }
+        if ((run.done[slot] == 0) || (run.error != 0))                                   /* check the slot */
+        {
+            pthread_mutex_unlock(&run.mutex);                                            /* unlock */
+            
+            break;                                                                       /* break */
+        }
+        pthread_mutex_unlock(&run.mutex);                                                /* unlock */
+        res = reduce(arg, i, &run.result[slot * result_size]);                           /* reduce the result */
+        pthread_mutex_lock(&run.mutex);                                                  /* lock */
+        if (res != 0)                                                                    /* check the result */
+        {
+            run.error = 1;                                                               /* set error */
+        }
+        run.done[slot] = 0;                                                              /* free the slot */
+        run.next_reduce++;                                                               /* next block */
+        pthread_cond_broadcast(&run.map_cond);                                           /* wake the workers */
+        pthread_mutex_unlock(&run.mutex);                                                /* unlock */
+        if (res != 0)                                                                    /* check the result */
+        {
+            break;                                                                       /* break */
+        }
+    }
+    
+    for (i = 0; i < created; i++)                                                        /* join the workers */
+    {
+        (void)pthread_join(pid[i], NULL);                                                /* wait the worker */
+    }
+    res = (run.error != 0) ? 1 : 0;                                                      /* set the result */
+    pthread_cond_destroy(&run.reduce_cond);                                              /* destroy reduce condition */
+    pthread_cond_destroy(&run.map_cond);                                                 /* destroy map condition */
+    pthread_mutex_destroy(&run.mutex);                                                   /* destroy mutex */
+    free(run.result);                                                                    /* free results */
+    free(run.done);                                                                      /* free done flags */
+    free(pid);                                                                           /* free threads */
+    
+    return res;                                                                          /* return the result */
+}
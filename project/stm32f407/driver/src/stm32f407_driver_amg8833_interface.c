@@ -40,6 +40,8 @@
 #include "uart.h"
 #include <stdarg.h>
 
+static volatile uint8_t gs_exti0_enable = 0;        /**< exti0 enable state saved by the lock */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -161,3 +163,25 @@ void amg8833_interface_receive_callback(uint8_t type)
         }
     }
 }
+
+/**
+ * @brief interface lock the iic bus
+ * @note  the irq handler runs in the exti0 interrupt, so the lock masks exti0
+ */
+void amg8833_interface_lock(void)
+{
+    gs_exti0_enable = (NVIC_GetEnableIRQ(EXTI0_IRQn) != 0) ? 1 : 0;
+    HAL_NVIC_DisableIRQ(EXTI0_IRQn);
+}
+
+/**
+ * @brief interface unlock the iic bus
+ * @note  exti0 is only unmasked when it was enabled before the lock
+ */
+void amg8833_interface_unlock(void)
+{
+    if (gs_exti0_enable != 0)
+    {
+        HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+    }
+}
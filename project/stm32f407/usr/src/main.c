@@ -37,8 +37,31 @@
 #include "driver_amg8833_read_test.h"
 #include "driver_amg8833_register_test.h"
 #include "driver_amg8833_interrupt_test.h"
+#include "driver_amg8833_protocol_test.h"
+#include "driver_amg8833_blob_test.h"
+#include "driver_amg8833_serializer_test.h"
+#include "driver_amg8833_record_test.h"
+#include "driver_amg8833_filter_test.h"
+#include "driver_amg8833_background_test.h"
+#include "driver_amg8833_bitboard_test.h"
+#include "driver_amg8833_tracker_test.h"
+#include "driver_amg8833_hotspot_test.h"
+#include "driver_amg8833_stats_test.h"
+#include "driver_amg8833_roi_test.h"
+#include "driver_amg8833_motion_test.h"
+#include "driver_amg8833_defect_test.h"
+#include "driver_amg8833_softint_test.h"
+#include "driver_amg8833_rule_test.h"
+#include "driver_amg8833_stitch_test.h"
+#include "driver_amg8833_governor_test.h"
+#include "driver_amg8833_upscale_test.h"
+#include "driver_amg8833_nuc_test.h"
+#include "driver_amg8833_drift_test.h"
+#include "driver_amg8833_badpixel_test.h"
+#include "driver_amg8833_snapshot_test.h"
 #include "driver_amg8833_basic.h"
 #include "driver_amg8833_interrupt.h"
+#include "driver_amg8833_protocol.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -49,9 +72,10 @@
 /**
  * @brief global var definition
  */
-uint8_t g_buf[256];                        /**< uart buffer */
-uint16_t g_len;                            /**< uart buffer length */
-uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
+uint8_t g_buf[256];                                            /**< uart buffer */
+uint16_t g_len;                                                /**< uart buffer length */
+uint8_t (*g_gpio_irq)(void) = NULL;                            /**< gpio irq */
+uint8_t g_stream_buf[AMG8833_PROTOCOL_MAX_PACKET_SIZE];        /**< stream packet buffer */
 
 /**
  * @brief exti 0 irq
@@ -103,32 +127,23 @@ static void a_callback(uint8_t type)
         {
             uint8_t res;
             uint8_t i, j;
-            uint8_t level;
-            uint8_t table[8][1];
+            uint64_t mask;
             
             amg8833_interface_debug_print("amg8833: irq interrupt outbreak.\n");
             
-            /* get table */
-            res = amg8833_interrupt_get_table((uint8_t (*)[1])table);
+            /* get mask */
+            res = amg8833_interrupt_get_mask(&mask);
             if (res != 0)
             {
-                amg8833_interface_debug_print("amg8833: get table failed.\n");
+                amg8833_interface_debug_print("amg8833: get mask failed.\n");
             }
             else
             {
                 for (i = 0; i < 8; i++)
                 {
-                    level = table[i][0];
                     for (j = 0; j < 8; j++)
                     {
-                        if (((level >> (7 - j)) & 0x01) != 0)
-                        {
-                            amg8833_interface_debug_print("%d  ", 1);
-                        }
-                        else
-                        {
-                            amg8833_interface_debug_print("%d  ", 0);
-                        }
+                        amg8833_interface_debug_print("%d  ", (int)((mask >> (i * 8 + j)) & 0x01));
                     }
                     amg8833_interface_debug_print("\n");
                 }
@@ -200,10 +215,33 @@ uint8_t amg8833(uint8_t argc, char **argv)
             amg8833_interface_debug_print("amg8833 -p\n\tshow amg8833 pin connections of the current board.\n");
             amg8833_interface_debug_print("amg8833 -t reg (0 | 1)\n\trun amg8833 register test.\n");
             amg8833_interface_debug_print("amg8833 -t read (0 | 1) <times>\n\trun amg8833 read test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t protocol <times>\n\trun amg8833 protocol test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t blob <times>\n\trun amg8833 blob test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t serializer <times>\n\trun amg8833 serializer test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t record <times>\n\trun amg8833 record test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t filter <times>\n\trun amg8833 filter test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t background <times>\n\trun amg8833 background test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t bitboard <times>\n\trun amg8833 bitboard test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t tracker <times>\n\trun amg8833 tracker test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t hotspot <times>\n\trun amg8833 hotspot test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t stats <times>\n\trun amg8833 stats test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t roi <times>\n\trun amg8833 roi test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t motion <times>\n\trun amg8833 motion test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t defect <times>\n\trun amg8833 defect test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t softint <times>\n\trun amg8833 softint test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t rule <times>\n\trun amg8833 rule test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t stitch <times>\n\trun amg8833 stitch test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t governor <times>\n\trun amg8833 governor test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t upscale <times>\n\trun amg8833 upscale test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t nuc <times>\n\trun amg8833 nuc test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t drift <times>\n\trun amg8833 drift test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t badpixel <times>\n\trun amg8833 badpixel test.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -t snapshot <times>\n\trun amg8833 snapshot test.times means test times.\n");
             amg8833_interface_debug_print("amg8833 -t int (0 | 1) <times> <mode> <high> <low> <hysteresis>\n\trun amg8833 interrupt test."
                                           "times means test times.mode is the interrupt mode and it can be \"abs\" and \"diff\".");
             amg8833_interface_debug_print("high is the interrupt high level.low is the interrupt low level.hysteresis is the hysteresis level.\n");
             amg8833_interface_debug_print("amg8833 -c read (0 | 1) <times>\n\trun amg8833 read function.times means test times.\n");
+            amg8833_interface_debug_print("amg8833 -c stream (0 | 1) <times>\n\trun amg8833 binary stream function.times means frame times.\n");
             amg8833_interface_debug_print("amg8833 -c int (0 | 1) <times> <mode> <high> <low> <hysteresis>\n\trun amg8833 interrupt function."
                                           "times means test times.mode is the interrupt mode and it can be \"abs\" and \"diff\"."); 
             amg8833_interface_debug_print("high is the interrupt high level.low is the interrupt low level.hysteresis is the hysteresis level.\n");
@@ -249,6 +287,314 @@ uint8_t amg8833(uint8_t argc, char **argv)
                 }
             }
             
+             /* protocol test */
+            else if (strcmp("protocol", argv[2]) == 0)
+            {
+                /* run protocol test */
+                if (amg8833_protocol_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* blob test */
+            else if (strcmp("blob", argv[2]) == 0)
+            {
+                /* run blob test */
+                if (amg8833_blob_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* serializer test */
+            else if (strcmp("serializer", argv[2]) == 0)
+            {
+                /* run serializer test */
+                if (amg8833_serializer_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* record test */
+            else if (strcmp("record", argv[2]) == 0)
+            {
+                /* run record test */
+                if (amg8833_record_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* filter test */
+            else if (strcmp("filter", argv[2]) == 0)
+            {
+                /* run filter test */
+                if (amg8833_filter_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* background test */
+            else if (strcmp("background", argv[2]) == 0)
+            {
+                /* run background test */
+                if (amg8833_background_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* bitboard test */
+            else if (strcmp("bitboard", argv[2]) == 0)
+            {
+                /* run bitboard test */
+                if (amg8833_bitboard_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* tracker test */
+            else if (strcmp("tracker", argv[2]) == 0)
+            {
+                /* run tracker test */
+                if (amg8833_tracker_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* hotspot test */
+            else if (strcmp("hotspot", argv[2]) == 0)
+            {
+                /* run hotspot test */
+                if (amg8833_hotspot_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* stats test */
+            else if (strcmp("stats", argv[2]) == 0)
+            {
+                /* run stats test */
+                if (amg8833_stats_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* roi test */
+            else if (strcmp("roi", argv[2]) == 0)
+            {
+                /* run roi test */
+                if (amg8833_roi_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* motion test */
+            else if (strcmp("motion", argv[2]) == 0)
+            {
+                /* run motion test */
+                if (amg8833_motion_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* defect test */
+            else if (strcmp("defect", argv[2]) == 0)
+            {
+                /* run defect test */
+                if (amg8833_defect_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* softint test */
+            else if (strcmp("softint", argv[2]) == 0)
+            {
+                /* run softint test */
+                if (amg8833_softint_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* rule test */
+            else if (strcmp("rule", argv[2]) == 0)
+            {
+                /* run rule test */
+                if (amg8833_rule_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* stitch test */
+            else if (strcmp("stitch", argv[2]) == 0)
+            {
+                /* run stitch test */
+                if (amg8833_stitch_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* governor test */
+            else if (strcmp("governor", argv[2]) == 0)
+            {
+                /* run governor test */
+                if (amg8833_governor_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* upscale test */
+            else if (strcmp("upscale", argv[2]) == 0)
+            {
+                /* run upscale test */
+                if (amg8833_upscale_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* nuc test */
+            else if (strcmp("nuc", argv[2]) == 0)
+            {
+                /* run nuc test */
+                if (amg8833_nuc_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* drift test */
+            else if (strcmp("drift", argv[2]) == 0)
+            {
+                /* run drift test */
+                if (amg8833_drift_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* badpixel test */
+            else if (strcmp("badpixel", argv[2]) == 0)
+            {
+                /* run badpixel test */
+                if (amg8833_badpixel_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
+             /* snapshot test */
+            else if (strcmp("snapshot", argv[2]) == 0)
+            {
+                /* run snapshot test */
+                if (amg8833_snapshot_test(atoi(argv[3])) != 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+            
             /* param is invalid */
             else
             {
@@ -307,7 +653,9 @@ uint8_t amg8833(uint8_t argc, char **argv)
             if (strcmp("read", argv[2]) == 0)
             {
                 amg8833_address_t addr;
+                amg8833_bool_t warm;
                 uint32_t i, j, k, times;
+                uint32_t elapsed;
                 uint8_t res;
                 
                 if (strcmp("0", argv[3]) == 0)
@@ -326,15 +674,23 @@ uint8_t amg8833(uint8_t argc, char **argv)
                 /* get times */
                 times = atoi(argv[4]);
                 
-                /* init */
-                res = amg8833_basic_init(addr);
+                /* resume */
+                res = amg8833_basic_resume(addr, &warm);
                 if (res != 0)
                 {
                     return 1;
                 }
+                amg8833_interface_debug_print("amg8833: %s start.\n", (warm == AMG8833_BOOL_TRUE) ? "warm" : "cold");
                 
-                /* delay 1000 ms */
-                amg8833_interface_delay_ms(1000);
+                /* wait first frame */
+                res = amg8833_basic_wait_frame_ready(AMG8833_BASIC_DEFAULT_READY_FRAMES, &elapsed);
+                if (res != 0)
+                {
+                    (void)amg8833_basic_deinit();
+                    
+                    return 1;
+                }
+                amg8833_interface_debug_print("amg8833: first frame after %d ms.\n", elapsed);
                 
                 for (i = 0; i < times; i++)
                 {
@@ -381,6 +737,96 @@ uint8_t amg8833(uint8_t argc, char **argv)
                 
                 return amg8833_basic_deinit();
             }
+             /* stream function */
+            else if (strcmp("stream", argv[2]) == 0)
+            {
+                amg8833_address_t addr;
+                amg8833_frame_t frame;
+                uint32_t i, times;
+                uint32_t elapsed;
+                const char *msg;
+                uint16_t len;
+                uint8_t res;
+                
+                if (strcmp("0", argv[3]) == 0)
+                {
+                    addr = AMG8833_ADDRESS_0;
+                }
+                else if (strcmp("1", argv[3]) == 0)
+                {
+                    addr = AMG8833_ADDRESS_1;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                /* get times */
+                times = atoi(argv[4]);
+                
+                /* init */
+                res = amg8833_basic_init(addr);
+                if (res != 0)
+                {
+                    return 1;
+                }
+                
+                /* wait first frame */
+                res = amg8833_basic_wait_frame_ready(AMG8833_BASIC_DEFAULT_READY_FRAMES, &elapsed);
+                if (res != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: wait frame ready failed.\n");
+                    (void)amg8833_basic_deinit();
+                    
+                    return 1;
+                }
+                
+                /* nothing but packets goes out on the uart until the stream stops */
+                msg = NULL;
+                for (i = 0; i < times; i++)
+                {
+                    /* read frame */
+                    res = amg8833_basic_read_frame(&frame);
+                    if (res != 0)
+                    {
+                        msg = "amg8833: read frame failed.\n";
+                        
+                        break;
+                    }
+                    
+                    /* encode the frame packet */
+                    res = amg8833_protocol_encode(&frame, (uint16_t)i, g_stream_buf, AMG8833_PROTOCOL_MAX_PACKET_SIZE, &len);
+                    if (res != 0)
+                    {
+                        msg = "amg8833: encode failed.\n";
+                        
+                        break;
+                    }
+                    
+                    /* send the packet */
+                    (void)uart1_write(g_stream_buf, len);
+                    
+                    /* wait next frame */
+                    res = amg8833_basic_wait_frame_ready(1, &elapsed);
+                    if (res != 0)
+                    {
+                        msg = "amg8833: wait frame ready failed.\n";
+                        
+                        break;
+                    }
+                }
+                
+                /* the stream is stopped, report the error after the last packet */
+                if (msg != NULL)
+                {
+                    (void)amg8833_basic_deinit();
+                    amg8833_interface_debug_print("%s", msg);
+                    
+                    return 1;
+                }
+                
+                return amg8833_basic_deinit();
+            }
             /* param is invalid */
             else
             {
@@ -470,6 +916,7 @@ uint8_t amg8833(uint8_t argc, char **argv)
             if (strcmp("int", argv[2]) == 0)
             {
                 uint32_t i, times;
+                uint32_t elapsed;
                 uint8_t res;
                 amg8833_address_t addr;
                 amg8833_interrupt_mode_t mode;
@@ -522,8 +969,17 @@ uint8_t amg8833(uint8_t argc, char **argv)
                     return 1;
                 }
                 
-                /* delay 1000 ms */
-                amg8833_interface_delay_ms(1000);
+                /* wait first frame */
+                res = amg8833_interrupt_wait_frame_ready(&elapsed);
+                if (res != 0)
+                {
+                    (void)amg8833_interrupt_deinit();
+                    g_gpio_irq = NULL;
+                    (void)gpio_interrupt_deinit();
+                    
+                    return 1;
+                }
+                amg8833_interface_debug_print("amg8833: first frame after %d ms.\n", elapsed);
                 for (i = 0; i < times; i++)
                 {
                     float temp;
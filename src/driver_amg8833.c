@@ -36,6 +36,12 @@
 
 #include "driver_amg8833.h"
 
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(__CC_ARM)
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#endif
+#endif
+
 /**
  * @brief chip information definition
  */
@@ -90,7 +96,18 @@
  */
 static uint8_t a_amg8833_iic_read(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_read(handle->iic_addr, reg, data, len) != 0)        /* read the register */
+    uint8_t res;
+    
+    if (handle->lock != NULL)                                           /* check the lock */
+    {
+        handle->lock();                                                 /* lock the bus */
+    }
+    res = handle->iic_read(handle->iic_addr, reg, data, len);           /* read the register */
+    if (handle->unlock != NULL)                                         /* check the unlock */
+    {
+        handle->unlock();                                               /* unlock the bus */
+    }
+    if (res != 0)                                                       /* check the result */
     {
         return 1;                                                       /* return error */
     }
@@ -113,7 +130,18 @@ static uint8_t a_amg8833_iic_read(amg8833_handle_t *handle, uint8_t reg, uint8_t
  */
 static uint8_t a_amg8833_iic_write(amg8833_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_write(handle->iic_addr, reg, data, len) != 0)       /* write the register */
+    uint8_t res;
+    
+    if (handle->lock != NULL)                                           /* check the lock */
+    {
+        handle->lock();                                                 /* lock the bus */
+    }
+    res = handle->iic_write(handle->iic_addr, reg, data, len);          /* write the register */
+    if (handle->unlock != NULL)                                         /* check the unlock */
+    {
+        handle->unlock();                                               /* unlock the bus */
+    }
+    if (res != 0)                                                       /* check the result */
     {
         return 1;                                                       /* return error */
     }
@@ -123,6 +151,213 @@ static uint8_t a_amg8833_iic_write(amg8833_handle_t *handle, uint8_t reg, uint8_
     }
 }
 
+/**
+ * @brief     atomically exchange the snapshot state
+ * @param[in] *state points to a state buffer
+ * @param[in] value is the new state
+ * @return    previous state
+ * @note      none
+ */
+static uint8_t a_amg8833_exchange(volatile uint8_t *state, uint8_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_exchange_n(state, value, __ATOMIC_ACQ_REL);         /* atomic exchange */
+#elif defined(__CC_ARM)
+    uint8_t prev;
+    
+    __dmb(0xF);                                                         /* memory barrier */
+    do
+    {
+        prev = (uint8_t)__ldrex(state);                                 /* load exclusive */
+    } while (__strex(value, state) != 0);                               /* store exclusive */
+    __dmb(0xF);                                                         /* memory barrier */
+    
+    return prev;                                                        /* return the previous state */
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+    return atomic_exchange((volatile _Atomic uint8_t *)state, value);   /* c11 atomic exchange */
+#else
+#error "amg8833: no atomic exchange for this toolchain"
+#endif
+}
+
+/**
+ * @brief      decode the pixel registers
+ * @param[in]  *handle points to a amg8833 handle structure, NULL means no correction
+ * @param[in]  *buf points to the pixel registers buffer
+ * @param[out] **raw points to a raw temperature buffer
+ * @param[out] **temp points to a converted temperature buffer
+ * @note       pixel_01 is stored at raw[7][7] and pixel_64 is stored at raw[0][0],
+ *             the non uniformity and drift corrections are applied in 1/256 raw data before the conversion,
+ *             then only the bad pixels are replaced from their precomputed replacement pixels
+ */
+static void a_amg8833_decode(amg8833_handle_t *handle, const uint8_t buf[128], int16_t raw[8][8], float temp[8][8])
+{
+    const amg8833_bad_pixel_t *bad;
+    int16_t *z;
+    float *f;
+    int32_t v;
+    int32_t c;
+    float t;
+    uint8_t k;
+    uint8_t i;
+    uint8_t j;
+    
+    if ((handle == NULL) || ((handle->nuc_enable == 0) && (handle->drift_table == NULL)))       /* no correction */
+    {
+        for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+        {
+            for (j = 0; j < 8; j++)                                                             /* run 8 times */
+            {
+                raw[7 - i][7 - j] = (int16_t)(((uint16_t)buf[i * 16 + j * 2 + 1] << 8) |        /* get raw data */
+                                                         buf[i * 16 + j * 2 + 0]);              /* get raw data */
+                temp[7 - i][7 - j] = (float)raw[7 - i][7 - j] * 0.25f;                          /* get converted temperature */
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+        {
+            for (j = 0; j < 8; j++)                                                             /* run 8 times */
+            {
+                k = (uint8_t)(63 - (i * 8 + j));                                                /* table index */
+                v = (int16_t)(((uint16_t)buf[i * 16 + j * 2 + 1] << 8) |
+                                         buf[i * 16 + j * 2 + 0]);                              /* get raw data */
+                c = v * 256;                                                                    /* to 1/256 raw data */
+                if (handle->nuc_enable != 0)                                                    /* non uniformity */
+                {
+                    c = (int32_t)(((int64_t)(c - handle->nuc_offset[k]) *
+                                   handle->nuc_gain[k]) >> 14);                                 /* correct the pixel */
+                }
+                if (handle->drift_table != NULL)                                                /* ambient drift */
+                {
+                    c -= handle->drift_offset[k];                                               /* remove the drift */
+                }
+                raw[7 - i][7 - j] = (int16_t)((c + 128) >> 8);                                  /* round the raw data */
+                temp[7 - i][7 - j] = (float)c * (0.25f / 256.0f);                               /* get converted temperature */
+            }
+        }
+    }
+    if ((handle == NULL) || (handle->bad_count == 0))                                           /* no bad pixel */
+    {
+        return;                                                                                 /* return */
+    }
+    
+    z = &raw[0][0];                                                                             /* flat raw */
+    f = &temp[0][0];                                                                            /* flat temp */
+    for (i = 0; i < handle->bad_count; i++)                                                     /* only the bad pixels */
+    {
+        bad = &handle->bad_pixel[i];                                                            /* get the bad pixel */
+        v = 0;                                                                                  /* init 0 */
+        t = 0.0f;                                                                               /* init 0 */
+        for (j = 0; j < bad->count; j++)                                                        /* replacement pixels */
+        {
+            v += z[bad->replace[j]];                                                            /* sum the raw */
+            t += f[bad->replace[j]];                                                            /* sum the temp */
+        }
+        if (bad->count != 0)                                                                    /* check the count */
+        {
+            z[bad->index] = (int16_t)((v >= 0) ? ((v + bad->count / 2) / bad->count) :
+                                      ((v - bad->count / 2) / bad->count));                     /* mean raw */
+            f[bad->index] = t / (float)bad->count;                                              /* mean temp */
+        }
+    }
+}
+
+/**
+ * @brief     interpolate the drift offsets at the cached thermistor
+ * @param[in] *handle points to a amg8833 handle structure
+ * @note      the thermistor is clamped to the table range
+ */
+static void a_amg8833_drift_interpolate(amg8833_handle_t *handle)
+{
+    const amg8833_drift_table_t *table;
+    int32_t t;
+    int32_t w;
+    int32_t d;
+    uint8_t n;
+    uint8_t k;
+    
+    table = handle->drift_table;                                                                   /* get the table */
+    t = handle->drift_thermistor;                                                                  /* get the thermistor */
+    if (t <= table->thermistor[0])                                                                 /* below the table */
+    {
+        memcpy(handle->drift_offset, table->offset[0], sizeof(handle->drift_offset));              /* first point */
+        
+        return;                                                                                    /* return */
+    }
+    if (t >= table->thermistor[table->points - 1])                                                 /* above the table */
+    {
+        memcpy(handle->drift_offset, table->offset[table->points - 1],
+               sizeof(handle->drift_offset));                                                      /* last point */
+        
+        return;                                                                                    /* return */
+    }
+    n = 0;                                                                                         /* init 0 */
+    while (t >= table->thermistor[n + 1])                                                          /* find the segment */
+    {
+        n++;                                                                                       /* next segment */
+    }
+    w = ((t - table->thermistor[n]) * 256) / (table->thermistor[n + 1] - table->thermistor[n]);    /* weight in 1/256 */
+    for (k = 0; k < 64; k++)                                                                       /* 64 pixels */
+    {
+        d = (table->offset[n + 1][k] - table->offset[n][k]) * w;                                   /* segment delta in 1/256 */
+        handle->drift_offset[k] = (int16_t)(table->offset[n][k] + (d >> 8));                       /* interpolate */
+    }
+}
+
+/**
+ * @brief     cache a fresh thermistor
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] data is the signed thermistor raw data
+ * @note      the drift offsets are interpolated again only when the thermistor changes
+ */
+static void a_amg8833_drift_cache(amg8833_handle_t *handle, int16_t data)
+{
+    handle->drift_count = handle->drift_period;                                        /* restart the period */
+    if ((handle->drift_valid != 0) && (handle->drift_thermistor == data))              /* not changed */
+    {
+        return;                                                                        /* return */
+    }
+    handle->drift_thermistor = data;                                                   /* cache the thermistor */
+    handle->drift_valid = 1;                                                           /* set valid */
+    if (handle->drift_table != NULL)                                                   /* check the table */
+    {
+        a_amg8833_drift_interpolate(handle);                                           /* interpolate */
+    }
+}
+
+/**
+ * @brief     refresh the cached thermistor
+ * @param[in] *handle points to a amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_amg8833_drift_refresh(amg8833_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    int16_t data;
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)buf, 2);                 /* read tthl and tthh register */
+    if (res != 0)                                                                          /* check result */
+    {
+        handle->debug_print("amg8833: read tthl register failed.\n");                      /* read tthl register failed */
+       
+        return 1;                                                                          /* return error */
+    }
+    data = (int16_t)(((uint16_t)(buf[1] & 0x7) << 8) | (buf[0] << 0));                     /* get the raw */
+    if ((buf[1] & 0x8) != 0)                                                               /* if negtive */
+    {
+        data = data * (-1);                                                                /* x (-1) */
+    }
+    a_amg8833_drift_cache(handle, data);                                                   /* cache the thermistor */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
 /**
  * @brief     set the iic address pin
  * @param[in] *handle points to a amg8833 handle structure
@@ -166,24 +401,15 @@ uint8_t amg8833_get_addr_pin(amg8833_handle_t *handle, amg8833_address_t *addr_p
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     check the linked functions
  * @param[in] *handle points to a amg8833 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 iic initialization failed
- *            - 2 handle is NULL
  *            - 3 linked functions is NULL
- *            - 4 reset failed
  * @note      none
  */
-uint8_t amg8833_init(amg8833_handle_t *handle)
+static uint8_t a_amg8833_check_link(amg8833_handle_t *handle)
 {
-    uint8_t res, prev;
-  
-    if (handle == NULL)                                                             /* check handle */
-    {
-        return 2;                                                                   /* return error */
-    }
     if (handle->debug_print == NULL)                                                /* check debug_print */
     {
         return 3;                                                                   /* return error */
@@ -224,12 +450,23 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
        
         return 3;                                                                   /* return error */
     }
-    if (handle->iic_init() != 0)                                                    /* iic init */
-    {
-        handle->debug_print("amg8833: iic init failed.\n");                         /* iic init failed */
-       
-        return 3;                                                                   /* return error */
-    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     power on and reset the chip
+ * @param[in] *handle points to a amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write pctl failed
+ *            - 4 reset failed
+ * @note      the iic bus is deinited on failure
+ */
+static uint8_t a_amg8833_power_on(amg8833_handle_t *handle)
+{
+    uint8_t res, prev;
+    
     prev = 0x00;                                                                    /* normal mode */
     res = a_amg8833_iic_write(handle, AMG8833_REG_PCTL, (uint8_t *)&prev, 1);       /* write pctl register */
     if (res != 0)                                                                   /* check result */
@@ -259,6 +496,137 @@ uint8_t amg8833_init(amg8833_handle_t *handle)
         
         return 4;                                                                   /* return error */
     }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle points to a amg8833 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 reset failed
+ * @note      none
+ */
+uint8_t amg8833_init(amg8833_handle_t *handle)
+{
+    uint8_t res;
+  
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (a_amg8833_check_link(handle) != 0)                                          /* check the linked functions */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (handle->iic_init() != 0)                                                    /* iic init */
+    {
+        handle->debug_print("amg8833: iic init failed.\n");                         /* iic init failed */
+       
+        return 3;                                                                   /* return error */
+    }
+    res = a_amg8833_power_on(handle);                                               /* power on and reset */
+    if (res != 0)                                                                   /* check result */
+    {
+        return res;                                                                 /* return error */
+    }
+    handle->inited = 1;                                                             /* flag finish initialization */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      resume the chip without a reset when it is already running
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  mode is the desired chip mode
+ * @param[in]  rate is the desired frame rate
+ * @param[out] *warm points to a warm start buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle or warm is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 power on or reset failed
+ *             - 5 set mode or frame rate failed
+ * @note       the chip is running when pctl and fpsc already hold mode and rate and the thermistor holds a conversion,
+ *             then no register is written and no delay is taken,
+ *             otherwise it falls back to the amg8833_init sequence and sets mode and rate,
+ *             only pctl and fpsc are compared, the other registers such as ave and intc are not checked
+ *             and must be written again by the caller
+ */
+uint8_t amg8833_resume(amg8833_handle_t *handle, amg8833_mode_t mode, amg8833_frame_rate_t rate, amg8833_bool_t *warm)
+{
+    uint8_t res;
+    uint8_t prev;
+    uint8_t buf[2];
+    
+    if ((handle == NULL) || (warm == NULL))                                         /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (a_amg8833_check_link(handle) != 0)                                          /* check the linked functions */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (handle->iic_init() != 0)                                                    /* iic init */
+    {
+        handle->debug_print("amg8833: iic init failed.\n");                         /* iic init failed */
+       
+        return 1;                                                                   /* return error */
+    }
+    
+    *warm = AMG8833_BOOL_FALSE;                                                     /* cold start */
+    if ((a_amg8833_iic_read(handle, AMG8833_REG_PCTL, &buf[0], 1) == 0) &&
+        (a_amg8833_iic_read(handle, AMG8833_REG_FPSC, &buf[1], 1) == 0) &&
+        (buf[0] == (uint8_t)mode) && ((buf[1] & 0x01) == (uint8_t)rate))            /* check the mode and rate */
+    {
+        if ((a_amg8833_iic_read(handle, AMG8833_REG_TTHL, &buf[0], 1) == 0) &&
+            (a_amg8833_iic_read(handle, AMG8833_REG_TTHH, &buf[1], 1) == 0) &&
+            ((buf[0] | (buf[1] & 0x07)) != 0))                                      /* check the thermistor */
+        {
+            *warm = AMG8833_BOOL_TRUE;                                              /* warm start */
+        }
+    }
+    if ((*warm) == AMG8833_BOOL_TRUE)                                               /* check the start */
+    {
+        handle->inited = 1;                                                         /* flag finish initialization */
+        
+        return 0;                                                                   /* success return 0 */
+    }
+    
+    res = a_amg8833_power_on(handle);                                               /* power on and reset */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 4;                                                                   /* return error */
+    }
+    if (mode != AMG8833_MODE_NORMAL)                                                /* check the mode */
+    {
+        prev = (uint8_t)mode;                                                       /* set the mode */
+        res = a_amg8833_iic_write(handle, AMG8833_REG_PCTL, (uint8_t *)&prev, 1);   /* write pctl register */
+        if (res != 0)                                                               /* check result */
+        {
+            handle->debug_print("amg8833: write pctl register failed.\n");          /* write pctl register failed */
+            (void)handle->iic_deinit();                                             /* iic deinit */
+           
+            return 5;                                                               /* return error */
+        }
+    }
+    if (rate != AMG8833_FRAME_RATE_10_FPS)                                          /* check the rate */
+    {
+        prev = (uint8_t)rate;                                                       /* set the rate */
+        res = a_amg8833_iic_write(handle, AMG8833_REG_FPSC, (uint8_t *)&prev, 1);   /* write fpsc register */
+        if (res != 0)                                                               /* check result */
+        {
+            handle->debug_print("amg8833: write fpsc register failed.\n");          /* write fpsc register failed */
+            (void)handle->iic_deinit();                                             /* iic deinit */
+           
+            return 5;                                                               /* return error */
+        }
+    }
     handle->inited = 1;                                                             /* flag finish initialization */
     
     return 0;                                                                       /* success return 0 */
@@ -1279,6 +1647,7 @@ uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *
         data = data * (-1);                                                          /* x (-1) */
     }
     *temp = data * 0.0625f;                                                          /* convert the temperature */
+    a_amg8833_drift_cache(handle, data);                                             /* cache the thermistor */
     
     return 0;                                                                        /* success return 0 */
 }
@@ -1304,8 +1673,6 @@ uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *
 uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][8], float temp[8][8])
 {
     uint8_t res;
-    uint8_t i;
-    uint8_t j;
     uint8_t buf[128];
     
     if (handle == NULL)                                                                     /* check handle */
@@ -1317,6 +1684,18 @@ uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][
         return 3;                                                                           /* return error */
     }
     
+    if ((handle->drift_table != NULL) &&
+        ((handle->drift_valid == 0) || (handle->drift_count == 0)))                         /* thermistor is stale */
+    {
+        if (a_amg8833_drift_refresh(handle) != 0)                                           /* refresh the thermistor */
+        {
+            return 1;                                                                       /* return error */
+        }
+    }
+    if (handle->drift_count != 0)                                                           /* check the count */
+    {
+        handle->drift_count--;                                                              /* one frame older */
+    }
     res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);                /* read t01l register */
     if (res != 0)                                                                           /* check result */
     {
@@ -1324,65 +1703,242 @@ uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][
        
         return 1;                                                                           /* return error */
     }
-    for (i = 0; i < 8; i++)                                                                 /* run 8 times */
+    a_amg8833_decode(handle, buf, raw, temp);                                               /* decode the pixels */
+    if (handle->snapshot != NULL)                                                           /* check the snapshot */
     {
-        for (j = 0; j < 8; j++)                                                             /* run 8 times */
-        {
-            raw[7 - i][7 - j] = (int16_t)(((uint16_t)buf[i * 16 + j * 2 + 1] << 8) |        /* get raw data */
-                                                     buf[i * 16 + j * 2 + 0]);              /* get raw data */
-            temp[7 - i][7 - j] = (float)raw[7 - i][7 - j] * 0.25f;                          /* get converted temperature */
-        }
+        (void)amg8833_snapshot_publish(handle->snapshot, raw, temp);                        /* publish the frame */
     }
-
+    
     return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief      get the interrupt table
+ * @brief      read the raw frame
  * @param[in]  *handle points to a amg8833 handle structure
- * @param[out] **table points to a interrupt table buffer
+ * @param[out] *frame points to a frame structure
  * @return     status code
  *             - 0 success
- *             - 1 get interrupt table failed
+ *             - 1 read frame failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       pixel_64 pixel_63 ... pixel_57 (bit)
- *             .                            .
- *             .                            .
- *             .                            .
- *             .                            .
- *             .                            .
- * @note       pixel_08 pixel_07 ... pixel_01
+ * @note       the pixel registers, the thermistor and the status are read in three bursts,
+ *             timestamp and interrupt are not touched
  */
-uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1])
+uint8_t amg8833_read_frame(amg8833_handle_t *handle, amg8833_frame_t *frame)
 {
     uint8_t res;
+    uint8_t buf[2];
     
-    if (handle == NULL)                                                               /* check handle */
+    if (handle == NULL)                                                                     /* check handle */
     {
-        return 2;                                                                     /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                          /* check handle initialization */
+    if (handle->inited != 1)                                                                /* check handle initialization */
     {
-        return 3;                                                                     /* return error */
+        return 3;                                                                           /* return error */
     }
     
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)table[7], 1);       /* read int0 register */
-    if (res != 0)                                                                     /* check result */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)frame->raw, 128);         /* read t01l register */
+    if (res != 0)                                                                           /* check result */
     {
-        handle->debug_print("amg8833: read int0 register failed.\n");                 /* read int0 register failed */
+        handle->debug_print("amg8833: read t01l register failed.\n");                       /* read t01l register failed */
        
-        return 1;                                                                     /* return error */
+        return 1;                                                                           /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT1, (uint8_t *)table[6], 1);       /* read int1 register */
-    if (res != 0)                                                                     /* check result */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)buf, 2);                  /* read tthl and tthh register */
+    if (res != 0)                                                                           /* check result */
     {
-        handle->debug_print("amg8833: read int1 register failed.\n");                 /* read int1 register failed */
+        handle->debug_print("amg8833: read tthl register failed.\n");                       /* read tthl register failed */
        
-        return 1;                                                                     /* return error */
+        return 1;                                                                           /* return error */
     }
-    res = a_amg8833_iic_read(handle, AMG8833_REG_INT2, (uint8_t *)table[5], 1);       /* read int2 register */
-    if (res != 0)                                                                     /* check result */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_STAT, (uint8_t *)&frame->status, 1);       /* read stat register */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("amg8833: read stat register failed.\n");                       /* read stat register failed */
+       
+        return 1;                                                                           /* return error */
+    }
+    frame->thermistor = (int16_t)(((uint16_t)(buf[1] & 0xF) << 8) | (buf[0] << 0));         /* get the raw */
+    frame->addr = handle->iic_addr;                                                         /* set the address */
+    a_amg8833_drift_cache(handle, (int16_t)(((buf[1] & 0x8) != 0) ?
+                          -(int16_t)(frame->thermistor & 0x7FF) :
+                          (int16_t)(frame->thermistor & 0x7FF)));                           /* cache the thermistor */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      wait until fresh frames are output after the configuration
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  frames is the fresh frame count
+ * @param[in]  poll is the poll period in ms
+ * @param[in]  timeout is the timeout in ms
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or elapsed is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ *             - 5 param is invalid
+ * @note       every poll reads the thermistor and the first 16 pixels as a fingerprint,
+ *             a frame is fresh when its fingerprint differs from the previous poll,
+ *             use 2 frames in the twice moving average mode and a poll period below the frame period,
+ *             elapsed is the sum of the poll delays up to the first fresh frame, the iic transfer time is not counted,
+ *             on timeout without any fresh frame it is the whole delay time, the last delay is cut at the timeout
+ */
+uint8_t amg8833_wait_frame_ready(amg8833_handle_t *handle, uint8_t frames, uint16_t poll, uint32_t timeout,
+                                 uint32_t *elapsed)
+{
+    uint8_t res;
+    uint8_t fresh;
+    uint8_t prev[34];
+    uint8_t buf[34];
+    uint32_t t;
+    uint32_t d;
+    
+    if ((handle == NULL) || (elapsed == NULL))                                              /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if ((frames == 0) || (poll == 0))                                                       /* check param */
+    {
+        return 5;                                                                           /* return error */
+    }
+    
+    t = 0;                                                                                  /* init 0 */
+    fresh = 0;                                                                              /* init 0 */
+    res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)&prev[0], 2);             /* read tthl register */
+    res |= a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)&prev[2], 32);           /* read t01l register */
+    if (res != 0)                                                                           /* check result */
+    {
+        handle->debug_print("amg8833: read fingerprint failed.\n");                         /* read fingerprint failed */
+       
+        return 1;                                                                           /* return error */
+    }
+    while (t < timeout)                                                                     /* until timeout */
+    {
+        d = ((timeout - t) < poll) ? (timeout - t) : poll;                                  /* cut the last delay */
+        handle->delay_ms(d);                                                                /* wait the poll period */
+        t += d;                                                                             /* add the delay */
+        res = a_amg8833_iic_read(handle, AMG8833_REG_TTHL, (uint8_t *)&buf[0], 2);          /* read tthl register */
+        res |= a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)&buf[2], 32);        /* read t01l register */
+        if (res != 0)                                                                       /* check result */
+        {
+            handle->debug_print("amg8833: read fingerprint failed.\n");                     /* read fingerprint failed */
+           
+            return 1;                                                                       /* return error */
+        }
+        if (memcmp(buf, prev, 34) != 0)                                                     /* check the fingerprint */
+        {
+            if (fresh == 0)                                                                 /* first fresh frame */
+            {
+                *elapsed = t;                                                               /* latch the time */
+            }
+            fresh++;                                                                        /* one more fresh frame */
+            if (fresh >= frames)                                                            /* check the frames */
+            {
+                return 0;                                                                   /* success return 0 */
+            }
+            memcpy(prev, buf, 34);                                                          /* save the fingerprint */
+        }
+    }
+    if (fresh == 0)                                                                         /* no fresh frame */
+    {
+        *elapsed = t;                                                                       /* whole delay time */
+    }
+    
+    return 4;                                                                               /* return error */
+}
+
+/**
+ * @brief      convert the raw frame to the temperature array
+ * @param[in]  *frame points to a frame structure
+ * @param[out] **raw points to a raw temperature buffer
+ * @param[out] **temp points to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ * @note       the output has the same orientation as amg8833_read_temperature_array,
+ *             the frame holds the registers so no non uniformity correction is applied
+ */
+uint8_t amg8833_frame_convert_to_array(const amg8833_frame_t *frame, int16_t raw[8][8], float temp[8][8])
+{
+    if (frame == NULL)                                    /* check frame */
+    {
+        return 2;                                         /* return error */
+    }
+    
+    a_amg8833_decode(NULL, frame->raw, raw, temp);        /* decode the pixels */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     get a raw pixel of the raw frame
+ * @param[in] *frame points to a frame structure
+ * @param[in] index is the pixel index row * 8 + col
+ * @return    raw data
+ * @note      the pixel has the same orientation as amg8833_read_temperature_array,
+ *            frame must not be NULL and index must be below 64
+ */
+int16_t amg8833_frame_get_pixel(const amg8833_frame_t *frame, uint8_t index)
+{
+    return (int16_t)(((uint16_t)frame->raw[127 - index * 2] << 8) |
+                                frame->raw[126 - index * 2]);        /* pixel_64 is stored first */
+}
+
+/**
+ * @brief      get the interrupt table
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] **table points to a interrupt table buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt table failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       pixel_64 pixel_63 ... pixel_57 (bit)
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ *             .                            .
+ * @note       pixel_08 pixel_07 ... pixel_01
+ */
+uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1])
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)table[7], 1);       /* read int0 register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read int0 register failed.\n");                 /* read int0 register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT1, (uint8_t *)table[6], 1);       /* read int1 register */
+    if (res != 0)                                                                     /* check result */
+    {
+        handle->debug_print("amg8833: read int1 register failed.\n");                 /* read int1 register failed */
+       
+        return 1;                                                                     /* return error */
+    }
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT2, (uint8_t *)table[5], 1);       /* read int2 register */
+    if (res != 0)                                                                     /* check result */
     {
         handle->debug_print("amg8833: read int2 register failed.\n");                 /* read int2 register failed */
        
@@ -1427,6 +1983,669 @@ uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1
     return 0;                                                                         /* success return 0 */
 }
 
+/**
+ * @brief      get the interrupt mask
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *mask points to a interrupt mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       int0 - int7 are read in one burst and bit (row * 8 + col) is pixel [row][col] of
+ *             amg8833_read_temperature_array, so bit 0 is pixel_64 and bit 63 is pixel_01
+ */
+uint8_t amg8833_get_interrupt_mask(amg8833_handle_t *handle, uint64_t *mask)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t buf[8];
+    uint64_t x;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_INT0, (uint8_t *)buf, 8);                /* read int0 - int7 registers */
+    if (res != 0)                                                                         /* check result */
+    {
+        handle->debug_print("amg8833: read int registers failed.\n");                     /* read int registers failed */
+       
+        return 1;                                                                         /* return error */
+    }
+    x = 0;                                                                                /* init 0 */
+    for (i = 0; i < 8; i++)                                                               /* run 8 times */
+    {
+        x |= (uint64_t)buf[i] << (i * 8);                                                 /* bit (i * 8 + j) is pixel (i * 8 + j + 1) */
+    }
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);          /* reverse the bits */
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);          /* reverse the bit pairs */
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);          /* reverse the nibbles */
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);          /* reverse the bytes */
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);        /* reverse the half words */
+    *mask = (x >> 32) | (x << 32);                                                        /* reverse the words */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the non uniformity correction
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] enable is a bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the correction is applied while decoding in amg8833_read_temperature_array
+ */
+uint8_t amg8833_nuc_set_enable(amg8833_handle_t *handle, amg8833_bool_t enable)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    handle->nuc_enable = (uint8_t)enable;            /* set the enable */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the non uniformity correction status
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *enable points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_nuc_get_enable(amg8833_handle_t *handle, amg8833_bool_t *enable)
+{
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    *enable = (amg8833_bool_t)(handle->nuc_enable);           /* get the enable */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the non uniformity correction table
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] offset is the offset table in 1/256 raw data
+ * @param[in] gain is the gain table, 16384 is 1.0
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle, offset or gain is NULL
+ * @note      corrected = (raw - offset) * gain
+ */
+uint8_t amg8833_nuc_set_table(amg8833_handle_t *handle, int32_t offset[8][8], uint16_t gain[8][8])
+{
+    if ((handle == NULL) || (offset == NULL) || (gain == NULL))                  /* check param */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    memcpy(handle->nuc_offset, &offset[0][0], sizeof(handle->nuc_offset));       /* set the offset table */
+    memcpy(handle->nuc_gain, &gain[0][0], sizeof(handle->nuc_gain));             /* set the gain table */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the non uniformity correction table
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] offset is the offset table in 1/256 raw data
+ * @param[out] gain is the gain table, 16384 is 1.0
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle, offset or gain is NULL
+ * @note       none
+ */
+uint8_t amg8833_nuc_get_table(amg8833_handle_t *handle, int32_t offset[8][8], uint16_t gain[8][8])
+{
+    if ((handle == NULL) || (offset == NULL) || (gain == NULL))                  /* check param */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    memcpy(&offset[0][0], handle->nuc_offset, sizeof(handle->nuc_offset));       /* get the offset table */
+    memcpy(&gain[0][0], handle->nuc_gain, sizeof(handle->nuc_gain));             /* get the gain table */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      capture the mean of frames
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  frames is the frame count
+ * @param[out] mean is the mean array in 1/256 raw data
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ *             - 2 handle or mean is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frames is invalid
+ * @note       the sensor must look at a uniform scene, the frames are read without correction at the frame rate
+ */
+uint8_t amg8833_nuc_capture(amg8833_handle_t *handle, uint16_t frames, int32_t mean[8][8])
+{
+    uint8_t res;
+    uint8_t prev;
+    uint8_t buf[128];
+    int16_t raw[8][8];
+    float temp[8][8];
+    int32_t sum[64];
+    int32_t half;
+    uint32_t period;
+    uint16_t n;
+    uint8_t i;
+    
+    if ((handle == NULL) || (mean == NULL))                                                  /* check param */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if (frames == 0)                                                                         /* check frames */
+    {
+        handle->debug_print("amg8833: frames is invalid.\n");                                /* frames is invalid */
+        
+        return 5;                                                                            /* return error */
+    }
+    
+    res = a_amg8833_iic_read(handle, AMG8833_REG_FPSC, (uint8_t *)&prev, 1);                 /* read fpsc register */
+    if (res != 0)                                                                            /* check result */
+    {
+        handle->debug_print("amg8833: read fpsc register failed.\n");                        /* read fpsc register failed */
+       
+        return 1;                                                                            /* return error */
+    }
+    period = ((prev & 0x01) != 0) ? 1000 : 100;                                              /* frame period */
+    memset(sum, 0, sizeof(sum));                                                             /* clear the sum */
+    for (n = 0; n < frames; n++)                                                             /* all frames */
+    {
+        handle->delay_ms(period);                                                            /* wait a new frame */
+        res = a_amg8833_iic_read(handle, AMG8833_REG_T01L, (uint8_t *)buf, 128);             /* read t01l register */
+        if (res != 0)                                                                        /* check result */
+        {
+            handle->debug_print("amg8833: read t01l register failed.\n");                    /* read t01l register failed */
+           
+            return 1;                                                                        /* return error */
+        }
+        a_amg8833_decode(NULL, buf, raw, temp);                                              /* decode without correction */
+        for (i = 0; i < 64; i++)                                                             /* 64 pixels */
+        {
+            sum[i] += raw[i / 8][i % 8];                                                     /* sum */
+        }
+    }
+    for (i = 0; i < 64; i++)                                                                 /* 64 pixels */
+    {
+        half = (sum[i] < 0) ? -(int32_t)(frames / 2) : (int32_t)(frames / 2);                /* half a frame away from zero */
+        mean[i / 8][i % 8] = (int32_t)(((int64_t)sum[i] * 256 + half) / frames);             /* round the mean */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     calibrate the offset table with one uniform scene
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] mean is the mean array from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or mean is NULL
+ * @note      the gain table is set to 1.0 and the correction is enabled
+ */
+uint8_t amg8833_nuc_calibrate_offset(amg8833_handle_t *handle, int32_t mean[8][8])
+{
+    int64_t avg;
+    uint8_t i;
+    
+    if ((handle == NULL) || (mean == NULL))                                          /* check param */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    avg = 0;                                                                         /* init 0 */
+    for (i = 0; i < 64; i++)                                                         /* 64 pixels */
+    {
+        avg += mean[i / 8][i % 8];                                                   /* sum */
+    }
+    avg /= 64;                                                                       /* frame mean */
+    for (i = 0; i < 64; i++)                                                         /* 64 pixels */
+    {
+        handle->nuc_offset[i] = (int32_t)(mean[i / 8][i % 8] - avg);                 /* pixel offset */
+        handle->nuc_gain[i] = 16384;                                                 /* unity gain */
+    }
+    handle->nuc_enable = 1;                                                          /* enable */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     calibrate the offset and gain tables with two uniform scenes
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] low is the mean array of the cold scene from amg8833_nuc_capture
+ * @param[in] high is the mean array of the hot scene from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle, low or high is NULL
+ *            - 5 scenes are invalid
+ * @note      every pixel is mapped to the frame mean at both scenes and the correction is enabled
+ */
+uint8_t amg8833_nuc_calibrate_two_point(amg8833_handle_t *handle, int32_t low[8][8], int32_t high[8][8])
+{
+    int32_t offset[64];
+    uint16_t gain[64];
+    int64_t avg_low;
+    int64_t avg_high;
+    int64_t span;
+    int64_t g;
+    uint8_t i;
+    
+    if ((handle == NULL) || (low == NULL) || (high == NULL))                                /* check param */
+    {
+        return 2;                                                                           /* return error */
+    }
+    
+    avg_low = 0;                                                                            /* init 0 */
+    avg_high = 0;                                                                           /* init 0 */
+    for (i = 0; i < 64; i++)                                                                /* 64 pixels */
+    {
+        avg_low += low[i / 8][i % 8];                                                       /* sum */
+        avg_high += high[i / 8][i % 8];                                                     /* sum */
+    }
+    avg_low /= 64;                                                                          /* cold frame mean */
+    avg_high /= 64;                                                                         /* hot frame mean */
+    if (avg_high <= avg_low)                                                                /* check the scenes */
+    {
+        handle->debug_print("amg8833: scenes are invalid.\n");                              /* scenes are invalid */
+        
+        return 5;                                                                           /* return error */
+    }
+    for (i = 0; i < 64; i++)                                                                /* 64 pixels */
+    {
+        span = (int64_t)high[i / 8][i % 8] - low[i / 8][i % 8];                             /* pixel span */
+        g = (span > 0) ? ((avg_high - avg_low) * 16384 + span / 2) / span : 0;              /* pixel gain */
+        if ((g <= 0) || (g > 0xFFFF))                                                       /* check the gain */
+        {
+            handle->debug_print("amg8833: scenes are invalid.\n");                          /* scenes are invalid */
+            
+            return 5;                                                                       /* return error */
+        }
+        gain[i] = (uint16_t)g;                                                              /* set the gain */
+        g = (avg_low * span) / (avg_high - avg_low);                                        /* offset of the pixel */
+        offset[i] = (int32_t)(low[i / 8][i % 8] - g);                                       /* set the offset */
+    }
+    memcpy(handle->nuc_offset, offset, sizeof(offset));                                     /* set the offset table */
+    memcpy(handle->nuc_gain, gain, sizeof(gain));                                           /* set the gain table */
+    handle->nuc_enable = 1;                                                                 /* enable */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the drift table
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] *table points to a drift table, NULL disables the compensation
+ * @param[in] period is the thermistor refresh period in frames
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 5 table or period is invalid
+ * @note      the table is not copied, amg8833_read_temperature_array reads the thermistor only when
+ *            the cached value is older than period frames and subtracts the interpolated pixel offsets while decoding
+ */
+uint8_t amg8833_drift_set_table(amg8833_handle_t *handle, const amg8833_drift_table_t *table, uint16_t period)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (table == NULL)                                                                    /* disable */
+    {
+        handle->drift_table = NULL;                                                       /* no table */
+        
+        return 0;                                                                         /* success return 0 */
+    }
+    if ((period == 0) || (table->points == 0) ||
+        (table->points > AMG8833_DRIFT_MAX_POINTS))                                       /* check param */
+    {
+        handle->debug_print("amg8833: table or period is invalid.\n");                    /* table or period is invalid */
+        
+        return 5;                                                                         /* return error */
+    }
+    for (i = 1; i < table->points; i++)                                                   /* check the order */
+    {
+        if (table->thermistor[i] <= table->thermistor[i - 1])                             /* not ascending */
+        {
+            handle->debug_print("amg8833: table or period is invalid.\n");                /* table or period is invalid */
+            
+            return 5;                                                                     /* return error */
+        }
+    }
+    
+    handle->drift_table = table;                                                          /* set the table */
+    handle->drift_period = period;                                                        /* set the period */
+    handle->drift_count = 0;                                                              /* refresh at the next frame */
+    if (handle->drift_valid != 0)                                                         /* cached thermistor */
+    {
+        a_amg8833_drift_interpolate(handle);                                              /* interpolate */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the cached thermistor
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *raw points to a signed thermistor raw data buffer
+ * @param[out] *temp points to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 no cached thermistor
+ * @note       none
+ */
+uint8_t amg8833_drift_get_thermistor(amg8833_handle_t *handle, int16_t *raw, float *temp)
+{
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (handle->drift_valid == 0)                                    /* check the cache */
+    {
+        return 4;                                                    /* return error */
+    }
+    
+    *raw = handle->drift_thermistor;                                 /* get the raw */
+    *temp = (float)handle->drift_thermistor * 0.0625f;               /* convert the temperature */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     clear a drift table
+ * @param[in] *table points to a drift table
+ * @return    status code
+ *            - 0 success
+ *            - 2 table is NULL
+ * @note      none
+ */
+uint8_t amg8833_drift_table_clear(amg8833_drift_table_t *table)
+{
+    if (table == NULL)                                         /* check table */
+    {
+        return 2;                                              /* return error */
+    }
+    
+    memset(table, 0, sizeof(amg8833_drift_table_t));           /* clear the table */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     add a point to a drift table
+ * @param[in] *table points to a drift table
+ * @param[in] thermistor is the signed thermistor raw data of the point
+ * @param[in] mean is the mean array at the point from amg8833_nuc_capture
+ * @param[in] base is the mean array of the same scene at the reference ambient from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 table, mean or base is NULL
+ *            - 4 table is full
+ *            - 5 thermistor already exists
+ * @note      points are kept in thermistor order and offsets are limited to the int16 range
+ */
+uint8_t amg8833_drift_table_add(amg8833_drift_table_t *table, int16_t thermistor, int32_t mean[8][8], int32_t base[8][8])
+{
+    int32_t d;
+    uint8_t n;
+    uint8_t k;
+    
+    if ((table == NULL) || (mean == NULL) || (base == NULL))                             /* check param */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (table->points >= AMG8833_DRIFT_MAX_POINTS)                                       /* check the table */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    n = table->points;                                                                   /* insert position */
+    while ((n > 0) && (table->thermistor[n - 1] >= thermistor))                          /* find the position */
+    {
+        if (table->thermistor[n - 1] == thermistor)                                      /* same point */
+        {
+            return 5;                                                                    /* return error */
+        }
+        n--;                                                                             /* previous */
+    }
+    memmove(&table->thermistor[n + 1], &table->thermistor[n],
+            sizeof(int16_t) * (table->points - n));                                      /* shift the points */
+    memmove(table->offset[n + 1], table->offset[n],
+            sizeof(table->offset[0]) * (table->points - n));                             /* shift the offsets */
+    table->thermistor[n] = thermistor;                                                   /* set the thermistor */
+    for (k = 0; k < 64; k++)                                                             /* 64 pixels */
+    {
+        d = mean[k / 8][k % 8] - base[k / 8][k % 8];                                     /* drift */
+        d = (d < INT16_MIN) ? INT16_MIN : ((d > INT16_MAX) ? INT16_MAX : d);             /* limit */
+        table->offset[n][k] = (int16_t)d;                                                /* set the offset */
+    }
+    table->points++;                                                                     /* count */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the bad pixel mask
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] mask is the bad pixel mask, bit (row * 8 + col)
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 5 too many bad pixels
+ * @note      the replacement indexes are computed once here, amg8833_read_temperature_array then replaces
+ *            every bad pixel with the mean of its good 4 neighbours, or of its good diagonal neighbours
+ */
+uint8_t amg8833_set_bad_pixel_mask(amg8833_handle_t *handle, uint64_t mask)
+{
+    const int8_t dr[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+    const int8_t dc[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+    amg8833_bad_pixel_t *bad;
+    uint8_t count;
+    uint8_t n;
+    uint8_t k;
+    int8_t r;
+    int8_t c;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    count = 0;                                                                             /* init 0 */
+    for (k = 0; k < 64; k++)                                                               /* count the bad pixels */
+    {
+        count = (uint8_t)(count + ((mask >> k) & 0x01));                                   /* add the bit */
+    }
+    if (count > AMG8833_BAD_PIXEL_MAX)                                                     /* check the count */
+    {
+        handle->debug_print("amg8833: too many bad pixels.\n");                            /* too many bad pixels */
+        
+        return 5;                                                                          /* return error */
+    }
+    
+    handle->bad_count = 0;                                                                 /* init 0 */
+    for (k = 0; k < 64; k++)                                                               /* 64 pixels */
+    {
+        if (((mask >> k) & 0x01) == 0)                                                     /* good pixel */
+        {
+            continue;                                                                      /* next */
+        }
+        bad = &handle->bad_pixel[handle->bad_count];                                       /* new bad pixel */
+        bad->index = k;                                                                    /* set the index */
+        bad->count = 0;                                                                    /* init 0 */
+        for (n = 0; n < 8; n++)                                                            /* 4 neighbours, then diagonals */
+        {
+            if ((n == 4) && (bad->count != 0))                                             /* 4 neighbours found */
+            {
+                break;                                                                     /* stop */
+            }
+            r = (int8_t)(k / 8 + dr[n]);                                                   /* neighbour row */
+            c = (int8_t)(k % 8 + dc[n]);                                                   /* neighbour col */
+            if ((r < 0) || (r > 7) || (c < 0) || (c > 7) ||
+                (((mask >> (r * 8 + c)) & 0x01) != 0))                                     /* outside or bad */
+            {
+                continue;                                                                  /* next */
+            }
+            bad->replace[bad->count] = (uint8_t)(r * 8 + c);                               /* set the replacement */
+            bad->count++;                                                                  /* count */
+        }
+        handle->bad_count++;                                                               /* count */
+    }
+    handle->bad_mask = mask;                                                               /* set the mask */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the bad pixel mask
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *mask points to a bad pixel mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_bad_pixel_mask(amg8833_handle_t *handle, uint64_t *mask)
+{
+    if (handle == NULL)                      /* check handle */
+    {
+        return 2;                            /* return error */
+    }
+    
+    *mask = handle->bad_mask;                /* get the mask */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief     initialize the snapshot
+ * @param[in] *snapshot points to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 snapshot is NULL
+ * @note      none
+ */
+uint8_t amg8833_snapshot_init(amg8833_snapshot_t *snapshot)
+{
+    if (snapshot == NULL)                                      /* check snapshot */
+    {
+        return 2;                                              /* return error */
+    }
+    
+    memset(snapshot, 0, sizeof(amg8833_snapshot_t));           /* clear the snapshot */
+    snapshot->write = 0;                                       /* writer owns frame 0 */
+    snapshot->read = 1;                                        /* reader owns frame 1 */
+    snapshot->state = 2;                                       /* frame 2 is the middle frame */
+    snapshot->sequence = 1;                                    /* first sequence */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief     set the snapshot
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] *snapshot points to a snapshot structure, NULL disables the snapshot
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      every amg8833_read_temperature_array publishes its frame to the snapshot
+ */
+uint8_t amg8833_set_snapshot(amg8833_handle_t *handle, amg8833_snapshot_t *snapshot)
+{
+    if (handle == NULL)                   /* check handle */
+    {
+        return 2;                         /* return error */
+    }
+    
+    handle->snapshot = snapshot;          /* set the snapshot */
+    
+    return 0;                             /* success return 0 */
+}
+
+/**
+ * @brief     publish a frame to the snapshot
+ * @param[in] *snapshot points to a snapshot structure
+ * @param[in] **raw points to a raw data buffer
+ * @param[in] **temp points to a temperature buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 snapshot, raw or temp is NULL
+ * @note      only one writer thread, it never waits for the reader
+ */
+uint8_t amg8833_snapshot_publish(amg8833_snapshot_t *snapshot, int16_t raw[8][8], float temp[8][8])
+{
+    amg8833_snapshot_frame_t *frame;
+    
+    if ((snapshot == NULL) || (raw == NULL) || (temp == NULL))                               /* check param */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    frame = &snapshot->frame[snapshot->write];                                               /* writer frame */
+    frame->sequence = snapshot->sequence;                                                    /* set the sequence */
+    memcpy(frame->raw, raw, sizeof(frame->raw));                                             /* copy the raw data */
+    memcpy(frame->temp, temp, sizeof(frame->temp));                                          /* copy the temperature */
+    snapshot->sequence++;                                                                    /* next sequence */
+    snapshot->write = a_amg8833_exchange(&snapshot->state,
+                                         (uint8_t)(snapshot->write | 0x04)) & 0x03;          /* swap with the middle frame */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      acquire the latest frame
+ * @param[in]  *snapshot points to a snapshot structure
+ * @param[out] **frame points to a frame pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new frame
+ *             - 2 snapshot or frame is NULL
+ * @note       only one reader thread, the frame stays valid and untouched until the next acquire,
+ *             with no new frame it points to the previous one whose sequence is 0 before the first frame
+ */
+uint8_t amg8833_snapshot_acquire(amg8833_snapshot_t *snapshot, const amg8833_snapshot_frame_t **frame)
+{
+    uint8_t res;
+    
+    if ((snapshot == NULL) || (frame == NULL))                                               /* check param */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    res = 1;                                                                                 /* no new frame */
+    if ((snapshot->state & 0x04) != 0)                                                       /* check the new flag */
+    {
+        snapshot->read = a_amg8833_exchange(&snapshot->state, snapshot->read) & 0x03;        /* swap with the middle frame */
+        res = 0;                                                                             /* new frame */
+    }
+    *frame = &snapshot->frame[snapshot->read];                                               /* reader frame */
+    
+    return res;                                                                              /* return the result */
+}
+
 /**
  * @brief     set the chip register
  * @param[in] *handle points to a amg8833 handle structure
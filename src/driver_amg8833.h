@@ -131,6 +131,61 @@ typedef enum
     AMG8833_AVERAGE_MODE_TWICE = 0x01,        /**< twice moving average output mode */
 } amg8833_average_mode_t;
 
+/**
+ * @brief amg8833 drift definition
+ */
+#define AMG8833_DRIFT_MAX_POINTS        8        /**< max drift table points */
+
+/**
+ * @brief amg8833 drift table structure definition
+ * @note  offsets are indexed row * 8 + col in amg8833_read_temperature_array order
+ */
+typedef struct amg8833_drift_table_s
+{
+    uint8_t points;                                                 /**< point count */
+    int16_t thermistor[AMG8833_DRIFT_MAX_POINTS];                   /**< ascending signed thermistor raw data (0.0625C/LSB) */
+    int16_t offset[AMG8833_DRIFT_MAX_POINTS][64];                   /**< pixel offsets in 1/256 raw data */
+} amg8833_drift_table_t;
+
+/**
+ * @brief amg8833 bad pixel definition
+ */
+#define AMG8833_BAD_PIXEL_MAX        8        /**< max bad pixels */
+
+/**
+ * @brief amg8833 bad pixel structure definition
+ * @note  indexes are row * 8 + col in amg8833_read_temperature_array order
+ */
+typedef struct amg8833_bad_pixel_s
+{
+    uint8_t index;               /**< bad pixel index */
+    uint8_t count;               /**< replacement pixel count */
+    uint8_t replace[4];          /**< replacement pixel indexes */
+} amg8833_bad_pixel_t;
+
+/**
+ * @brief amg8833 snapshot frame structure definition
+ */
+typedef struct amg8833_snapshot_frame_s
+{
+    uint32_t sequence;         /**< frame sequence */
+    int16_t raw[8][8];         /**< raw data */
+    float temp[8][8];          /**< temperature */
+} amg8833_snapshot_frame_t;
+
+/**
+ * @brief amg8833 snapshot structure definition
+ * @note  a triple buffer, the writer and the reader own one frame each and swap with the middle frame by an atomic exchange
+ */
+typedef struct amg8833_snapshot_s
+{
+    amg8833_snapshot_frame_t frame[3];        /**< frames */
+    volatile uint8_t state;                   /**< middle frame index and new flag */
+    uint8_t write;                            /**< writer frame index */
+    uint8_t read;                             /**< reader frame index */
+    uint32_t sequence;                        /**< next frame sequence */
+} amg8833_snapshot_t;
+
 /**
  * @brief amg8833 handle structure definition
  */
@@ -143,10 +198,38 @@ typedef struct amg8833_handle_s
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
     void (*receive_callback)(uint8_t type);                                             /**< point to a receive_callback function address */
+    void (*lock)(void);                                                                 /**< point to a lock function address, it can be NULL */
+    void (*unlock)(void);                                                               /**< point to an unlock function address, it can be NULL */
     uint8_t inited;                                                                     /**< inited flag */
     uint8_t iic_addr;                                                                   /**< iic address */
+    uint8_t nuc_enable;                                                                 /**< nuc enable flag */
+    uint16_t nuc_gain[64];                                                              /**< nuc gain table, 16384 is 1.0 */
+    int32_t nuc_offset[64];                                                             /**< nuc offset table in 1/256 raw data */
+    const amg8833_drift_table_t *drift_table;                                           /**< drift table */
+    uint16_t drift_period;                                                              /**< thermistor refresh period in frames */
+    uint16_t drift_count;                                                               /**< frames to the next thermistor refresh */
+    int16_t drift_thermistor;                                                           /**< cached signed thermistor raw data */
+    uint8_t drift_valid;                                                                /**< cached thermistor valid flag */
+    int16_t drift_offset[64];                                                           /**< interpolated pixel offsets in 1/256 raw data */
+    uint64_t bad_mask;                                                                  /**< bad pixel mask */
+    uint8_t bad_count;                                                                  /**< bad pixel count */
+    amg8833_bad_pixel_t bad_pixel[AMG8833_BAD_PIXEL_MAX];                               /**< bad pixel replacements */
+    amg8833_snapshot_t *snapshot;                                                       /**< latest frame snapshot */
 } amg8833_handle_t;
 
+/**
+ * @brief amg8833 frame structure definition
+ */
+typedef struct amg8833_frame_s
+{
+    uint64_t timestamp;          /**< timestamp in ms, set by the caller */
+    uint8_t raw[128];            /**< pixel registers from t01l to t64h */
+    int16_t thermistor;          /**< thermistor raw data */
+    uint8_t status;              /**< status register */
+    uint8_t addr;                /**< iic address */
+    uint8_t interrupt[8];        /**< interrupt table in amg8833_get_interrupt_table order, set by the caller */
+} amg8833_frame_t;
+
 /**
  * @brief amg8833 information structure definition
  */
@@ -238,6 +321,22 @@ typedef struct amg8833_info_s
  */
 #define DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(HANDLE, FUC)  (HANDLE)->receive_callback = FUC
 
+/**
+ * @brief     link lock function
+ * @param[in] HANDLE points to a amg8833 handle structure
+ * @param[in] FUC points to a lock function address
+ * @note      optional, every iic transfer is done between lock and unlock
+ */
+#define DRIVER_AMG8833_LINK_LOCK(HANDLE, FUC)              (HANDLE)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] HANDLE points to a amg8833 handle structure
+ * @param[in] FUC points to an unlock function address
+ * @note      optional, every iic transfer is done between lock and unlock
+ */
+#define DRIVER_AMG8833_LINK_UNLOCK(HANDLE, FUC)            (HANDLE)->unlock = FUC
+
 /**
  * @}
  */
@@ -306,6 +405,27 @@ uint8_t amg8833_get_addr_pin(amg8833_handle_t *handle, amg8833_address_t *addr_p
  */
 uint8_t amg8833_init(amg8833_handle_t *handle);
 
+/**
+ * @brief      resume the chip without a reset when it is already running
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  mode is the desired chip mode
+ * @param[in]  rate is the desired frame rate
+ * @param[out] *warm points to a warm start buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle or warm is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 power on or reset failed
+ *             - 5 set mode or frame rate failed
+ * @note       the chip is running when pctl and fpsc already hold mode and rate and the thermistor holds a conversion,
+ *             then no register is written and no delay is taken,
+ *             otherwise it falls back to the amg8833_init sequence and sets mode and rate,
+ *             only pctl and fpsc are compared, the other registers such as ave and intc are not checked
+ *             and must be written again by the caller
+ */
+uint8_t amg8833_resume(amg8833_handle_t *handle, amg8833_mode_t mode, amg8833_frame_rate_t rate, amg8833_bool_t *warm);
+
 /**
  * @brief     close the chip
  * @param[in] *handle points to a amg8833 handle structure
@@ -353,6 +473,66 @@ uint8_t amg8833_read_temperature(amg8833_handle_t *handle, int16_t *raw, float *
  */
 uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][8], float temp[8][8]);
 
+/**
+ * @brief      read the raw frame
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read frame failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the pixel registers, the thermistor and the status are read in three bursts,
+ *             timestamp and interrupt are not touched
+ */
+uint8_t amg8833_read_frame(amg8833_handle_t *handle, amg8833_frame_t *frame);
+
+/**
+ * @brief      wait until fresh frames are output after the configuration
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  frames is the fresh frame count
+ * @param[in]  poll is the poll period in ms
+ * @param[in]  timeout is the timeout in ms
+ * @param[out] *elapsed points to a time to first frame buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or elapsed is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ *             - 5 param is invalid
+ * @note       every poll reads the thermistor and the first 16 pixels as a fingerprint,
+ *             a frame is fresh when its fingerprint differs from the previous poll,
+ *             use 2 frames in the twice moving average mode and a poll period below the frame period,
+ *             elapsed is the sum of the poll delays up to the first fresh frame, the iic transfer time is not counted,
+ *             on timeout without any fresh frame it is the whole delay time, the last delay is cut at the timeout
+ */
+uint8_t amg8833_wait_frame_ready(amg8833_handle_t *handle, uint8_t frames, uint16_t poll, uint32_t timeout,
+                                 uint32_t *elapsed);
+
+/**
+ * @brief      convert the raw frame to the temperature array
+ * @param[in]  *frame points to a frame structure
+ * @param[out] **raw points to a raw temperature buffer
+ * @param[out] **temp points to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ * @note       the output has the same orientation as amg8833_read_temperature_array,
+ *             the frame holds the registers so no non uniformity correction is applied
+ */
+uint8_t amg8833_frame_convert_to_array(const amg8833_frame_t *frame, int16_t raw[8][8], float temp[8][8]);
+
+/**
+ * @brief     get a raw pixel of the raw frame
+ * @param[in] *frame points to a frame structure
+ * @param[in] index is the pixel index row * 8 + col
+ * @return    raw data
+ * @note      the pixel has the same orientation as amg8833_read_temperature_array,
+ *            frame must not be NULL and index must be below 64
+ */
+int16_t amg8833_frame_get_pixel(const amg8833_frame_t *frame, uint8_t index);
+
 /**
  * @brief      get the interrupt table
  * @param[in]  *handle points to a amg8833 handle structure
@@ -372,6 +552,20 @@ uint8_t amg8833_read_temperature_array(amg8833_handle_t *handle, int16_t raw[8][
  */
 uint8_t amg8833_get_interrupt_table(amg8833_handle_t *handle, uint8_t table[8][1]);
 
+/**
+ * @brief      get the interrupt mask
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *mask points to a interrupt mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get interrupt mask failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       int0 - int7 are read in one burst and bit (row * 8 + col) is pixel [row][col] of
+ *             amg8833_read_temperature_array, so bit 0 is pixel_64 and bit 63 is pixel_01
+ */
+uint8_t amg8833_get_interrupt_mask(amg8833_handle_t *handle, uint64_t *mask);
+
 /**
  * @brief     set the mode
  * @param[in] *handle points to a amg8833 handle structure
@@ -645,6 +839,257 @@ uint8_t amg8833_interrupt_level_convert_to_register(amg8833_handle_t *handle, fl
  */
 uint8_t amg8833_interrupt_level_convert_to_data(amg8833_handle_t *handle, int16_t reg, float *temp);
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup amg8833_nuc_driver amg8833 nuc driver function
+ * @brief    amg8833 nuc driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief     enable or disable the non uniformity correction
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] enable is a bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the correction is applied while decoding in amg8833_read_temperature_array
+ */
+uint8_t amg8833_nuc_set_enable(amg8833_handle_t *handle, amg8833_bool_t enable);
+
+/**
+ * @brief      get the non uniformity correction status
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *enable points to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_nuc_get_enable(amg8833_handle_t *handle, amg8833_bool_t *enable);
+
+/**
+ * @brief     set the non uniformity correction table
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] offset is the offset table in 1/256 raw data
+ * @param[in] gain is the gain table, 16384 is 1.0
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle, offset or gain is NULL
+ * @note      corrected = (raw - offset) * gain
+ */
+uint8_t amg8833_nuc_set_table(amg8833_handle_t *handle, int32_t offset[8][8], uint16_t gain[8][8]);
+
+/**
+ * @brief      get the non uniformity correction table
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] offset is the offset table in 1/256 raw data
+ * @param[out] gain is the gain table, 16384 is 1.0
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle, offset or gain is NULL
+ * @note       none
+ */
+uint8_t amg8833_nuc_get_table(amg8833_handle_t *handle, int32_t offset[8][8], uint16_t gain[8][8]);
+
+/**
+ * @brief      capture the mean of frames
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[in]  frames is the frame count
+ * @param[out] mean is the mean array in 1/256 raw data
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ *             - 2 handle or mean is NULL
+ *             - 3 handle is not initialized
+ *             - 5 frames is invalid
+ * @note       the sensor must look at a uniform scene, the frames are read without correction at the frame rate
+ */
+uint8_t amg8833_nuc_capture(amg8833_handle_t *handle, uint16_t frames, int32_t mean[8][8]);
+
+/**
+ * @brief     calibrate the offset table with one uniform scene
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] mean is the mean array from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or mean is NULL
+ * @note      the gain table is set to 1.0 and the correction is enabled
+ */
+uint8_t amg8833_nuc_calibrate_offset(amg8833_handle_t *handle, int32_t mean[8][8]);
+
+/**
+ * @brief     calibrate the offset and gain tables with two uniform scenes
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] low is the mean array of the cold scene from amg8833_nuc_capture
+ * @param[in] high is the mean array of the hot scene from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle, low or high is NULL
+ *            - 5 scenes are invalid
+ * @note      every pixel is mapped to the frame mean at both scenes and the correction is enabled
+ */
+uint8_t amg8833_nuc_calibrate_two_point(amg8833_handle_t *handle, int32_t low[8][8], int32_t high[8][8]);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup amg8833_drift_driver amg8833 drift driver function
+ * @brief    amg8833 drift driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief     set the drift table
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] *table points to a drift table, NULL disables the compensation
+ * @param[in] period is the thermistor refresh period in frames
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 5 table or period is invalid
+ * @note      the table is not copied, amg8833_read_temperature_array reads the thermistor only when
+ *            the cached value is older than period frames and subtracts the interpolated pixel offsets while decoding
+ */
+uint8_t amg8833_drift_set_table(amg8833_handle_t *handle, const amg8833_drift_table_t *table, uint16_t period);
+
+/**
+ * @brief      get the cached thermistor
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *raw points to a signed thermistor raw data buffer
+ * @param[out] *temp points to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 4 no cached thermistor
+ * @note       none
+ */
+uint8_t amg8833_drift_get_thermistor(amg8833_handle_t *handle, int16_t *raw, float *temp);
+
+/**
+ * @brief     clear a drift table
+ * @param[in] *table points to a drift table
+ * @return    status code
+ *            - 0 success
+ *            - 2 table is NULL
+ * @note      none
+ */
+uint8_t amg8833_drift_table_clear(amg8833_drift_table_t *table);
+
+/**
+ * @brief     add a point to a drift table
+ * @param[in] *table points to a drift table
+ * @param[in] thermistor is the signed thermistor raw data of the point
+ * @param[in] mean is the mean array at the point from amg8833_nuc_capture
+ * @param[in] base is the mean array of the same scene at the reference ambient from amg8833_nuc_capture
+ * @return    status code
+ *            - 0 success
+ *            - 2 table, mean or base is NULL
+ *            - 4 table is full
+ *            - 5 thermistor already exists
+ * @note      points are kept in thermistor order and offsets are limited to the int16 range
+ */
+uint8_t amg8833_drift_table_add(amg8833_drift_table_t *table, int16_t thermistor, int32_t mean[8][8], int32_t base[8][8]);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup amg8833_bad_pixel_driver amg8833 bad pixel driver function
+ * @brief    amg8833 bad pixel driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief     set the bad pixel mask
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] mask is the bad pixel mask, bit (row * 8 + col)
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 5 too many bad pixels
+ * @note      the replacement indexes are computed once here, amg8833_read_temperature_array then replaces
+ *            every bad pixel with the mean of its good 4 neighbours, or of its good diagonal neighbours
+ */
+uint8_t amg8833_set_bad_pixel_mask(amg8833_handle_t *handle, uint64_t mask);
+
+/**
+ * @brief      get the bad pixel mask
+ * @param[in]  *handle points to a amg8833 handle structure
+ * @param[out] *mask points to a bad pixel mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t amg8833_get_bad_pixel_mask(amg8833_handle_t *handle, uint64_t *mask);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup amg8833_thread_driver amg8833 thread driver function
+ * @brief    amg8833 thread driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the snapshot
+ * @param[in] *snapshot points to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 snapshot is NULL
+ * @note      none
+ */
+uint8_t amg8833_snapshot_init(amg8833_snapshot_t *snapshot);
+
+/**
+ * @brief     set the snapshot
+ * @param[in] *handle points to a amg8833 handle structure
+ * @param[in] *snapshot points to a snapshot structure, NULL disables the snapshot
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      every amg8833_read_temperature_array publishes its frame to the snapshot
+ */
+uint8_t amg8833_set_snapshot(amg8833_handle_t *handle, amg8833_snapshot_t *snapshot);
+
+/**
+ * @brief     publish a frame to the snapshot
+ * @param[in] *snapshot points to a snapshot structure
+ * @param[in] **raw points to a raw data buffer
+ * @param[in] **temp points to a temperature buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 snapshot, raw or temp is NULL
+ * @note      only one writer thread, it never waits for the reader
+ */
+uint8_t amg8833_snapshot_publish(amg8833_snapshot_t *snapshot, int16_t raw[8][8], float temp[8][8]);
+
+/**
+ * @brief      acquire the latest frame
+ * @param[in]  *snapshot points to a snapshot structure
+ * @param[out] **frame points to a frame pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new frame
+ *             - 2 snapshot or frame is NULL
+ * @note       only one reader thread, the frame stays valid and untouched until the next acquire,
+ *             with no new frame it points to the previous one whose sequence is 0 before the first frame
+ */
+uint8_t amg8833_snapshot_acquire(amg8833_snapshot_t *snapshot, const amg8833_snapshot_frame_t **frame);
+
 /**
  * @}
  */
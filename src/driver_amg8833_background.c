@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_background.c
+ * @brief     driver amg8833 background source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_background.h"
+
+/**
+ * @brief     initialize the background model
+ * @param[in] *background points to a background structure
+ * @param[in] shift is the learning rate shift, the rate is 1 / 2^shift
+ * @param[in] k is the q4 foreground threshold in standard deviations
+ * @param[in] min_delta is the min foreground difference in raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ *            - 5 param is invalid
+ * @note      1 <= shift <= 15, foreground pixels are never learned and the variance floor is 1 raw data
+ */
+uint8_t amg8833_background_init(amg8833_background_t *background, uint8_t shift, uint8_t k, uint16_t min_delta)
+{
+    if (background == NULL)                                         /* check background */
+    {
+        return 2;                                                   /* return error */
+    }
+    if ((shift == 0) || (shift > 15) || (min_delta > 2047))         /* check param */
+    {
+        return 5;                                                   /* return error */
+    }
+    
+    memset(background, 0, sizeof(amg8833_background_t));            /* clear the model */
+    background->shift = shift;                                      /* set shift */
+    background->absorb = 0;                                         /* never learn foreground */
+    background->k = k;                                              /* set k */
+    background->min_delta = min_delta;                              /* set min delta */
+    background->min_var = 256;                                      /* 1 raw data squared */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     set the foreground absorb rate
+ * @param[in] *background points to a background structure
+ * @param[in] absorb is the foreground learning rate shift, 0 means never
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ *            - 5 absorb is invalid
+ * @note      a slow absorb rate lets objects that stopped moving fade into the background
+ */
+uint8_t amg8833_background_set_absorb(amg8833_background_t *background, uint8_t absorb)
+{
+    if (background == NULL)                  /* check background */
+    {
+        return 2;                            /* return error */
+    }
+    if (absorb > 15)                         /* check absorb */
+    {
+        return 5;                            /* return error */
+    }
+    
+    background->absorb = absorb;             /* set absorb */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief     reset the background model
+ * @param[in] *background points to a background structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ * @note      the next frame seeds the model and the learning rate starts fast
+ */
+uint8_t amg8833_background_reset(amg8833_background_t *background)
+{
+    if (background == NULL)                  /* check background */
+    {
+        return 2;                            /* return error */
+    }
+    
+    background->frames = 0;                  /* clear the frames */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief      update the model and extract the foreground
+ * @param[in]  *background points to a background structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *mask points to a foreground mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 background, raw or mask is NULL
+ * @note       a pixel is foreground when it differs from the mean by more than min_delta and
+ *             k standard deviations, the update is O(64) with integer math
+ */
+uint8_t amg8833_background_update(amg8833_background_t *background, int16_t raw[8][8], uint64_t *mask)
+{
+    const int16_t *z;
+    uint64_t m;
+    int32_t k2;
+    int32_t delta;
+    int32_t e;
+    int32_t d;
+    int32_t d2;
+    int32_t fg;
+    uint8_t shift;
+    uint8_t rate;
+    uint8_t i;
+    
+    if ((background == NULL) || (raw == NULL) || (mask == NULL))                         /* check param */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    z = &raw[0][0];                                                                      /* flat input */
+    if (background->frames == 0)                                                         /* seed the model */
+    {
+        for (i = 0; i < 64; i++)                                                         /* run 64 times */
+        {
+            background->mean[i] = (int32_t)z[i] * 256;                                   /* set the mean */
+            background->var[i] = background->min_var;                                    /* set the variance */
+        }
+        background->frames = 1;                                                          /* first frame */
+        *mask = 0;                                                                       /* no foreground */
+        
+        return 0;                                                                        /* success return 0 */
+    }
+    
+    shift = 1;                                                                           /* fast start */
+    while ((shift < background->shift) &&                                                /* below the model shift */
+           (((uint32_t)1 << shift) <= background->frames))                               /* and the frame count */
+    {
+        shift++;                                                                         /* cumulative average */
+    }
+    k2 = (int32_t)background->k * background->k;                                         /* q8 k squared */
+    delta = (int32_t)background->min_delta * 16;                                         /* q4 min delta */
+    m = 0;                                                                               /* init 0 */
+    for (i = 0; i < 64; i++)                                                             /* run 64 times */
+    {
+        e = (int32_t)z[i] * 256 - background->mean[i];                                   /* q8 difference */
+        d = e / 16;                                                                      /* q4 difference */
+        d = (d > 32767) ? 32767 : ((d < -32767) ? -32767 : d);                           /* keep d2 in range */
+        d2 = d * d;                                                                      /* q8 squared difference */
+        fg = (d2 > (int32_t)(((int64_t)background->var[i] * k2) >> 8)) &&
+             (d2 > delta * delta);                                                       /* foreground test */
+        m |= (uint64_t)fg << i;                                                          /* set the mask bit */
+        rate = (fg != 0) ? background->absorb : shift;                                   /* learning rate */
+        if (rate != 0)                                                                   /* learn the pixel */
+        {
+            background->mean[i] += e >> rate;                                            /* update the mean */
+            background->var[i] += (d2 - background->var[i]) >> rate;                     /* update the variance */
+            if (background->var[i] < background->min_var)                                /* check the variance floor */
+            {
+                background->var[i] = background->min_var;                                /* variance floor */
+            }
+        }
+    }
+    if (background->frames < 0xFFFFFFFFU)                                                /* check the frames */
+    {
+        background->frames++;                                                            /* frames++ */
+    }
+    *mask = m;                                                                           /* set the mask */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the background temperature
+ * @param[in]  *background points to a background structure
+ * @param[out] temp is the background temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 2 background or temp is NULL
+ * @note       none
+ */
+uint8_t amg8833_background_get_mean(amg8833_background_t *background, float temp[8][8])
+{
+    uint8_t i;
+    
+    if ((background == NULL) || (temp == NULL))                                   /* check param */
+    {
+        return 2;                                                                 /* return error */
+    }
+    
+    for (i = 0; i < 64; i++)                                                      /* run 64 times */
+    {
+        temp[i / 8][i % 8] = (float)background->mean[i] * (0.25f / 256.0f);       /* q8 mean to celsius */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_background.h
+ * @brief     driver amg8833 background header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_BACKGROUND_H
+#define DRIVER_AMG8833_BACKGROUND_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_background_driver amg8833 background driver function
+ * @brief    amg8833 background driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 background definition
+ * @note  bit (row * 8 + col) of a mask is pixel raw[row][col] of amg8833_read_temperature_array
+ */
+#define AMG8833_BACKGROUND_MASK_BIT(row, col)        ((uint64_t)1 << ((row) * 8 + (col)))        /**< mask bit of a pixel */
+
+/**
+ * @brief amg8833 background structure definition
+ */
+typedef struct amg8833_background_s
+{
+    uint32_t frames;               /**< learned frame count */
+    uint8_t shift;                 /**< background learning rate is 1 / 2^shift */
+    uint8_t absorb;                /**< foreground learning rate is 1 / 2^absorb, 0 means never */
+    uint8_t k;                     /**< q4 foreground threshold in standard deviations */
+    uint16_t min_delta;            /**< min foreground difference in raw data */
+    int32_t min_var;               /**< q8 variance floor in raw data squared */
+    int32_t mean[64];              /**< q8 mean */
+    int32_t var[64];               /**< q8 variance */
+} amg8833_background_t;
+
+/**
+ * @brief     initialize the background model
+ * @param[in] *background points to a background structure
+ * @param[in] shift is the learning rate shift, the rate is 1 / 2^shift
+ * @param[in] k is the q4 foreground threshold in standard deviations
+ * @param[in] min_delta is the min foreground difference in raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ *            - 5 param is invalid
+ * @note      1 <= shift <= 15, foreground pixels are never learned and the variance floor is 1 raw data
+ */
+uint8_t amg8833_background_init(amg8833_background_t *background, uint8_t shift, uint8_t k, uint16_t min_delta);
+
+/**
+ * @brief     set the foreground absorb rate
+ * @param[in] *background points to a background structure
+ * @param[in] absorb is the foreground learning rate shift, 0 means never
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ *            - 5 absorb is invalid
+ * @note      a slow absorb rate lets objects that stopped moving fade into the background
+ */
+uint8_t amg8833_background_set_absorb(amg8833_background_t *background, uint8_t absorb);
+
+/**
+ * @brief     reset the background model
+ * @param[in] *background points to a background structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 background is NULL
+ * @note      the next frame seeds the model and the learning rate starts fast
+ */
+uint8_t amg8833_background_reset(amg8833_background_t *background);
+
+/**
+ * @brief      update the model and extract the foreground
+ * @param[in]  *background points to a background structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *mask points to a foreground mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 background, raw or mask is NULL
+ * @note       a pixel is foreground when it differs from the mean by more than min_delta and
+ *             k standard deviations, the update is O(64) with integer math
+ */
+uint8_t amg8833_background_update(amg8833_background_t *background, int16_t raw[8][8], uint64_t *mask);
+
+/**
+ * @brief      get the background temperature
+ * @param[in]  *background points to a background structure
+ * @param[out] temp is the background temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 2 background or temp is NULL
+ * @note       none
+ */
+uint8_t amg8833_background_get_mean(amg8833_background_t *background, float temp[8][8]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_bitboard.c
+ * @brief     driver amg8833 bitboard source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_bitboard.h"
+
+/**
+ * @brief     count the set pixels
+ * @param[in] mask is the bitboard
+ * @return    set pixel count
+ * @note      none
+ */
+uint8_t amg8833_bitboard_popcount(uint64_t mask)
+{
+    mask = mask - ((mask >> 1) & 0x5555555555555555ULL);                                 /* 2 bits sums */
+    mask = (mask & 0x3333333333333333ULL) + ((mask >> 2) & 0x3333333333333333ULL);       /* 4 bits sums */
+    mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0FULL;                                 /* 8 bits sums */
+    
+    return (uint8_t)((mask * 0x0101010101010101ULL) >> 56);                              /* add all bytes */
+}
+
+/**
+ * @brief     dilate a bitboard by one pixel
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    dilated bitboard
+ * @note      pixels never wrap around the border
+ */
+uint64_t amg8833_bitboard_dilate(uint64_t mask, amg8833_bitboard_connectivity_t connectivity)
+{
+    uint64_t h;
+    
+    h = mask | ((mask << 1) & ~AMG8833_BITBOARD_COL_0) | ((mask >> 1) & ~AMG8833_BITBOARD_COL_7);        /* grow along the row */
+    if (connectivity == AMG8833_BITBOARD_CONNECTIVITY_8)                                                 /* 8 connectivity */
+    {
+        return h | (h << 8) | (h >> 8);                                                                  /* grow the row span up and down */
+    }
+    else
+    {
+        return h | (mask << 8) | (mask >> 8);                                                            /* grow up and down */
+    }
+}
+
+/**
+ * @brief     erode a bitboard by one pixel
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    eroded bitboard
+ * @note      pixels outside the frame count as set, so a blob touching the border keeps its border pixels
+ */
+uint64_t amg8833_bitboard_erode(uint64_t mask, amg8833_bitboard_connectivity_t connectivity)
+{
+    return ~amg8833_bitboard_dilate(~mask, connectivity);        /* erosion is the dual of dilation */
+}
+
+/**
+ * @brief     get the edge of a bitboard
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    set pixels with at least one clear neighbour
+ * @note      none
+ */
+uint64_t amg8833_bitboard_edge(uint64_t mask, amg8833_bitboard_connectivity_t connectivity)
+{
+    return mask & ~amg8833_bitboard_erode(mask, connectivity);        /* remove the inner pixels */
+}
+
+/**
+ * @brief      diff a bitboard against the previous one
+ * @param[in]  mask is the current bitboard
+ * @param[in]  prev is the previous bitboard
+ * @param[out] *rise points to a new pixels buffer, it can be NULL
+ * @param[out] *fall points to a cleared pixels buffer, it can be NULL
+ * @return     changed pixels
+ * @note       none
+ */
+uint64_t amg8833_bitboard_diff(uint64_t mask, uint64_t prev, uint64_t *rise, uint64_t *fall)
+{
+    if (rise != NULL)                    /* check rise */
+    {
+        *rise = mask & ~prev;            /* new pixels */
+    }
+    if (fall != NULL)                    /* check fall */
+    {
+        *fall = prev & ~mask;            /* cleared pixels */
+    }
+    
+    return mask ^ prev;                  /* changed pixels */
+}
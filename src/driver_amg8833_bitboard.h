@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_bitboard.h
+ * @brief     driver amg8833 bitboard header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_BITBOARD_H
+#define DRIVER_AMG8833_BITBOARD_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_bitboard_driver amg8833 bitboard driver function
+ * @brief    amg8833 bitboard driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 bitboard definition
+ * @note  a bitboard is a uint64_t mask, bit (row * 8 + col) is pixel [row][col] of amg8833_read_temperature_array,
+ *        the same order as amg8833_get_interrupt_mask
+ */
+#define AMG8833_BITBOARD_BIT(row, col)        ((uint64_t)1 << ((row) * 8 + (col)))        /**< bit of a pixel */
+#define AMG8833_BITBOARD_COL_0                0x0101010101010101ULL                       /**< col 0 pixels */
+#define AMG8833_BITBOARD_COL_7                0x8080808080808080ULL                       /**< col 7 pixels */
+#define AMG8833_BITBOARD_ROW_0                0x00000000000000FFULL                       /**< row 0 pixels */
+#define AMG8833_BITBOARD_ROW_7                0xFF00000000000000ULL                       /**< row 7 pixels */
+
+/**
+ * @brief amg8833 bitboard connectivity enumeration definition
+ */
+typedef enum
+{
+    AMG8833_BITBOARD_CONNECTIVITY_4 = 4,        /**< edge neighbours */
+    AMG8833_BITBOARD_CONNECTIVITY_8 = 8,        /**< edge and corner neighbours */
+} amg8833_bitboard_connectivity_t;
+
+/**
+ * @brief     count the set pixels
+ * @param[in] mask is the bitboard
+ * @return    set pixel count
+ * @note      none
+ */
+uint8_t amg8833_bitboard_popcount(uint64_t mask);
+
+/**
+ * @brief     dilate a bitboard by one pixel
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    dilated bitboard
+ * @note      pixels never wrap around the border
+ */
+uint64_t amg8833_bitboard_dilate(uint64_t mask, amg8833_bitboard_connectivity_t connectivity);
+
+/**
+ * @brief     erode a bitboard by one pixel
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    eroded bitboard
+ * @note      pixels outside the frame count as set, so a blob touching the border keeps its border pixels
+ */
+uint64_t amg8833_bitboard_erode(uint64_t mask, amg8833_bitboard_connectivity_t connectivity);
+
+/**
+ * @brief     get the edge of a bitboard
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @return    set pixels with at least one clear neighbour
+ * @note      none
+ */
+uint64_t amg8833_bitboard_edge(uint64_t mask, amg8833_bitboard_connectivity_t connectivity);
+
+/**
+ * @brief      diff a bitboard against the previous one
+ * @param[in]  mask is the current bitboard
+ * @param[in]  prev is the previous bitboard
+ * @param[out] *rise points to a new pixels buffer, it can be NULL
+ * @param[out] *fall points to a cleared pixels buffer, it can be NULL
+ * @return     changed pixels
+ * @note       none
+ */
+uint64_t amg8833_bitboard_diff(uint64_t mask, uint64_t prev, uint64_t *rise, uint64_t *fall);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_blob.c
+ * @brief     driver amg8833 blob source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_blob.h"
+#include "driver_amg8833_bitboard.h"
+
+/**
+ * @brief blob bitboard definition
+ */
+#define BLOB_COL_BIT_0       0xAAAAAAAAAAAAAAAAULL        /**< cols with index bit 0 */
+#define BLOB_COL_BIT_1       0xCCCCCCCCCCCCCCCCULL        /**< cols with index bit 1 */
+#define BLOB_COL_BIT_2       0xF0F0F0F0F0F0F0F0ULL        /**< cols with index bit 2 */
+#define BLOB_ROW_BIT_0       0xFF00FF00FF00FF00ULL        /**< rows with index bit 0 */
+#define BLOB_ROW_BIT_1       0xFFFF0000FFFF0000ULL        /**< rows with index bit 1 */
+#define BLOB_ROW_BIT_2       0xFFFFFFFF00000000ULL        /**< rows with index bit 2 */
+
+/**
+ * @brief      get the lowest and highest set bit of a byte
+ * @param[in]  v is the non zero byte
+ * @param[out] *low points to a lowest index buffer
+ * @param[out] *high points to a highest index buffer
+ * @note       none
+ */
+static void a_blob_range(uint8_t v, uint8_t *low, uint8_t *high)
+{
+    uint8_t s;
+    
+    *low = amg8833_bitboard_popcount((uint8_t)((v & (uint8_t)(0U - v)) - 1U));        /* bits below the lowest bit */
+    s = (uint8_t)(v | (v >> 1));                                                      /* smear down */
+    s = (uint8_t)(s | (s >> 2));                                                      /* smear down */
+    s = (uint8_t)(s | (s >> 4));                                                      /* smear down */
+    *high = (uint8_t)(amg8833_bitboard_popcount(s) - 1);                              /* bits up to the highest bit */
+}
+
+/**
+ * @brief      convert an interrupt table to a mask
+ * @param[in]  table is the interrupt table from amg8833_get_interrupt_table
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 table or mask is NULL
+ * @note       bit (row * 8 + col) is (table[row][0] >> (7 - col)) & 1
+ */
+uint8_t amg8833_blob_mask_from_table(uint8_t table[8][1], uint64_t *mask)
+{
+    uint64_t x;
+    uint8_t i;
+    
+    if ((table == NULL) || (mask == NULL))                                                 /* check param */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    x = 0;                                                                                 /* init 0 */
+    for (i = 0; i < 8; i++)                                                                /* run 8 times */
+    {
+        x |= (uint64_t)table[i][0] << (i * 8);                                             /* row i */
+    }
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);           /* swap bits */
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);           /* swap bit pairs */
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);           /* swap nibbles */
+    *mask = x;                                                                             /* set the mask */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      threshold a raw array to a mask
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw or mask is NULL
+ * @note       a bit is set when the pixel is above threshold
+ */
+uint8_t amg8833_blob_mask_from_raw(int16_t raw[8][8], int16_t threshold, uint64_t *mask)
+{
+    const int16_t *z;
+    uint64_t x;
+    uint8_t i;
+    
+    if ((raw == NULL) || (mask == NULL))                                 /* check param */
+    {
+        return 2;                                                        /* return error */
+    }
+    
+    z = &raw[0][0];                                                      /* flat input */
+    x = 0;                                                               /* init 0 */
+    for (i = 0; i < 64; i++)                                             /* run 64 times */
+    {
+        x |= (uint64_t)(z[i] > threshold) << i;                          /* set the bit */
+    }
+    *mask = x;                                                           /* set the mask */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      label the connected components of a mask
+ * @param[in]  mask is the mask
+ * @param[in]  connectivity is the pixel connectivity
+ * @param[in]  raw is the raw array for the peaks, it can be NULL
+ * @param[out] *blob points to a blob array
+ * @param[in]  max is the blob array size
+ * @param[out] *count points to a blob count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 blob or count is NULL
+ *             - 4 blob array is full
+ *             - 5 connectivity is invalid
+ * @note       blobs are found by shift and mask flood fill in the order of their lowest bit,
+ *             if raw is NULL the peak is 0 at the lowest bit of the blob
+ */
+uint8_t amg8833_blob_label(uint64_t mask, amg8833_blob_connectivity_t connectivity, int16_t raw[8][8],
+                           amg8833_blob_t *blob, uint8_t max, uint8_t *count)
+{
+    const int16_t *z;
+    uint64_t f;
+    uint64_t prev;
+    uint64_t t;
+    uint32_t sum_row;
+    uint32_t sum_col;
+    int16_t best;
+    int16_t v;
+    uint8_t take;
+    uint8_t index;
+    uint8_t n;
+    uint8_t i;
+    
+    if ((blob == NULL) || (count == NULL))                                                    /* check param */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((connectivity != AMG8833_BLOB_CONNECTIVITY_4) &&
+        (connectivity != AMG8833_BLOB_CONNECTIVITY_8))                                        /* check connectivity */
+    {
+        return 5;                                                                             /* return error */
+    }
+    
+    n = 0;                                                                                    /* init 0 */
+    while (mask != 0)                                                                         /* until all pixels used */
+    {
+        if (n >= max)                                                                         /* check the array */
+        {
+            *count = n;                                                                       /* set the count */
+            
+            return 4;                                                                         /* return error */
+        }
+        f = mask & (0ULL - mask);                                                             /* seed at the lowest bit */
+        do
+        {
+            prev = f;                                                                         /* save */
+            f = amg8833_bitboard_dilate(f, (amg8833_bitboard_connectivity_t)connectivity);    /* grow the blob */
+            f &= mask;                                                                        /* flood fill inside the mask */
+        } while (f != prev);                                                                  /* until no pixel is added */
+        mask &= ~f;                                                                           /* remove the blob */
+        blob[n].mask = f;                                                                     /* set the mask */
+        blob[n].area = amg8833_bitboard_popcount(f);                                          /* set the area */
+        sum_col = amg8833_bitboard_popcount(f & BLOB_COL_BIT_0);                              /* col bit 0 */
+        sum_col += 2U * amg8833_bitboard_popcount(f & BLOB_COL_BIT_1);                        /* col bit 1 */
+        sum_col += 4U * amg8833_bitboard_popcount(f & BLOB_COL_BIT_2);                        /* col bit 2 */
+        sum_row = amg8833_bitboard_popcount(f & BLOB_ROW_BIT_0);                              /* row bit 0 */
+        sum_row += 2U * amg8833_bitboard_popcount(f & BLOB_ROW_BIT_1);                        /* row bit 1 */
+        sum_row += 4U * amg8833_bitboard_popcount(f & BLOB_ROW_BIT_2);                        /* row bit 2 */
+        blob[n].row = (float)sum_row / (float)blob[n].area;                                   /* set the centroid row */
+        blob[n].col = (float)sum_col / (float)blob[n].area;                                   /* set the centroid col */
+        t = f | (f >> 32);                                                                    /* fold the rows */
+        t |= t >> 16;                                                                         /* fold the rows */
+        t |= t >> 8;                                                                          /* occupied cols */
+        a_blob_range((uint8_t)t, &blob[n].col_min, &blob[n].col_max);                         /* set the col range */
+        t = f | (f >> 4);                                                                     /* fold the cols */
+        t |= t >> 2;                                                                          /* fold the cols */
+        t |= t >> 1;                                                                          /* occupied rows in col 0 */
+        t = ((t & AMG8833_BITBOARD_COL_0) * 0x0102040810204080ULL) >> 56;                     /* gather col 0 to a byte */
+        a_blob_range((uint8_t)t, &blob[n].row_min, &blob[n].row_max);                         /* set the row range */
+        index = amg8833_bitboard_popcount((f & (0ULL - f)) - 1);                              /* lowest bit */
+        best = 0;                                                                             /* init 0 */
+        if (raw != NULL)                                                                      /* check the raw data */
+        {
+            z = &raw[0][0];                                                                   /* flat frame */
+            best = z[index];                                                                  /* init the peak */
+            for (i = 0; i < 64; i++)                                                          /* run 64 times */
+            {
+                v = z[i];                                                                     /* get the pixel */
+                take = (uint8_t)(((f >> i) & 1U) & (uint8_t)(v > best));                      /* select without a branch */
+                best = take ? v : best;                                                       /* update the peak */
+                index = take ? i : index;                                                     /* update the index */
+            }
+        }
+        blob[n].peak = best;                                                                  /* set the peak */
+        blob[n].peak_row = (uint8_t)(index / 8);                                              /* set the peak row */
+        blob[n].peak_col = (uint8_t)(index % 8);                                              /* set the peak col */
+        n++;                                                                                  /* next blob */
+    }
+    *count = n;                                                                               /* set the count */
+    
+    return 0;                                                                                 /* success return 0 */
+}
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_blob.h
+ * @brief     driver amg8833 blob header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_BLOB_H
+#define DRIVER_AMG8833_BLOB_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_blob_driver amg8833 blob driver function
+ * @brief    amg8833 blob driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 blob definition
+ * @note  a mask is a uint64_t bitboard, bit (row * 8 + col) is pixel [row][col] of amg8833_read_temperature_array
+ */
+#define AMG8833_BLOB_MAX        32        /**< max blobs of an 8x8 mask */
+
+/**
+ * @brief amg8833 blob connectivity enumeration definition
+ */
+typedef enum
+{
+    AMG8833_BLOB_CONNECTIVITY_4 = 4,        /**< edge neighbours */
+    AMG8833_BLOB_CONNECTIVITY_8 = 8,        /**< edge and corner neighbours */
+} amg8833_blob_connectivity_t;
+
+/**
+ * @brief amg8833 blob structure definition
+ */
+typedef struct amg8833_blob_s
+{
+    uint64_t mask;              /**< blob pixels */
+    uint8_t area;               /**< pixel count */
+    uint8_t row_min;            /**< bounding box first row */
+    uint8_t row_max;            /**< bounding box last row */
+    uint8_t col_min;            /**< bounding box first col */
+    uint8_t col_max;            /**< bounding box last col */
+    uint8_t peak_row;           /**< peak pixel row */
+    uint8_t peak_col;           /**< peak pixel col */
+    int16_t peak;               /**< peak raw data */
+    float row;                  /**< centroid row */
+    float col;                  /**< centroid col */
+} amg8833_blob_t;
+
+/**
+ * @brief      convert an interrupt table to a mask
+ * @param[in]  table is the interrupt table from amg8833_get_interrupt_table
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 table or mask is NULL
+ * @note       bit (row * 8 + col) is (table[row][0] >> (7 - col)) & 1
+ */
+uint8_t amg8833_blob_mask_from_table(uint8_t table[8][1], uint64_t *mask);
+
+/**
+ * @brief      threshold a raw array to a mask
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *mask points to a mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw or mask is NULL
+ * @note       a bit is set when the pixel is above threshold
+ */
+uint8_t amg8833_blob_mask_from_raw(int16_t raw[8][8], int16_t threshold, uint64_t *mask);
+
+/**
+ * @brief      label the connected components of a mask
+ * @param[in]  mask is the mask
+ * @param[in]  connectivity is the pixel connectivity
+ * @param[in]  raw is the raw array for the peaks, it can be NULL
+ * @param[out] *blob points to a blob array
+ * @param[in]  max is the blob array size
+ * @param[out] *count points to a blob count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 blob or count is NULL
+ *             - 4 blob array is full
+ *             - 5 connectivity is invalid
+ * @note       blobs are found by shift and mask flood fill in the order of their lowest bit,
+ *             if raw is NULL the peak is 0 at the lowest bit of the blob
+ */
+uint8_t amg8833_blob_label(uint64_t mask, amg8833_blob_connectivity_t connectivity, int16_t raw[8][8],
+                           amg8833_blob_t *blob, uint8_t max, uint8_t *count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_defect.c
+ * @brief     driver amg8833 defect source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_defect.h"
+
+/**
+ * @brief defect saturation definition
+ */
+#define DEFECT_RAW_MAX        2047         /**< max 12 bits raw data */
+#define DEFECT_RAW_MIN        -2048        /**< min 12 bits raw data */
+
+/**
+ * @brief     initialize the defect detector
+ * @param[in] *defect points to a defect structure
+ * @param[in] window is the window size in frames
+ * @param[in] diverge is the divergence threshold raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 defect is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_defect_init(amg8833_defect_t *defect, uint16_t window, int16_t diverge)
+{
+    if (defect == NULL)                                      /* check defect */
+    {
+        return 2;                                            /* return error */
+    }
+    if ((window < 2) || (diverge <= 0))                      /* check param */
+    {
+        return 5;                                            /* return error */
+    }
+    
+    memset(defect, 0, sizeof(amg8833_defect_t));             /* clear the detector */
+    defect->window = window;                                 /* set the window */
+    defect->diverge = diverge;                               /* set the threshold */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief      add a frame to the defect detector
+ * @param[in]  *defect points to a defect structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *mask points to a bad pixel mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 defect, raw or mask is NULL
+ *             - 4 window is not complete
+ * @note       at the end of each window a pixel is marked bad when it never changed while the frame was changing,
+ *             when it was saturated in half of the frames, or when it differed from each of its 8 neighbours
+ *             by more than the divergence threshold in 90% of the frames,
+ *             the mask is sticky and is meant for amg8833_set_bad_pixel_mask
+ */
+uint8_t amg8833_defect_update(amg8833_defect_t *defect, int16_t raw[8][8], uint64_t *mask)
+{
+    int32_t d;
+    int32_t e;
+    uint16_t frames;
+    int8_t i;
+    int8_t j;
+    uint8_t bad;
+    int8_t r;
+    int8_t c;
+    uint8_t k;
+    
+    if ((defect == NULL) || (raw == NULL) || (mask == NULL))                                       /* check param */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    
+    for (r = 0; r < 8; r++)                                                                        /* 8 rows */
+    {
+        for (c = 0; c < 8; c++)                                                                    /* 8 cols */
+        {
+            k = (uint8_t)(r * 8 + c);                                                              /* pixel index */
+            
+            if ((defect->seeded != 0) && (raw[r][c] != defect->last[k]))                           /* stuck check, the pixel changed */
+            {
+                defect->changed[k]++;                                                              /* count the pixel changes */
+                defect->changes++;                                                                 /* count the frame changes */
+            }
+            defect->last[k] = raw[r][c];                                                           /* save the last data */
+            
+            if ((raw[r][c] >= DEFECT_RAW_MAX) || (raw[r][c] <= DEFECT_RAW_MIN))                    /* saturated */
+            {
+                defect->saturated[k]++;                                                            /* count the saturated frames */
+            }
+            
+            d = INT32_MAX;                                                                         /* init the smallest neighbour difference */
+            for (i = -1; i <= 1; i++)                                                              /* 3 rows */
+            {
+                for (j = -1; j <= 1; j++)                                                          /* 3 cols */
+                {
+                    if ((i == 0) && (j == 0))                                                      /* skip the pixel itself */
+                    {
+                        continue;                                                                  /* skip */
+                    }
+                    if (((r + i) < 0) || ((r + i) > 7) || ((c + j) < 0) || ((c + j) > 7))          /* outside the frame */
+                    {
+                        continue;                                                                  /* skip */
+                    }
+                    e = (int32_t)raw[r][c] - raw[r + i][c + j];                                    /* neighbour difference */
+                    e = (e < 0) ? -e : e;                                                          /* absolute value */
+                    d = (e < d) ? e : d;                                                           /* keep the smallest */
+                }
+            }
+            if (d > defect->diverge)                                                               /* diverged from all of the 8 neighbours */
+            {
+                defect->diverged[k]++;                                                             /* count the diverged frames */
+            }
+        }
+    }
+    defect->seeded = 1;                                                                            /* seeded */
+    defect->frames++;                                                                              /* count */
+    if (defect->frames < defect->window)                                                           /* check the window */
+    {
+        *mask = defect->mask;                                                                      /* current mask */
+        
+        return 4;                                                                                  /* return not complete */
+    }
+    
+    frames = defect->frames;                                                                       /* close the window */
+    for (k = 0; k < 64; k++)                                                                       /* check all pixels */
+    {
+        bad = 0;                                                                                   /* init 0 */
+        if ((defect->changed[k] == 0) && (defect->changes >= (uint32_t)frames * 16))               /* never changed while the frame was changing */
+        {
+            bad = 1;                                                                               /* stuck */
+        }
+        if (defect->saturated[k] * 2U >= frames)                                                   /* saturated in half of the frames */
+        {
+            bad = 1;                                                                               /* saturated */
+        }
+        if (defect->diverged[k] * 10U >= frames * 9U)                                              /* diverged in 90% of the frames */
+        {
+            bad = 1;                                                                               /* diverged */
+        }
+        defect->mask |= (uint64_t)bad << k;                                                        /* set the sticky bad bit */
+    }
+    defect->frames = 0;                                                                            /* new window */
+    defect->changes = 0;                                                                           /* clear */
+    memset(defect->changed, 0, sizeof(defect->changed));                                           /* clear */
+    memset(defect->saturated, 0, sizeof(defect->saturated));                                       /* clear */
+    memset(defect->diverged, 0, sizeof(defect->diverged));                                         /* clear */
+    *mask = defect->mask;                                                                          /* set the mask */
+    
+    return 0;                                                                                      /* success return 0 */
+}
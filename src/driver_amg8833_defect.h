@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_defect.h
+ * @brief     driver amg8833 defect header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_DEFECT_H
+#define DRIVER_AMG8833_DEFECT_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_defect_driver amg8833 defect driver function
+ * @brief    amg8833 defect driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 defect structure definition
+ */
+typedef struct amg8833_defect_s
+{
+    uint16_t window;              /**< window size in frames */
+    uint16_t frames;              /**< frames in the current window */
+    int16_t diverge;              /**< divergence threshold raw data */
+    uint8_t seeded;               /**< seeded flag */
+    uint32_t changes;             /**< changed pixels in the current window */
+    uint64_t mask;                /**< detected bad pixel mask */
+    int16_t last[64];             /**< last raw data */
+    uint16_t changed[64];         /**< changed frame count */
+    uint16_t saturated[64];       /**< saturated frame count */
+    uint16_t diverged[64];        /**< diverged frame count */
+} amg8833_defect_t;
+
+/**
+ * @brief     initialize the defect detector
+ * @param[in] *defect points to a defect structure
+ * @param[in] window is the window size in frames
+ * @param[in] diverge is the divergence threshold raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 defect is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_defect_init(amg8833_defect_t *defect, uint16_t window, int16_t diverge);
+
+/**
+ * @brief      add a frame to the defect detector
+ * @param[in]  *defect points to a defect structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *mask points to a bad pixel mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 defect, raw or mask is NULL
+ *             - 4 window is not complete
+ * @note       at the end of each window a pixel is marked bad when it never changed while the frame was changing,
+ *             when it was saturated in half of the frames, or when it differed from each of its 8 neighbours
+ *             by more than the divergence threshold in 90% of the frames,
+ *             the mask is sticky and is meant for amg8833_set_bad_pixel_mask
+ */
+uint8_t amg8833_defect_update(amg8833_defect_t *defect, int16_t raw[8][8], uint64_t *mask);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
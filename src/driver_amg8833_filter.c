@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_filter.c
+ * @brief     driver amg8833 filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_filter.h"
+
+/**
+ * @brief     get the motion adaptive gain
+ * @param[in] gain is the q8 filter gain
+ * @param[in] e is the q8 innovation
+ * @param[in] motion is the motion threshold
+ * @param[in] scale is 65536 / motion or 0 to disable
+ * @return    q8 gain
+ * @note      the gain ramps from gain at the threshold to 1.0 at twice the threshold
+ */
+static int32_t a_filter_gain(int32_t gain, int32_t e, int32_t motion, int32_t scale)
+{
+    int32_t m;
+    
+    m = (((e < 0) ? -e : e) >> 8) - motion;                  /* distance above the threshold */
+    m = (m * scale) >> 8;                                    /* q8 ramp */
+    m = (m < 0) ? 0 : ((m > 256) ? 256 : m);                 /* clamp the ramp */
+    
+    return gain + (((256 - gain) * m) >> 8);                 /* raise the gain on motion */
+}
+
+/**
+ * @brief     initialize the filter with the default gains
+ * @param[in] *filter points to a filter structure
+ * @param[in] type is the filter type
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 type is invalid
+ * @note      iir alpha is 64, alpha beta gains are 128 and 32, kalman noise is q 1 and r 16,
+ *            the motion adaptive gain is disabled
+ */
+uint8_t amg8833_filter_init(amg8833_filter_t *filter, amg8833_filter_type_t type)
+{
+    if (filter == NULL)                                      /* check filter */
+    {
+        return 2;                                            /* return error */
+    }
+    if (type > AMG8833_FILTER_TYPE_KALMAN)                   /* check type */
+    {
+        return 5;                                            /* return error */
+    }
+    
+    memset(filter, 0, sizeof(amg8833_filter_t));             /* clear the filter */
+    filter->type = (uint8_t)type;                            /* set type */
+    if (type == AMG8833_FILTER_TYPE_IIR)                     /* iir */
+    {
+        filter->alpha = 64;                                  /* alpha 0.25 */
+    }
+    else
+    {
+        filter->alpha = 128;                                 /* alpha 0.5 */
+    }
+    filter->beta = 32;                                       /* beta 0.125 */
+    filter->q = 1;                                           /* process noise */
+    filter->r = 16;                                          /* measurement noise */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the filter gains
+ * @param[in] *filter points to a filter structure
+ * @param[in] alpha is the q8 alpha
+ * @param[in] beta is the q8 beta
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 gain is invalid
+ * @note      alpha is used by iir and alpha beta, beta is used by alpha beta, 1 <= gain <= 256
+ */
+uint8_t amg8833_filter_set_gain(amg8833_filter_t *filter, uint16_t alpha, uint16_t beta)
+{
+    if (filter == NULL)                                                     /* check filter */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((alpha == 0) || (alpha > AMG8833_FILTER_GAIN_ONE) ||
+        (beta == 0) || (beta > AMG8833_FILTER_GAIN_ONE))                    /* check gain */
+    {
+        return 5;                                                           /* return error */
+    }
+    
+    filter->alpha = alpha;                                                  /* set alpha */
+    filter->beta = beta;                                                    /* set beta */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the kalman noise
+ * @param[in] *filter points to a filter structure
+ * @param[in] q is the process noise
+ * @param[in] r is the measurement noise
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 noise is invalid
+ * @note      r can't be 0 and both values are in raw data squared
+ */
+uint8_t amg8833_filter_set_noise(amg8833_filter_t *filter, uint16_t q, uint16_t r)
+{
+    if (filter == NULL)                  /* check filter */
+    {
+        return 2;                        /* return error */
+    }
+    if (r == 0)                          /* check r */
+    {
+        return 5;                        /* return error */
+    }
+    
+    filter->q = q;                       /* set q */
+    filter->r = r;                       /* set r */
+    
+    return 0;                            /* success return 0 */
+}
+
+/**
+ * @brief     set the motion adaptive threshold
+ * @param[in] *filter points to a filter structure
+ * @param[in] threshold is the motion threshold in raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      when the innovation of a pixel is above threshold its gain is raised and reaches 1.0 at
+ *            twice the threshold, so moving objects are followed without lag, 0 disables it
+ */
+uint8_t amg8833_filter_set_motion_threshold(amg8833_filter_t *filter, uint16_t threshold)
+{
+    if (filter == NULL)                  /* check filter */
+    {
+        return 2;                        /* return error */
+    }
+    
+    filter->motion = threshold;          /* set threshold */
+    
+    return 0;                            /* success return 0 */
+}
+
+/**
+ * @brief     reset the filter state
+ * @param[in] *filter points to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      the next frame seeds the state
+ */
+uint8_t amg8833_filter_reset(amg8833_filter_t *filter)
+{
+    if (filter == NULL)                  /* check filter */
+    {
+        return 2;                        /* return error */
+    }
+    
+    filter->seeded = 0;                  /* clear the seeded flag */
+    
+    return 0;                            /* success return 0 */
+}
+
+/**
+ * @brief      filter a frame
+ * @param[in]  *filter points to a filter structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] out_raw is the filtered raw array
+ * @param[out] out_temp is the filtered temperature array, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, raw or out_raw is NULL
+ * @note       all the 64 pixels are updated with integer math in one pass
+ */
+uint8_t amg8833_filter_update(amg8833_filter_t *filter, int16_t raw[8][8], int16_t out_raw[8][8], float out_temp[8][8])
+{
+    const int16_t *z;
+    int16_t *out;
+    int32_t motion;
+    int32_t scale;
+    int32_t alpha;
+    int32_t beta;
+    int32_t q;
+    int32_t r;
+    int32_t e;
+    int32_t g;
+    int32_t pp;
+    uint8_t i;
+    
+    if ((filter == NULL) || (raw == NULL) || (out_raw == NULL))                    /* check param */
+    {
+        return 2;                                                                  /* return error */
+    }
+    
+    z = &raw[0][0];                                                                /* flat input */
+    out = &out_raw[0][0];                                                          /* flat output */
+    if (filter->seeded == 0)                                                       /* seed the state */
+    {
+        for (i = 0; i < 64; i++)                                                   /* run 64 times */
+        {
+            filter->x[i] = (int32_t)z[i] * 256;                                    /* set the estimate */
+            filter->v[i] = 0;                                                      /* clear the slope */
+            filter->p[i] = (int32_t)filter->r * 16;                                /* start as uncertain as a sample */
+        }
+        filter->seeded = 1;                                                        /* set the seeded flag */
+    }
+    else
+    {
+        motion = filter->motion;                                                   /* get the threshold */
+        scale = (motion != 0) ? (65536 / motion) : 0;                              /* ramp scale */
+        alpha = filter->alpha;                                                     /* get alpha */
+        beta = filter->beta;                                                       /* get beta */
+        q = (int32_t)filter->q * 16;                                               /* q4 process noise */
+        r = (int32_t)filter->r * 16;                                               /* q4 measurement noise */
+        if (filter->type == AMG8833_FILTER_TYPE_ALPHA_BETA)                        /* alpha beta */
+        {
+            for (i = 0; i < 64; i++)                                               /* run 64 times */
+            {
+                filter->x[i] += filter->v[i];                                      /* predict */
+                e = (int32_t)z[i] * 256 - filter->x[i];                            /* q8 innovation */
+                g = a_filter_gain(alpha, e, motion, scale);                        /* get the gain */
+                filter->x[i] += (g * e + 128) >> 8;                                /* correct */
+                filter->v[i] += (beta * e + 128) >> 8;                             /* correct the slope */
+            }
+        }
+        else if (filter->type == AMG8833_FILTER_TYPE_KALMAN)                       /* kalman */
+        {
+            for (i = 0; i < 64; i++)                                               /* run 64 times */
+            {
+                pp = filter->p[i] + q;                                             /* predict the covariance */
+                e = (int32_t)z[i] * 256 - filter->x[i];                            /* q8 innovation */
+                g = a_filter_gain((pp * 256) / (pp + r), e, motion, scale);        /* get the gain */
+                filter->x[i] += (g * e + 128) >> 8;                                /* correct */
+                filter->p[i] = (pp * (256 - g)) >> 8;                              /* update the covariance */
+            }
+        }
+        else                                                                       /* iir */
+        {
+            for (i = 0; i < 64; i++)                                               /* run 64 times */
+            {
+                e = (int32_t)z[i] * 256 - filter->x[i];                            /* q8 innovation */
+                g = a_filter_gain(alpha, e, motion, scale);                        /* get the gain */
+                filter->x[i] += (g * e + 128) >> 8;                                /* correct */
+            }
+        }
+    }
+    for (i = 0; i < 64; i++)                                                       /* run 64 times */
+    {
+        out[i] = (int16_t)((filter->x[i] + 128) >> 8);                             /* rounded raw data */
+    }
+    if (out_temp != NULL)                                                          /* check out_temp */
+    {
+        for (i = 0; i < 64; i++)                                                   /* run 64 times */
+        {
+            out_temp[i / 8][i % 8] = (float)filter->x[i] * (0.25f / 256.0f);       /* keep the q8 fraction */
+        }
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_filter.h
+ * @brief     driver amg8833 filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_FILTER_H
+#define DRIVER_AMG8833_FILTER_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_filter_driver amg8833 filter driver function
+ * @brief    amg8833 filter driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 filter definition
+ * @note  gains are q8 values and 256 means 1.0, noise values are in raw data squared (0.0625C^2/LSB)
+ */
+#define AMG8833_FILTER_GAIN_ONE        256        /**< gain 1.0 */
+
+/**
+ * @brief amg8833 filter type enumeration definition
+ */
+typedef enum
+{
+    AMG8833_FILTER_TYPE_IIR        = 0x00,        /**< first order iir, x += alpha * (z - x) */
+    AMG8833_FILTER_TYPE_ALPHA_BETA = 0x01,        /**< alpha beta tracker with a per pixel slope */
+    AMG8833_FILTER_TYPE_KALMAN     = 0x02,        /**< scalar kalman filter with a random walk model */
+} amg8833_filter_type_t;
+
+/**
+ * @brief amg8833 filter structure definition
+ */
+typedef struct amg8833_filter_s
+{
+    uint8_t type;                  /**< filter type */
+    uint8_t seeded;                /**< state seeded flag */
+    uint16_t alpha;                /**< q8 alpha */
+    uint16_t beta;                 /**< q8 beta */
+    uint16_t q;                    /**< kalman process noise */
+    uint16_t r;                    /**< kalman measurement noise */
+    uint16_t motion;               /**< motion threshold in raw data, 0 means disable */
+    int32_t x[64];                 /**< q8 estimate */
+    int32_t v[64];                 /**< q8 slope per frame */
+    int32_t p[64];                 /**< q4 kalman error covariance */
+} amg8833_filter_t;
+
+/**
+ * @brief     initialize the filter with the default gains
+ * @param[in] *filter points to a filter structure
+ * @param[in] type is the filter type
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 type is invalid
+ * @note      iir alpha is 64, alpha beta gains are 128 and 32, kalman noise is q 1 and r 16,
+ *            the motion adaptive gain is disabled
+ */
+uint8_t amg8833_filter_init(amg8833_filter_t *filter, amg8833_filter_type_t type);
+
+/**
+ * @brief     set the filter gains
+ * @param[in] *filter points to a filter structure
+ * @param[in] alpha is the q8 alpha
+ * @param[in] beta is the q8 beta
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 gain is invalid
+ * @note      alpha is used by iir and alpha beta, beta is used by alpha beta, 1 <= gain <= 256
+ */
+uint8_t amg8833_filter_set_gain(amg8833_filter_t *filter, uint16_t alpha, uint16_t beta);
+
+/**
+ * @brief     set the kalman noise
+ * @param[in] *filter points to a filter structure
+ * @param[in] q is the process noise
+ * @param[in] r is the measurement noise
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 5 noise is invalid
+ * @note      r can't be 0 and both values are in raw data squared
+ */
+uint8_t amg8833_filter_set_noise(amg8833_filter_t *filter, uint16_t q, uint16_t r);
+
+/**
+ * @brief     set the motion adaptive threshold
+ * @param[in] *filter points to a filter structure
+ * @param[in] threshold is the motion threshold in raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      when the innovation of a pixel is above threshold its gain is raised and reaches 1.0 at
+ *            twice the threshold, so moving objects are followed without lag, 0 disables it
+ */
+uint8_t amg8833_filter_set_motion_threshold(amg8833_filter_t *filter, uint16_t threshold);
+
+/**
+ * @brief     reset the filter state
+ * @param[in] *filter points to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      the next frame seeds the state
+ */
+uint8_t amg8833_filter_reset(amg8833_filter_t *filter);
+
+/**
+ * @brief      filter a frame
+ * @param[in]  *filter points to a filter structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] out_raw is the filtered raw array
+ * @param[out] out_temp is the filtered temperature array, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, raw or out_raw is NULL
+ * @note       all the 64 pixels are updated with integer math in one pass
+ */
+uint8_t amg8833_filter_update(amg8833_filter_t *filter, int16_t raw[8][8], int16_t out_raw[8][8], float out_temp[8][8]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_governor.c
+ * @brief     driver amg8833 governor source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_governor.h"
+
+/**
+ * @brief governor level latency table definition
+ */
+static const uint32_t gs_governor_latency[4] =
+{
+    100, 1000, 10000, 60000,
+};
+
+/**
+ * @brief     switch the chip to a level
+ * @param[in] *governor points to a governor structure
+ * @param[in] level is the new level
+ * @return    status code
+ *            - 0 success
+ *            - 1 set level failed
+ * @note      none
+ */
+static uint8_t a_governor_apply(amg8833_governor_t *governor, uint8_t level)
+{
+    amg8833_handle_t *handle = governor->handle;
+    
+    switch (level)
+    {
+        case AMG8833_GOVERNOR_LEVEL_ACTIVE :
+        {
+            if (amg8833_set_mode(handle, AMG8833_MODE_NORMAL) != 0)                 /* set normal mode */
+            {
+                return 1;                                                           /* return error */
+            }
+            if (amg8833_set_frame_rate(handle, AMG8833_FRAME_RATE_10_FPS) != 0)     /* set 10 fps */
+            {
+                return 1;                                                           /* return error */
+            }
+            
+            break;
+        }
+        case AMG8833_GOVERNOR_LEVEL_IDLE :
+        {
+            if (amg8833_set_mode(handle, AMG8833_MODE_NORMAL) != 0)                 /* set normal mode */
+            {
+                return 1;                                                           /* return error */
+            }
+            if (amg8833_set_frame_rate(handle, AMG8833_FRAME_RATE_1_FPS) != 0)      /* set 1 fps */
+            {
+                return 1;                                                           /* return error */
+            }
+            
+            break;
+        }
+        case AMG8833_GOVERNOR_LEVEL_STAND_BY_10S :
+        {
+            if (amg8833_set_mode(handle, AMG8833_MODE_STAND_BY_10S) != 0)           /* set stand-by 10s mode */
+            {
+                return 1;                                                           /* return error */
+            }
+            
+            break;
+        }
+        default :
+        {
+            if (amg8833_set_mode(handle, AMG8833_MODE_STAND_BY_60S) != 0)           /* set stand-by 60s mode */
+            {
+                return 1;                                                           /* return error */
+            }
+            
+            break;
+        }
+    }
+    governor->level = level;                                                        /* save the level */
+    governor->quiet = 0;                                                            /* restart the quiet time */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     initialize the governor and switch the chip to the active level
+ * @param[in] *governor points to a governor structure
+ * @param[in] *handle points to an initialized amg8833 handle structure
+ * @param[in] latency is the max wake-up latency in ms
+ * @param[in] hold is the quiet time before going one level deeper in ms
+ * @param[in] delta is the raw data change of a pixel
+ * @param[in] pixels is the changed pixels of an activity
+ * @return    status code
+ *            - 0 success
+ *            - 1 set level failed
+ *            - 2 governor or handle is NULL
+ *            - 5 param is invalid
+ * @note      the deepest level is the one whose latency is not above latency
+ */
+uint8_t amg8833_governor_init(amg8833_governor_t *governor, amg8833_handle_t *handle, uint32_t latency,
+                              uint32_t hold, int16_t delta, uint8_t pixels)
+{
+    uint8_t level;
+    
+    if ((governor == NULL) || (handle == NULL))                                        /* check param */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((latency < gs_governor_latency[0]) || (delta <= 0) ||
+        (pixels == 0) || (pixels > 64))                                                /* check param */
+    {
+        return 5;                                                                      /* return error */
+    }
+    
+    memset(governor, 0, sizeof(amg8833_governor_t));                                   /* clear the governor */
+    governor->handle = handle;                                                         /* set the handle */
+    governor->hold = hold;                                                             /* set the hold */
+    governor->delta = delta;                                                           /* set the delta */
+    governor->pixels = pixels;                                                         /* set the pixels */
+    for (level = AMG8833_GOVERNOR_LEVEL_STAND_BY_60S; level > 0; level--)              /* find the deepest level */
+    {
+        if (gs_governor_latency[level] <= latency)                                     /* check the latency */
+        {
+            break;                                                                     /* break */
+        }
+    }
+    governor->deepest = level;                                                         /* set the deepest level */
+    if (a_governor_apply(governor, AMG8833_GOVERNOR_LEVEL_ACTIVE) != 0)                /* start active */
+    {
+        handle->debug_print("amg8833: set level failed.\n");                           /* set level failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      update the governor with a new frame
+ * @param[in]  *governor points to a governor structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array, it can be NULL
+ * @param[in]  interrupt is the interrupt flag of this frame
+ * @param[out] *period points to a next read period buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 set level failed
+ *             - 2 governor or period is NULL
+ * @note       any activity goes back to the active level at once, so the wake-up latency is bounded by the read period,
+ *             the chip registers are only written when the level changes
+ */
+uint8_t amg8833_governor_update(amg8833_governor_t *governor, int16_t raw[8][8], amg8833_bool_t interrupt,
+                                uint32_t *period)
+{
+    const int16_t *z;
+    uint8_t active;
+    uint8_t changed;
+    uint8_t level;
+    uint8_t i;
+    int16_t d;
+    
+    if ((governor == NULL) || (period == NULL))                                          /* check param */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    active = (interrupt == AMG8833_BOOL_TRUE) ? 1 : 0;                                   /* interrupt activity */
+    if (raw != NULL)                                                                     /* check the frame */
+    {
+        z = &raw[0][0];                                                                  /* flat frame */
+        changed = 0;                                                                     /* init 0 */
+        for (i = 0; i < 64; i++)                                                         /* all pixels */
+        {
+            d = (int16_t)(z[i] - governor->prev[i]);                                     /* pixel change */
+            if ((d > governor->delta) || (d < -governor->delta))                         /* check the change */
+            {
+                changed++;                                                               /* count */
+            }
+            governor->prev[i] = z[i];                                                    /* save the pixel */
+        }
+        if ((governor->seeded != 0) && (changed >= governor->pixels))                    /* check the activity */
+        {
+            active = 1;                                                                  /* frame activity */
+        }
+        governor->seeded = 1;                                                            /* seeded */
+    }
+    
+    level = governor->level;                                                             /* current level */
+    if (active != 0)                                                                     /* activity */
+    {
+        level = AMG8833_GOVERNOR_LEVEL_ACTIVE;                                           /* wake up */
+        governor->quiet = 0;                                                             /* restart the quiet time */
+    }
+    else
+    {
+        governor->quiet += gs_governor_latency[level];                                   /* one more quiet period */
+        if ((governor->quiet >= governor->hold) && (level < governor->deepest))          /* check the quiet time */
+        {
+            level++;                                                                     /* one level deeper */
+        }
+    }
+    if (level != governor->level)                                                        /* check the level */
+    {
+        if (a_governor_apply(governor, level) != 0)                                      /* set the level */
+        {
+            governor->handle->debug_print("amg8833: set level failed.\n");               /* set level failed */
+            
+            return 1;                                                                    /* return error */
+        }
+    }
+    *period = gs_governor_latency[governor->level];                                      /* next read period */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the current level
+ * @param[in]  *governor points to a governor structure
+ * @param[out] *level points to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 governor or level is NULL
+ * @note       none
+ */
+uint8_t amg8833_governor_get_level(amg8833_governor_t *governor, amg8833_governor_level_t *level)
+{
+    if ((governor == NULL) || (level == NULL))                 /* check param */
+    {
+        return 2;                                              /* return error */
+    }
+    
+    *level = (amg8833_governor_level_t)(governor->level);      /* get the level */
+    
+    return 0;                                                  /* success return 0 */
+}
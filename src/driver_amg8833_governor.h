@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_governor.h
+ * @brief     driver amg8833 governor header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_GOVERNOR_H
+#define DRIVER_AMG8833_GOVERNOR_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_governor_driver amg8833 governor driver function
+ * @brief    amg8833 governor driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 governor level enumeration definition
+ */
+typedef enum
+{
+    AMG8833_GOVERNOR_LEVEL_ACTIVE       = 0x00,        /**< normal mode at 10 fps, 100 ms latency */
+    AMG8833_GOVERNOR_LEVEL_IDLE         = 0x01,        /**< normal mode at 1 fps, 1000 ms latency */
+    AMG8833_GOVERNOR_LEVEL_STAND_BY_10S = 0x02,        /**< stand-by 10s mode, 10000 ms latency */
+    AMG8833_GOVERNOR_LEVEL_STAND_BY_60S = 0x03,        /**< stand-by 60s mode, 60000 ms latency */
+} amg8833_governor_level_t;
+
+/**
+ * @brief amg8833 governor structure definition
+ */
+typedef struct amg8833_governor_s
+{
+    amg8833_handle_t *handle;        /**< amg8833 handle */
+    uint8_t level;                   /**< current level */
+    uint8_t deepest;                 /**< deepest allowed level */
+    uint8_t seeded;                  /**< previous frame is valid */
+    uint8_t pixels;                  /**< changed pixels of an activity */
+    int16_t delta;                   /**< raw data change of a pixel */
+    uint32_t hold;                   /**< quiet time before going one level deeper in ms */
+    uint32_t quiet;                  /**< quiet time at the current level in ms */
+    int16_t prev[64];                /**< previous frame */
+} amg8833_governor_t;
+
+/**
+ * @brief     initialize the governor and switch the chip to the active level
+ * @param[in] *governor points to a governor structure
+ * @param[in] *handle points to an initialized amg8833 handle structure
+ * @param[in] latency is the max wake-up latency in ms
+ * @param[in] hold is the quiet time before going one level deeper in ms
+ * @param[in] delta is the raw data change of a pixel
+ * @param[in] pixels is the changed pixels of an activity
+ * @return    status code
+ *            - 0 success
+ *            - 1 set level failed
+ *            - 2 governor or handle is NULL
+ *            - 5 param is invalid
+ * @note      the deepest level is the one whose latency is not above latency
+ */
+uint8_t amg8833_governor_init(amg8833_governor_t *governor, amg8833_handle_t *handle, uint32_t latency,
+                              uint32_t hold, int16_t delta, uint8_t pixels);
+
+/**
+ * @brief      update the governor with a new frame
+ * @param[in]  *governor points to a governor structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array, it can be NULL
+ * @param[in]  interrupt is the interrupt flag of this frame
+ * @param[out] *period points to a next read period buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 set level failed
+ *             - 2 governor or period is NULL
+ * @note       any activity goes back to the active level at once, so the wake-up latency is bounded by the read period,
+ *             the chip registers are only written when the level changes
+ */
+uint8_t amg8833_governor_update(amg8833_governor_t *governor, int16_t raw[8][8], amg8833_bool_t interrupt,
+                                uint32_t *period);
+
+/**
+ * @brief      get the current level
+ * @param[in]  *governor points to a governor structure
+ * @param[out] *level points to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 governor or level is NULL
+ * @note       none
+ */
+uint8_t amg8833_governor_get_level(amg8833_governor_t *governor, amg8833_governor_level_t *level);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
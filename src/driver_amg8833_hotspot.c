@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_hotspot.c
+ * @brief     driver amg8833 hotspot source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_hotspot.h"
+
+/**
+ * @brief hotspot neighbour table definition
+ * @note  the first four neighbours are before the pixel in row major order
+ */
+static const int8_t gs_dr[8] = {-1, -1, -1, 0, 0, 1, 1, 1};        /**< neighbour row offset */
+static const int8_t gs_dc[8] = {-1, 0, 1, -1, 1, -1, 0, 1};        /**< neighbour col offset */
+
+/**
+ * @brief      fit the 3x3 neighbourhood of a pixel
+ * @param[in]  raw is the raw array
+ * @param[out] *hotspot points to a hotspot structure with row, col and raw set
+ * @note       none
+ */
+static void a_hotspot_fit(int16_t raw[8][8], amg8833_hotspot_t *hotspot)
+{
+    float f[3][3];
+    float b;
+    float c;
+    float d;
+    float e;
+    float g;
+    float det;
+    float x;
+    float y;
+    int8_t r;
+    int8_t s;
+    int8_t i;
+    int8_t j;
+    
+    for (i = 0; i < 3; i++)                                                              /* 3 rows */
+    {
+        for (j = 0; j < 3; j++)                                                          /* 3 cols */
+        {
+            r = (int8_t)(hotspot->row + i - 1);                                          /* row */
+            s = (int8_t)(hotspot->col + j - 1);                                          /* col */
+            r = (r < 0) ? 0 : ((r > 7) ? 7 : r);                                         /* replicate the border */
+            s = (s < 0) ? 0 : ((s > 7) ? 7 : s);                                         /* replicate the border */
+            f[i][j] = (float)raw[r][s];                                                  /* set the sample */
+        }
+    }
+    
+    b = (f[0][2] + f[1][2] + f[2][2] - f[0][0] - f[1][0] - f[2][0]) / 6.0f;              /* x slope of the least squares fit */
+    c = (f[2][0] + f[2][1] + f[2][2] - f[0][0] - f[0][1] - f[0][2]) / 6.0f;              /* y slope */
+    d = (f[0][0] + f[1][0] + f[2][0] + f[0][2] + f[1][2] + f[2][2] -                     /* x curvature */
+         2.0f * (f[0][1] + f[1][1] + f[2][1])) / 6.0f;                                   /* of the 3 columns */
+    e = (f[0][0] + f[0][1] + f[0][2] + f[2][0] + f[2][1] + f[2][2] -                     /* y curvature */
+         2.0f * (f[1][0] + f[1][1] + f[1][2])) / 6.0f;                                   /* of the 3 rows */
+    g = (f[0][0] + f[2][2] - f[0][2] - f[2][0]) / 4.0f;                                  /* cross term */
+    
+    det = 4.0f * d * e - g * g;                                                          /* hessian determinant */
+    if ((d < 0.0f) && (e < 0.0f) && (det > 0.0f))                                        /* concave fit */
+    {
+        x = (g * c - 2.0f * e * b) / det;                                                /* stationary x */
+        y = (g * b - 2.0f * d * c) / det;                                                /* stationary y */
+    }
+    else
+    {
+        x = (d < 0.0f) ? (-b / (2.0f * d)) : 0.0f;                                       /* separable x vertex */
+        y = (e < 0.0f) ? (-c / (2.0f * e)) : 0.0f;                                       /* separable y vertex */
+    }
+    x = (x < -0.5f) ? -0.5f : ((x > 0.5f) ? 0.5f : x);                                   /* clamp x to the pixel */
+    y = (y < -0.5f) ? -0.5f : ((y > 0.5f) ? 0.5f : y);                                   /* clamp y to the pixel */
+    hotspot->sub_row = (float)hotspot->row + y;                                          /* set the sub row */
+    hotspot->sub_col = (float)hotspot->col + x;                                          /* set the sub col */
+    hotspot->peak = ((float)hotspot->raw + b * x + c * y +                               /* fitted peak */
+                     d * x * x + e * y * y + g * x * y) * 0.25f;                         /* convert to degrees */
+}
+
+/**
+ * @brief      find the local maxima of a frame
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *mask points to a local maxima mask buffer, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw is NULL
+ * @note       bit (row * 8 + col) is set when the pixel is above threshold, greater than its neighbours
+ *             before it and not less than its neighbours after it in row major order, so a plateau gives one maximum
+ */
+uint8_t amg8833_hotspot_find_mask(int16_t raw[8][8], int16_t threshold, uint64_t *mask)
+{
+    int16_t pad[10][10];
+    uint8_t keep[64];
+    uint64_t x;
+    int16_t v;
+    int16_t w;
+    uint8_t n;
+    uint8_t i;
+    uint8_t j;
+    
+    if (raw == NULL)                                                                           /* check raw */
+    {
+        return 2;                                                                              /* return error */
+    }
+    
+    for (i = 0; i < 10; i++)                                                                   /* frame plane with a border below every raw data */
+    {
+        for (j = 0; j < 10; j++)                                                               /* 10 cols */
+        {
+            pad[i][j] = INT16_MIN;                                                             /* set the border */
+        }
+    }
+    for (i = 0; i < 8; i++)                                                                    /* 8 rows */
+    {
+        for (j = 0; j < 8; j++)                                                                /* 8 cols */
+        {
+            pad[i + 1][j + 1] = raw[i][j];                                                     /* copy the raw data */
+            keep[i * 8 + j] = (uint8_t)(raw[i][j] > threshold);                                /* above the threshold */
+        }
+    }
+    
+    for (n = 0; n < 8; n++)                                                                    /* compare against each shifted neighbour plane */
+    {
+        for (i = 0; i < 8; i++)                                                                /* 8 rows */
+        {
+            for (j = 0; j < 8; j++)                                                            /* 8 cols */
+            {
+                v = pad[i + 1][j + 1];                                                         /* frame plane */
+                w = pad[i + 1 + gs_dr[n]][j + 1 + gs_dc[n]];                                   /* neighbour plane */
+                if (n < 4)                                                                     /* neighbours before */
+                {
+                    keep[i * 8 + j] &= (uint8_t)(v > w);                                       /* strictly greater */
+                }
+                else
+                {
+                    keep[i * 8 + j] &= (uint8_t)(v >= w);                                      /* not less */
+                }
+            }
+        }
+    }
+    x = 0;                                                                                     /* init 0 */
+    for (i = 0; i < 64; i++)                                                                   /* pack the lanes */
+    {
+        x |= (uint64_t)keep[i] << i;                                                           /* set the bit */
+    }
+    if (mask != NULL)                                                                          /* check the mask */
+    {
+        *mask = x;                                                                             /* set the mask */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      find the top k hotspots of a frame
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *hotspot points to a hotspot array
+ * @param[in]  k is the hotspot array size
+ * @param[out] *count points to a hotspot count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw, hotspot or count is NULL
+ * @note       hotspots are sorted from the hottest, the sub pixel position and the peak come from
+ *             a quadratic surface fitted to the 3x3 neighbourhood with the border pixels replicated
+ */
+uint8_t amg8833_hotspot_find(int16_t raw[8][8], int16_t threshold, amg8833_hotspot_t *hotspot, uint8_t k, uint8_t *count)
+{
+    uint64_t mask;
+    int16_t v;
+    uint8_t index;
+    uint8_t n;
+    uint8_t i;
+    
+    if ((raw == NULL) || (hotspot == NULL) || (count == NULL))                           /* check param */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    (void)amg8833_hotspot_find_mask(raw, threshold, &mask);                              /* local maxima */
+    n = 0;                                                                               /* init 0 */
+    while (mask != 0)                                                                    /* all maxima */
+    {
+        index = 0;                                                                       /* init 0 */
+        while (((mask >> index) & 1U) == 0)                                              /* lowest bit */
+        {
+            index++;                                                                     /* next */
+        }
+        mask &= mask - 1;                                                                /* clear the lowest bit */
+        v = raw[index / 8][index % 8];                                                   /* get the raw */
+        if ((n == k) && ((k == 0) || (hotspot[k - 1].raw >= v)))                         /* not in the top k */
+        {
+            continue;                                                                    /* skip */
+        }
+        i = (n < k) ? n : (uint8_t)(k - 1);                                              /* insert position */
+        while ((i > 0) && (hotspot[i - 1].raw < v))                                      /* insertion sort */
+        {
+            hotspot[i] = hotspot[i - 1];                                                 /* shift */
+            i--;                                                                         /* previous */
+        }
+        hotspot[i].row = (uint8_t)(index / 8);                                           /* set the row */
+        hotspot[i].col = (uint8_t)(index % 8);                                           /* set the col */
+        hotspot[i].raw = v;                                                              /* set the raw */
+        if (n < k)                                                                       /* not full */
+        {
+            n++;                                                                         /* count */
+        }
+    }
+    for (i = 0; i < n; i++)                                                              /* only the kept maxima */
+    {
+        a_hotspot_fit(raw, &hotspot[i]);                                                 /* sub pixel fit */
+    }
+    *count = n;                                                                          /* set the count */
+    
+    return 0;                                                                            /* success return 0 */
+}
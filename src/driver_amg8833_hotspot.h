@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_hotspot.h
+ * @brief     driver amg8833 hotspot header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_HOTSPOT_H
+#define DRIVER_AMG8833_HOTSPOT_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_hotspot_driver amg8833 hotspot driver function
+ * @brief    amg8833 hotspot driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 hotspot structure definition
+ */
+typedef struct amg8833_hotspot_s
+{
+    uint8_t row;          /**< pixel row */
+    uint8_t col;          /**< pixel col */
+    int16_t raw;          /**< pixel raw data */
+    float sub_row;        /**< sub pixel row */
+    float sub_col;        /**< sub pixel col */
+    float peak;           /**< estimated peak temperature in C */
+} amg8833_hotspot_t;
+
+/**
+ * @brief      find the local maxima of a frame
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *mask points to a local maxima mask buffer, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw is NULL
+ * @note       bit (row * 8 + col) is set when the pixel is above threshold, greater than its neighbours
+ *             before it and not less than its neighbours after it in row major order, so a plateau gives one maximum
+ */
+uint8_t amg8833_hotspot_find_mask(int16_t raw[8][8], int16_t threshold, uint64_t *mask);
+
+/**
+ * @brief      find the top k hotspots of a frame
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  threshold is the raw data threshold
+ * @param[out] *hotspot points to a hotspot array
+ * @param[in]  k is the hotspot array size
+ * @param[out] *count points to a hotspot count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw, hotspot or count is NULL
+ * @note       hotspots are sorted from the hottest, the sub pixel position and the peak come from
+ *             a quadratic surface fitted to the 3x3 neighbourhood with the border pixels replicated
+ */
+uint8_t amg8833_hotspot_find(int16_t raw[8][8], int16_t threshold, amg8833_hotspot_t *hotspot, uint8_t k, uint8_t *count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
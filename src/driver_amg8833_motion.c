@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_motion.c
+ * @brief     driver amg8833 motion source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_motion.h"
+#include "driver_amg8833_bitboard.h"
+
+/**
+ * @brief motion definition
+ */
+#define MOTION_SIZE            (2 * AMG8833_MOTION_RANGE + 1)        /**< shifts per axis */
+#define MOTION_INVALID         0xFFFFFFFFU                          /**< invalid cost */
+#define MOTION_DEAD_ZONE       64                                   /**< 1/4 pixel */
+#define MOTION_TAN_22_5        106                                  /**< tan(22.5) in 1/256 */
+
+/**
+ * @brief     refine a cost minimum with a parabola
+ * @param[in] m is the cost before the minimum
+ * @param[in] c is the minimum cost
+ * @param[in] p is the cost after the minimum
+ * @return    offset in 1/256 pixel
+ * @note      the offset is limited to half a pixel
+ */
+static int16_t a_motion_refine(uint32_t m, uint32_t c, uint32_t p)
+{
+    int64_t num;
+    int64_t den;
+    int64_t off;
+    
+    if ((m == MOTION_INVALID) || (p == MOTION_INVALID))                   /* check the neighbours */
+    {
+        return 0;                                                         /* no refine */
+    }
+    den = (int64_t)m + (int64_t)p - 2 * (int64_t)c;                       /* curvature */
+    if (den <= 0)                                                         /* flat */
+    {
+        return 0;                                                         /* no refine */
+    }
+    num = ((int64_t)m - (int64_t)p) * 128;                                /* slope in 1/256 */
+    off = num / den;                                                      /* vertex */
+    off = (off < -128) ? -128 : ((off > 128) ? 128 : off);                /* limit */
+    
+    return (int16_t)off;                                                  /* return the offset */
+}
+
+/**
+ * @brief     get the direction of a displacement
+ * @param[in] row is the row displacement in 1/256 pixel
+ * @param[in] col is the col displacement in 1/256 pixel
+ * @return    direction
+ * @note      none
+ */
+static amg8833_motion_direction_t a_motion_direction(int16_t row, int16_t col)
+{
+    int32_t ar;
+    int32_t ac;
+    
+    ar = (row < 0) ? -row : row;                                                    /* abs row */
+    ac = (col < 0) ? -col : col;                                                    /* abs col */
+    if ((ar < MOTION_DEAD_ZONE) && (ac < MOTION_DEAD_ZONE))                         /* too small */
+    {
+        return AMG8833_MOTION_DIRECTION_NONE;                                       /* none */
+    }
+    if (ar * 256 < ac * MOTION_TAN_22_5)                                            /* horizontal */
+    {
+        return (col > 0) ? AMG8833_MOTION_DIRECTION_RIGHT :                         /* right */
+                           AMG8833_MOTION_DIRECTION_LEFT;                           /* left */
+    }
+    if (ac * 256 < ar * MOTION_TAN_22_5)                                            /* vertical */
+    {
+        return (row > 0) ? AMG8833_MOTION_DIRECTION_DOWN :                          /* down */
+                           AMG8833_MOTION_DIRECTION_UP;                             /* up */
+    }
+    if (row > 0)                                                                    /* diagonal down */
+    {
+        return (col > 0) ? AMG8833_MOTION_DIRECTION_DOWN_RIGHT :                    /* down right */
+                           AMG8833_MOTION_DIRECTION_DOWN_LEFT;                      /* down left */
+    }
+    
+    return (col > 0) ? AMG8833_MOTION_DIRECTION_UP_RIGHT :                          /* up right */
+                       AMG8833_MOTION_DIRECTION_UP_LEFT;                            /* up left */
+}
+
+/**
+ * @brief      estimate the motion between two frames
+ * @param[in]  prev is the previous raw array
+ * @param[in]  cur is the current raw array
+ * @param[in]  mask is the current frame pixels to match, 0 means all pixels
+ * @param[out] *motion points to a motion structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 prev, cur or motion is NULL
+ * @note       integer shifts are block matched by the mean absolute difference over the overlap,
+ *             the best shift is refined with a parabola through its neighbour costs,
+ *             a low contrast means the match is not reliable, displacements below 1/4 pixel have no direction
+ */
+uint8_t amg8833_motion_estimate(int16_t prev[8][8], int16_t cur[8][8], uint64_t mask, amg8833_motion_t *motion)
+{
+    uint32_t cost[MOTION_SIZE][MOTION_SIZE];
+    uint32_t sum;
+    uint32_t total;
+    uint32_t best;
+    uint32_t lo;
+    uint32_t hi;
+    uint8_t valid;
+    uint8_t need;
+    uint8_t n;
+    int8_t dr;
+    int8_t dc;
+    int8_t br;
+    int8_t bc;
+    int8_t r;
+    int8_t c;
+    int32_t d;
+    
+    if ((prev == NULL) || (cur == NULL) || (motion == NULL))                                   /* check param */
+    {
+        return 2;                                                                              /* return error */
+    }
+    
+    if (mask == 0)                                                                             /* all pixels */
+    {
+        mask = 0xFFFFFFFFFFFFFFFFULL;                                                          /* full mask */
+    }
+    need = (uint8_t)((amg8833_bitboard_popcount(mask) + 1) / 2);                               /* half overlap */
+    
+    for (dr = -AMG8833_MOTION_RANGE; dr <= AMG8833_MOTION_RANGE; dr++)                         /* mean absolute difference of every row shift */
+    {
+        for (dc = -AMG8833_MOTION_RANGE; dc <= AMG8833_MOTION_RANGE; dc++)                     /* and every col shift */
+        {
+            sum = 0;                                                                           /* init 0 */
+            n = 0;                                                                             /* init 0 */
+            for (r = 0; r < 8; r++)                                                            /* 8 rows */
+            {
+                if (((r - dr) < 0) || ((r - dr) > 7))                                          /* outside the previous frame */
+                {
+                    continue;                                                                  /* skip */
+                }
+                for (c = 0; c < 8; c++)                                                        /* 8 cols */
+                {
+                    if (((mask >> (r * 8 + c)) & 0x01) == 0)                                   /* masked */
+                    {
+                        continue;                                                              /* skip */
+                    }
+                    if (((c - dc) < 0) || ((c - dc) > 7))                                      /* outside the previous frame */
+                    {
+                        continue;                                                              /* skip */
+                    }
+                    d = (int32_t)cur[r][c] - (int32_t)prev[r - dr][c - dc];                    /* difference */
+                    sum += (uint32_t)((d < 0) ? -d : d);                                       /* sum the absolute difference */
+                    n++;                                                                       /* count */
+                }
+            }
+            cost[dr + AMG8833_MOTION_RANGE][dc + AMG8833_MOTION_RANGE] =                       /* set the cost of the shift */
+                ((n == 0) || (n < need)) ? MOTION_INVALID : ((sum << 8) / n);                  /* too little overlap is invalid */
+        }
+    }
+    
+    br = 0;                                                                                    /* init 0 */
+    bc = 0;                                                                                    /* init 0 */
+    best = cost[AMG8833_MOTION_RANGE][AMG8833_MOTION_RANGE];                                   /* start from the zero shift */
+    total = 0;                                                                                 /* init 0 */
+    valid = 0;                                                                                 /* init 0 */
+    for (dr = 0; dr < MOTION_SIZE; dr++)                                                       /* find the best shift */
+    {
+        for (dc = 0; dc < MOTION_SIZE; dc++)                                                   /* the smaller shift wins a tie */
+        {
+            if (cost[dr][dc] == MOTION_INVALID)                                                /* invalid */
+            {
+                continue;                                                                      /* skip */
+            }
+            total += cost[dr][dc];                                                             /* sum the costs */
+            valid++;                                                                           /* count */
+            r = (int8_t)(dr - AMG8833_MOTION_RANGE);                                           /* row shift */
+            c = (int8_t)(dc - AMG8833_MOTION_RANGE);                                           /* col shift */
+            if ((cost[dr][dc] < best) ||                                                       /* smaller cost */
+                ((cost[dr][dc] == best) && ((r * r + c * c) < (br * br + bc * bc))))           /* or a smaller shift */
+            {
+                best = cost[dr][dc];                                                           /* save the cost */
+                br = r;                                                                        /* save the row */
+                bc = c;                                                                        /* save the col */
+            }
+        }
+    }
+    
+    dr = (int8_t)(br + AMG8833_MOTION_RANGE);                                                  /* best row index */
+    dc = (int8_t)(bc + AMG8833_MOTION_RANGE);                                                  /* best col index */
+    lo = (dr > 0) ? cost[dr - 1][dc] : MOTION_INVALID;                                         /* cost above */
+    hi = (dr < MOTION_SIZE - 1) ? cost[dr + 1][dc] : MOTION_INVALID;                           /* cost below */
+    motion->row = (int16_t)(br * 256 + a_motion_refine(lo, best, hi));                         /* sub pixel row refine */
+    lo = (dc > 0) ? cost[dr][dc - 1] : MOTION_INVALID;                                         /* cost left */
+    hi = (dc < MOTION_SIZE - 1) ? cost[dr][dc + 1] : MOTION_INVALID;                           /* cost right */
+    motion->col = (int16_t)(bc * 256 + a_motion_refine(lo, best, hi));                         /* sub pixel col refine */
+    motion->cost = best;                                                                       /* save the cost */
+    motion->contrast = (valid == 0) ? 0 : (total / valid - best);                              /* mean cost above the best */
+    motion->direction = a_motion_direction(motion->row, motion->col);                          /* get the direction */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      estimate the motion of each blob
+ * @param[in]  prev is the previous raw array
+ * @param[in]  cur is the current raw array
+ * @param[in]  *blob points to a blob array of the current frame
+ * @param[in]  count is the blob count
+ * @param[out] *motion points to a motion array
+ * @return     status code
+ *             - 0 success
+ *             - 2 prev, cur, blob or motion is NULL
+ * @note       every blob mask is dilated by one pixel to include its edge
+ */
+uint8_t amg8833_motion_estimate_blobs(int16_t prev[8][8], int16_t cur[8][8], const amg8833_blob_t *blob,
+                                      uint8_t count, amg8833_motion_t *motion)
+{
+    uint8_t i;
+    
+    if ((prev == NULL) || (cur == NULL) || (blob == NULL) || (motion == NULL))        /* check param */
+    {
+        return 2;                                                                     /* return error */
+    }
+    
+    for (i = 0; i < count; i++)                                                       /* all blobs */
+    {
+        (void)amg8833_motion_estimate(prev, cur,
+                                      amg8833_bitboard_dilate(blob[i].mask, AMG8833_BITBOARD_CONNECTIVITY_8),
+                                      &motion[i]);                                    /* estimate */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
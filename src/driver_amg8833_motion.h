@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_motion.h
+ * @brief     driver amg8833 motion header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_MOTION_H
+#define DRIVER_AMG8833_MOTION_H
+
+#include "driver_amg8833_blob.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_motion_driver amg8833 motion driver function
+ * @brief    amg8833 motion driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 motion definition
+ * @note  the cost per estimate is at most (2 * range + 1)^2 * 64 absolute differences
+ */
+#define AMG8833_MOTION_RANGE        2        /**< search range in pixels */
+
+/**
+ * @brief amg8833 motion direction enumeration definition
+ * @note  up is towards row 0 and left is towards col 0
+ */
+typedef enum
+{
+    AMG8833_MOTION_DIRECTION_NONE       = 0x00,        /**< no motion */
+    AMG8833_MOTION_DIRECTION_UP         = 0x01,        /**< up */
+    AMG8833_MOTION_DIRECTION_UP_RIGHT   = 0x02,        /**< up right */
+    AMG8833_MOTION_DIRECTION_RIGHT      = 0x03,        /**< right */
+    AMG8833_MOTION_DIRECTION_DOWN_RIGHT = 0x04,        /**< down right */
+    AMG8833_MOTION_DIRECTION_DOWN       = 0x05,        /**< down */
+    AMG8833_MOTION_DIRECTION_DOWN_LEFT  = 0x06,        /**< down left */
+    AMG8833_MOTION_DIRECTION_LEFT       = 0x07,        /**< left */
+    AMG8833_MOTION_DIRECTION_UP_LEFT    = 0x08,        /**< up left */
+} amg8833_motion_direction_t;
+
+/**
+ * @brief amg8833 motion structure definition
+ */
+typedef struct amg8833_motion_s
+{
+    int16_t row;                                /**< row displacement in 1/256 pixel */
+    int16_t col;                                /**< col displacement in 1/256 pixel */
+    uint32_t cost;                              /**< mean absolute difference of the best shift in 1/256 LSB */
+    uint32_t contrast;                          /**< mean cost of all shifts minus the best cost in 1/256 LSB */
+    amg8833_motion_direction_t direction;       /**< dominant direction */
+} amg8833_motion_t;
+
+/**
+ * @brief      estimate the motion between two frames
+ * @param[in]  prev is the previous raw array
+ * @param[in]  cur is the current raw array
+ * @param[in]  mask is the current frame pixels to match, 0 means all pixels
+ * @param[out] *motion points to a motion structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 prev, cur or motion is NULL
+ * @note       integer shifts are block matched by the mean absolute difference over the overlap,
+ *             the best shift is refined with a parabola through its neighbour costs,
+ *             a low contrast means the match is not reliable, displacements below 1/4 pixel have no direction
+ */
+uint8_t amg8833_motion_estimate(int16_t prev[8][8], int16_t cur[8][8], uint64_t mask, amg8833_motion_t *motion);
+
+/**
+ * @brief      estimate the motion of each blob
+ * @param[in]  prev is the previous raw array
+ * @param[in]  cur is the current raw array
+ * @param[in]  *blob points to a blob array of the current frame
+ * @param[in]  count is the blob count
+ * @param[out] *motion points to a motion array
+ * @return     status code
+ *             - 0 success
+ *             - 2 prev, cur, blob or motion is NULL
+ * @note       every blob mask is dilated by one pixel to include its edge
+ */
+uint8_t amg8833_motion_estimate_blobs(int16_t prev[8][8], int16_t cur[8][8], const amg8833_blob_t *blob,
+                                      uint8_t count, amg8833_motion_t *motion);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
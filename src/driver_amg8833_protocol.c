@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_protocol.c
+ * @brief     driver amg8833 protocol source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_protocol.h"
+
+/**
+ * @brief crc16-ccitt nibble table
+ */
+static const uint16_t gs_crc16_table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+/**
+ * @brief     calculate the crc16-ccitt
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the data length
+ * @return    crc16 value
+ * @note      poly is 0x1021 and init value is 0xFFFF
+ */
+static uint16_t a_amg8833_protocol_crc16(const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t crc;
+    uint8_t k;
+    
+    crc = 0xFFFF;                                                                    /* init crc */
+    for (i = 0; i < len; i++)                                                        /* run len times */
+    {
+        k = (uint8_t)((crc >> 12) ^ (buf[i] >> 4));                                  /* high nibble index */
+        crc = (uint16_t)((crc << 4) ^ gs_crc16_table[k]);                            /* high nibble */
+        k = (uint8_t)((crc >> 12) ^ (buf[i] & 0xF));                                 /* low nibble index */
+        crc = (uint16_t)((crc << 4) ^ gs_crc16_table[k]);                            /* low nibble */
+    }
+    
+    return crc;                                                                      /* return crc */
+}
+
+/**
+ * @brief      cobs decode
+ * @param[in]  *in points to an encoded data buffer
+ * @param[in]  len is the encoded data length without the delimiter
+ * @param[out] *out points to a decoded data buffer
+ * @param[in]  size is the decoded data buffer size
+ * @param[out] *out_len points to a decoded data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ * @note       none
+ */
+static uint8_t a_amg8833_protocol_cobs_decode(const uint8_t *in, uint16_t len, uint8_t *out, uint16_t size, uint16_t *out_len)
+{
+    uint16_t i;
+    uint16_t n;
+    uint8_t code;
+    uint8_t k;
+    
+    i = 0;                                                  /* init index */
+    n = 0;                                                  /* init output length */
+    while (i < len)                                         /* decode all */
+    {
+        code = in[i];                                       /* get the code */
+        if ((code == 0) || ((uint16_t)(i + code) > len))    /* check the code */
+        {
+            return 1;                                       /* return error */
+        }
+        i++;                                                /* skip the code */
+        for (k = 1; k < code; k++)                          /* copy the block */
+        {
+            if (n >= size)                                  /* check the size */
+            {
+                return 1;                                   /* return error */
+            }
+            out[n++] = in[i++];                             /* copy data */
+        }
+        if ((code != 0xFF) && (i < len))                    /* implicit zero */
+        {
+            if (n >= size)                                  /* check the size */
+            {
+                return 1;                                   /* return error */
+            }
+            out[n++] = 0x00;                                /* append zero */
+        }
+    }
+    *out_len = n;                                           /* set the length */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief      encode a frame packet
+ * @param[in]  *frame points to a frame structure
+ * @param[in]  seq is the sequence number
+ * @param[out] *buf points to a packet buffer
+ * @param[in]  size is the packet buffer size
+ * @param[out] *len points to a packet length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 frame or buf is NULL
+ * @note       size must be at least AMG8833_PROTOCOL_MAX_PACKET_SIZE
+ */
+uint8_t amg8833_protocol_encode(const amg8833_frame_t *frame, uint16_t seq, uint8_t *buf, uint16_t size, uint16_t *len)
+{
+    uint8_t payload[AMG8833_PROTOCOL_PAYLOAD_SIZE];
+    uint16_t crc;
+    uint16_t i;
+    uint16_t n;
+    uint16_t code_index;
+    uint8_t code;
+    
+    if ((frame == NULL) || (buf == NULL))                                    /* check frame and buf */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (size < AMG8833_PROTOCOL_MAX_PACKET_SIZE)                             /* check size */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    payload[0] = AMG8833_PROTOCOL_TYPE_FRAME;                                /* set the type */
+    payload[1] = (uint8_t)(seq >> 0);                                        /* set the sequence lsb */
+    payload[2] = (uint8_t)(seq >> 8);                                        /* set the sequence msb */
+    payload[3] = frame->status;                                              /* set the status */
+    payload[4] = (uint8_t)((uint16_t)frame->thermistor >> 0);                /* set the thermistor lsb */
+    payload[5] = (uint8_t)((uint16_t)frame->thermistor >> 8);                /* set the thermistor msb */
+    memcpy(&payload[6], frame->raw, 128);                                    /* copy the pixels */
+    crc = a_amg8833_protocol_crc16(payload, 134);                            /* calculate the crc */
+    payload[134] = (uint8_t)(crc >> 0);                                      /* set the crc lsb */
+    payload[135] = (uint8_t)(crc >> 8);                                      /* set the crc msb */
+    
+    code_index = 0;                                                          /* first code position */
+    n = 1;                                                                   /* skip the code */
+    code = 1;                                                                /* init code */
+    for (i = 0; i < AMG8833_PROTOCOL_PAYLOAD_SIZE; i++)                      /* encode all */
+    {
+        if (payload[i] == 0x00)                                              /* if zero */
+        {
+            buf[code_index] = code;                                          /* close the block */
+            code_index = n++;                                                /* next code position */
+            code = 1;                                                        /* reset code */
+        }
+        else
+        {
+            buf[n++] = payload[i];                                           /* copy data */
+            code++;                                                          /* code++ */
+            if (code == 0xFF)                                                /* if full block */
+            {
+                buf[code_index] = code;                                      /* close the block */
+                code_index = n++;                                            /* next code position */
+                code = 1;                                                    /* reset code */
+            }
+        }
+    }
+    buf[code_index] = code;                                                  /* close the last block */
+    buf[n++] = 0x00;                                                         /* set the delimiter */
+    *len = n;                                                                /* set the length */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder points to a decoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ * @note      none
+ */
+uint8_t amg8833_protocol_decoder_init(amg8833_protocol_decoder_t *decoder)
+{
+    if (decoder == NULL)                                             /* check decoder */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    memset(decoder, 0, sizeof(amg8833_protocol_decoder_t));          /* clear the decoder */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief      decode the received stream
+ * @param[in]  *decoder points to a decoder structure
+ * @param[in]  *buf points to a received data buffer
+ * @param[in]  len is the received data length
+ * @param[out] *used points to a used length buffer
+ * @param[out] *frame points to a frame structure
+ * @param[out] *seq points to a sequence number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 2 decoder, buf, used, frame or seq is NULL
+ *             - 4 crc check failed
+ *             - 5 packet is invalid
+ * @note       decoding stops after each delimiter, so call it again with buf + used until all the data is used,
+ *             a sequence that restarts at 0 or goes backwards resyncs the decoder without counting lost frames
+ */
+uint8_t amg8833_protocol_decode(amg8833_protocol_decoder_t *decoder, const uint8_t *buf, uint16_t len, uint16_t *used,
+                                amg8833_frame_t *frame, uint16_t *seq)
+{
+    uint8_t payload[AMG8833_PROTOCOL_PAYLOAD_SIZE];
+    uint16_t i;
+    uint16_t n;
+    uint16_t crc;
+    uint16_t s;
+    uint16_t gap;
+    uint8_t overflow;
+    
+    if ((decoder == NULL) || (buf == NULL) || (used == NULL) ||
+        (frame == NULL) || (seq == NULL))                                                    /* check decoder */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                /* find the delimiter */
+    {
+        if (buf[i] != 0x00)                                                                  /* if not delimiter */
+        {
+            if (decoder->len < AMG8833_PROTOCOL_MAX_PACKET_SIZE)                             /* check the length */
+            {
+                decoder->buf[decoder->len++] = buf[i];                                       /* save data */
+            }
+            else
+            {
+                decoder->overflow = 1;                                                       /* set overflow */
+            }
+            
+            continue;                                                                        /* next byte */
+        }
+        
+        *used = (uint16_t)(i + 1);                                                           /* set the used length */
+        n = decoder->len;                                                                    /* save the length */
+        overflow = decoder->overflow;                                                        /* save the overflow */
+        decoder->len = 0;                                                                    /* reset length */
+        decoder->overflow = 0;                                                               /* reset overflow */
+        if (n == 0)                                                                          /* empty packet */
+        {
+            continue;                                                                        /* skip the delimiter */
+        }
+        if ((overflow != 0) ||                                                               /* check the overflow */
+            (a_amg8833_protocol_cobs_decode(decoder->buf, n, payload,                        /* cobs decode */
+                                            AMG8833_PROTOCOL_PAYLOAD_SIZE, &n) != 0) ||
+            (n != AMG8833_PROTOCOL_PAYLOAD_SIZE) ||                                          /* check the length */
+            (payload[0] != AMG8833_PROTOCOL_TYPE_FRAME))                                     /* check the type */
+        {
+            decoder->error_count++;                                                          /* error count++ */
+            
+            return 5;                                                                        /* return error */
+        }
+        crc = a_amg8833_protocol_crc16(payload, AMG8833_PROTOCOL_PAYLOAD_SIZE - 2);          /* calculate the crc */
+        if (crc != (uint16_t)(((uint16_t)payload[135] << 8) | payload[134]))                 /* check the crc */
+        {
+            decoder->error_count++;                                                          /* error count++ */
+            
+            return 4;                                                                        /* return error */
+        }
+        s = (uint16_t)(((uint16_t)payload[2] << 8) | payload[1]);                            /* get the sequence */
+        gap = (uint16_t)(s - decoder->seq - 1);                                              /* sequence gap */
+        if ((decoder->synced != 0) && (s != 0) && (gap < 0x8000U))                           /* if synced and not restarted */
+        {
+            decoder->lost_count += gap;                                                      /* add the sequence gap */
+        }
+        decoder->synced = 1;                                                                 /* set synced */
+        decoder->seq = s;                                                                    /* save the sequence */
+        decoder->frame_count++;                                                              /* frame count++ */
+        frame->status = payload[3];                                                          /* get the status */
+        frame->thermistor = (int16_t)(((uint16_t)payload[5] << 8) | payload[4]);             /* get the thermistor */
+        memcpy(frame->raw, &payload[6], 128);                                                /* get the pixels */
+        *seq = s;                                                                            /* set the sequence */
+        
+        return 0;                                                                            /* success return 0 */
+    }
+    *used = len;                                                                             /* all data is used */
+    
+    return 1;                                                                                /* need more data */
+}
+
+/**
+ * @brief      get the decoder statistics
+ * @param[in]  *decoder points to a decoder structure
+ * @param[out] *frame_count points to a decoded frame count buffer
+ * @param[out] *lost_count points to a lost frame count buffer
+ * @param[out] *error_count points to a corrupted packet count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder is NULL
+ * @note       lost frames are counted from the sequence gaps
+ */
+uint8_t amg8833_protocol_get_statistics(amg8833_protocol_decoder_t *decoder, uint32_t *frame_count,
+                                        uint32_t *lost_count, uint32_t *error_count)
+{
+    if (decoder == NULL)                             /* check decoder */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    *frame_count = decoder->frame_count;             /* get frame count */
+    *lost_count = decoder->lost_count;               /* get lost count */
+    *error_count = decoder->error_count;             /* get error count */
+    
+    return 0;                                        /* success return 0 */
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_protocol.h
+ * @brief     driver amg8833 protocol header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_PROTOCOL_H
+#define DRIVER_AMG8833_PROTOCOL_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_protocol_driver amg8833 protocol driver function
+ * @brief    amg8833 protocol driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 protocol definition
+ * @note  payload is type(1) + sequence(2) + status(1) + thermistor(2) + pixel(128) + crc16(2),
+ *        all the multi-byte fields are little endian and the crc is crc16-ccitt over type ... pixel,
+ *        the payload is cobs encoded and every packet is terminated by a 0x00 delimiter
+ */
+#define AMG8833_PROTOCOL_TYPE_FRAME              0x01        /**< frame packet type */
+#define AMG8833_PROTOCOL_PAYLOAD_SIZE            136         /**< payload size */
+#define AMG8833_PROTOCOL_MAX_PACKET_SIZE         138         /**< cobs encoded payload size with the delimiter */
+
+/**
+ * @brief amg8833 protocol decoder structure definition
+ */
+typedef struct amg8833_protocol_decoder_s
+{
+    uint8_t buf[AMG8833_PROTOCOL_MAX_PACKET_SIZE];        /**< packet buffer */
+    uint16_t len;                                         /**< packet buffer length */
+    uint8_t overflow;                                     /**< overflow flag */
+    uint8_t synced;                                       /**< sequence synced flag */
+    uint16_t seq;                                         /**< last sequence */
+    uint32_t frame_count;                                 /**< decoded frame count */
+    uint32_t lost_count;                                  /**< lost frame count */
+    uint32_t error_count;                                 /**< corrupted packet count */
+} amg8833_protocol_decoder_t;
+
+/**
+ * @brief      encode a frame packet
+ * @param[in]  *frame points to a frame structure
+ * @param[in]  seq is the sequence number
+ * @param[out] *buf points to a packet buffer
+ * @param[in]  size is the packet buffer size
+ * @param[out] *len points to a packet length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 frame or buf is NULL
+ * @note       size must be at least AMG8833_PROTOCOL_MAX_PACKET_SIZE
+ */
+uint8_t amg8833_protocol_encode(const amg8833_frame_t *frame, uint16_t seq, uint8_t *buf, uint16_t size, uint16_t *len);
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder points to a decoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ * @note      none
+ */
+uint8_t amg8833_protocol_decoder_init(amg8833_protocol_decoder_t *decoder);
+
+/**
+ * @brief      decode the received stream
+ * @param[in]  *decoder points to a decoder structure
+ * @param[in]  *buf points to a received data buffer
+ * @param[in]  len is the received data length
+ * @param[out] *used points to a used length buffer
+ * @param[out] *frame points to a frame structure
+ * @param[out] *seq points to a sequence number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 2 decoder, buf, used, frame or seq is NULL
+ *             - 4 crc check failed
+ *             - 5 packet is invalid
+ * @note       decoding stops after each delimiter, so call it again with buf + used until all the data is used,
+ *             a sequence that restarts at 0 or goes backwards resyncs the decoder without counting lost frames
+ */
+uint8_t amg8833_protocol_decode(amg8833_protocol_decoder_t *decoder, const uint8_t *buf, uint16_t len, uint16_t *used,
+                                amg8833_frame_t *frame, uint16_t *seq);
+
+/**
+ * @brief      get the decoder statistics
+ * @param[in]  *decoder points to a decoder structure
+ * @param[out] *frame_count points to a decoded frame count buffer
+ * @param[out] *lost_count points to a lost frame count buffer
+ * @param[out] *error_count points to a corrupted packet count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 decoder is NULL
+ * @note       lost frames are counted from the sequence gaps
+ */
+uint8_t amg8833_protocol_get_statistics(amg8833_protocol_decoder_t *decoder, uint32_t *frame_count,
+                                        uint32_t *lost_count, uint32_t *error_count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
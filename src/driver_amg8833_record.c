@@ -0,0 +1,728 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_record.c
+ * @brief     driver amg8833 record.ceader file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_record.h"
+
+/**
+ * @brief record block magic definition
+ */
+#define RECORD_MAGIC_0          'A'        /**< magic byte 0 */
+#define RECORD_MAGIC_1          'M'        /**< magic byte 1 */
+#define RECORD_MAGIC_2          'G'        /**< magic byte 2 */
+#define RECORD_MAGIC_3          'B'        /**< magic byte 3 */
+#define RECORD_VERSION          0x01       /**< block version */
+
+/**
+ * @brief record scan context structure definition
+ */
+typedef struct record_scan_s
+{
+    uint8_t index;                                           /**< queried pixel index */
+    int16_t min;                                             /**< pixel min */
+    int16_t max;                                             /**< pixel max */
+    int64_t sum;                                             /**< pixel sum */
+    uint32_t count;                                          /**< frame count */
+    int16_t threshold;                                       /**< threshold */
+    void (*callback)(const amg8833_frame_t *frame);          /**< threshold callback */
+} record_scan_t;
+
+/**
+ * @brief     write a little endian value
+ * @param[in] *buf points to a data buffer
+ * @param[in] value is the written value
+ * @param[in] bytes is the value bytes
+ * @note      none
+ */
+static void a_record_put(uint8_t *buf, uint64_t value, uint8_t bytes)
+{
+    uint8_t i;
+    
+    for (i = 0; i < bytes; i++)                                  /* lsb first */
+    {
+        buf[i] = (uint8_t)(value >> (i * 8));                    /* set the byte */
+    }
+}
+
+/**
+ * @brief     read a little endian value
+ * @param[in] *buf points to a data buffer
+ * @param[in] bytes is the value bytes
+ * @return    read value
+ * @note      none
+ */
+static uint64_t a_record_get(const uint8_t *buf, uint8_t bytes)
+{
+    uint64_t value;
+    
+    value = 0;                                                   /* init value */
+    while (bytes > 0)                                            /* msb first */
+    {
+        bytes--;                                                 /* next byte */
+        value = (value << 8) | buf[bytes];                       /* add the byte */
+    }
+    
+    return value;                                                /* return the value */
+}
+
+/**
+ * @brief      get the pixels of a frame
+ * @param[in]  *frame points to a frame structure
+ * @param[out] *pixel points to a pixel buffer
+ * @note       pixel[row * 8 + col] has the same orientation as amg8833_read_temperature_array
+ */
+static void a_record_get_pixel(const amg8833_frame_t *frame, int16_t pixel[64])
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)                                                                  /* run 64 times */
+    {
+        pixel[i] = amg8833_frame_get_pixel(frame, i);                                         /* get raw data */
+    }
+}
+
+/**
+ * @brief     encode a block header
+ * @param[in] *summary points to a summary structure
+ * @param[in] *buf points to a block header buffer
+ * @note      none
+ */
+static void a_record_encode_header(const amg8833_record_summary_t *summary, uint8_t *buf)
+{
+    uint8_t i;
+    
+    buf[0] = RECORD_MAGIC_0;                                                          /* set magic */
+    buf[1] = RECORD_MAGIC_1;                                                          /* set magic */
+    buf[2] = RECORD_MAGIC_2;                                                          /* set magic */
+    buf[3] = RECORD_MAGIC_3;                                                          /* set magic */
+    buf[4] = RECORD_VERSION;                                                          /* set version */
+    buf[5] = 0x00;                                                                    /* reserved */
+    a_record_put(&buf[6], summary->frame_count, 2);                                   /* set frame count */
+    a_record_put(&buf[8], summary->time_start, 8);                                    /* set time start */
+    a_record_put(&buf[16], summary->time_end, 8);                                     /* set time end */
+    a_record_put(&buf[24], (uint16_t)summary->frame_max_low, 2);                      /* set frame max low */
+    a_record_put(&buf[26], (uint16_t)summary->frame_max_high, 2);                     /* set frame max high */
+    a_record_put(&buf[28], (uint16_t)summary->frame_min_low, 2);                      /* set frame min low */
+    a_record_put(&buf[30], (uint16_t)summary->frame_min_high, 2);                     /* set frame min high */
+    a_record_put(&buf[32], (uint16_t)summary->thermistor_min, 2);                     /* set thermistor min */
+    a_record_put(&buf[34], (uint16_t)summary->thermistor_max, 2);                     /* set thermistor max */
+    a_record_put(&buf[36], (uint32_t)summary->frame_sum_low, 4);                      /* set frame sum low */
+    a_record_put(&buf[40], (uint32_t)summary->frame_sum_high, 4);                     /* set frame sum high */
+    a_record_put(&buf[44], summary->interrupt_frames, 2);                             /* set interrupt frames */
+    a_record_put(&buf[46], 0, 2);                                                     /* reserved */
+    memcpy(&buf[48], summary->interrupt, 8);                                          /* set interrupt */
+    for (i = 0; i < 64; i++)                                                          /* run 64 times */
+    {
+        a_record_put(&buf[56 + i * 2], (uint16_t)summary->pixel_min[i], 2);           /* set pixel min */
+        a_record_put(&buf[184 + i * 2], (uint16_t)summary->pixel_max[i], 2);          /* set pixel max */
+        a_record_put(&buf[312 + i * 4], (uint32_t)summary->pixel_sum[i], 4);          /* set pixel sum */
+    }
+}
+
+/**
+ * @brief      scan the frames of a block
+ * @param[in]  *reader points to a reader structure
+ * @param[in]  *block points to a block structure
+ * @param[in]  time_start is the first timestamp
+ * @param[in]  time_end is the last timestamp
+ * @param[in]  *scan points to a scan context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       frames are read in pieces when the buffer is smaller than the block
+ */
+static uint8_t a_record_scan_block(amg8833_record_reader_t *reader, const amg8833_record_block_t *block,
+                                   uint64_t time_start, uint64_t time_end, record_scan_t *scan)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t j;
+    uint32_t piece;
+    uint64_t offset;
+    amg8833_frame_t frame;
+    int16_t pixel[64];
+    int16_t max;
+    uint8_t k;
+    
+    piece = reader->buf_size / AMG8833_RECORD_FRAME_SIZE;                                        /* frames per read */
+    if (piece == 0)                                                                              /* check the buffer */
+    {
+        return 1;                                                                                /* return error */
+    }
+    offset = block->offset + AMG8833_RECORD_HEADER_SIZE;                                         /* first frame */
+    reader->decoded_blocks++;                                                                    /* decoded blocks++ */
+    for (i = 0; i < block->summary.frame_count; i += n)                                          /* read all frames */
+    {
+        n = block->summary.frame_count - i;                                                      /* remaining frames */
+        if (n > piece)                                                                           /* check the piece */
+        {
+            n = piece;                                                                           /* limit the frames */
+        }
+        if (reader->read(offset + (uint64_t)i * AMG8833_RECORD_FRAME_SIZE,                       /* read frames */
+                         reader->buf, n * AMG8833_RECORD_FRAME_SIZE) != 0)
+        {
+            return 1;                                                                            /* return error */
+        }
+        for (j = 0; j < n; j++)                                                                  /* check all frames */
+        {
+            amg8833_record_decode_frame(&reader->buf[j * AMG8833_RECORD_FRAME_SIZE], &frame);    /* decode the frame */
+            if ((frame.timestamp < time_start) || (frame.timestamp > time_end))                  /* check the time */
+            {
+                continue;                                                                        /* skip the frame */
+            }
+            a_record_get_pixel(&frame, pixel);                                                   /* get the pixels */
+            if (scan->callback != NULL)                                                          /* threshold query */
+            {
+                max = pixel[0];                                                                  /* init max */
+                for (k = 1; k < 64; k++)                                                         /* find the max */
+                {
+                    if (pixel[k] > max)                                                          /* check max */
+                    {
+                        max = pixel[k];                                                          /* update max */
+                    }
+                }
+                if (max > scan->threshold)                                                       /* check the threshold */
+                {
+                    scan->callback(&frame);                                                      /* run the callback */
+                }
+            }
+            else                                                                                 /* pixel query */
+            {
+                if (pixel[scan->index] < scan->min)                                              /* check min */
+                {
+                    scan->min = pixel[scan->index];                                              /* update min */
+                }
+                if (pixel[scan->index] > scan->max)                                              /* check max */
+                {
+                    scan->max = pixel[scan->index];                                              /* update max */
+                }
+                scan->sum += pixel[scan->index];                                                 /* update sum */
+                scan->count++;                                                                   /* count++ */
+            }
+        }
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      encode a frame record
+ * @param[in]  *frame points to a frame structure
+ * @param[out] *buf points to a record buffer
+ * @note       buf must hold AMG8833_RECORD_FRAME_SIZE bytes
+ */
+void amg8833_record_encode_frame(const amg8833_frame_t *frame, uint8_t *buf)
+{
+    a_record_put(&buf[0], frame->timestamp, 8);                        /* set timestamp */
+    memcpy(&buf[8], frame->raw, 128);                                  /* set pixel registers */
+    a_record_put(&buf[136], (uint16_t)frame->thermistor, 2);           /* set thermistor */
+    buf[138] = frame->status;                                          /* set status */
+    buf[139] = frame->addr;                                            /* set addr */
+    memcpy(&buf[140], frame->interrupt, 8);                            /* set interrupt */
+}
+
+/**
+ * @brief      decode a frame record
+ * @param[in]  *buf points to a record buffer
+ * @param[out] *frame points to a frame structure
+ * @note       none
+ */
+void amg8833_record_decode_frame(const uint8_t *buf, amg8833_frame_t *frame)
+{
+    frame->timestamp = a_record_get(&buf[0], 8);                       /* get timestamp */
+    memcpy(frame->raw, &buf[8], 128);                                  /* get pixel registers */
+    frame->thermistor = (int16_t)a_record_get(&buf[136], 2);           /* get thermistor */
+    frame->status = buf[138];                                          /* get status */
+    frame->addr = buf[139];                                            /* get addr */
+    memcpy(frame->interrupt, &buf[140], 8);                            /* get interrupt */
+}
+
+/**
+ * @brief     clear a summary
+ * @param[in] *summary points to a summary structure
+ * @note      none
+ */
+void amg8833_record_summary_clear(amg8833_record_summary_t *summary)
+{
+    memset(summary, 0, sizeof(amg8833_record_summary_t));        /* clear the summary */
+}
+
+/**
+ * @brief     add a frame to a summary
+ * @param[in] *summary points to a summary structure
+ * @param[in] *frame points to a frame structure
+ * @note      none
+ */
+void amg8833_record_summary_add(amg8833_record_summary_t *summary, const amg8833_frame_t *frame)
+{
+    uint8_t i;
+    uint8_t irq;
+    int16_t pixel[64];
+    int16_t thermistor;
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+    
+    a_record_get_pixel(frame, pixel);                                               /* get the pixels */
+    if ((frame->thermistor & (1 << 11)) != 0)                                       /* if negative */
+    {
+        thermistor = (int16_t)(-(frame->thermistor & 0x7FF));                       /* get negative value */
+    }
+    else
+    {
+        thermistor = (int16_t)(frame->thermistor & 0x7FF);                          /* get positive value */
+    }
+    min = pixel[0];                                                                 /* init min */
+    max = pixel[0];                                                                 /* init max */
+    sum = 0;                                                                        /* init sum */
+    irq = (frame->status & (1 << AMG8833_STATUS_INTF)) != 0 ? 1 : 0;                /* check the interrupt flag */
+    for (i = 0; i < 64; i++)                                                        /* run 64 times */
+    {
+        if (pixel[i] < min)                                                         /* check frame min */
+        {
+            min = pixel[i];                                                         /* update frame min */
+        }
+        if (pixel[i] > max)                                                         /* check frame max */
+        {
+            max = pixel[i];                                                         /* update frame max */
+        }
+        sum += pixel[i];                                                            /* update frame sum */
+    }
+    for (i = 0; i < 8; i++)                                                         /* run 8 times */
+    {
+        irq |= (frame->interrupt[i] != 0) ? 1 : 0;                                  /* check the interrupt table */
+        summary->interrupt[i] |= frame->interrupt[i];                               /* or the interrupt table */
+    }
+    if (summary->frame_count == 0)                                                  /* first frame */
+    {
+        summary->time_start = frame->timestamp;                                     /* set time start */
+        summary->frame_max_low = max;                                               /* init frame max low */
+        summary->frame_max_high = max;                                              /* init frame max high */
+        summary->frame_min_low = min;                                               /* init frame min low */
+        summary->frame_min_high = min;                                              /* init frame min high */
+        summary->frame_sum_low = sum;                                               /* init frame sum low */
+        summary->frame_sum_high = sum;                                              /* init frame sum high */
+        summary->thermistor_min = thermistor;                                       /* init thermistor min */
+        summary->thermistor_max = thermistor;                                       /* init thermistor max */
+        for (i = 0; i < 64; i++)                                                    /* run 64 times */
+        {
+            summary->pixel_min[i] = pixel[i];                                       /* init pixel min */
+            summary->pixel_max[i] = pixel[i];                                       /* init pixel max */
+            summary->pixel_sum[i] = 0;                                              /* init pixel sum */
+        }
+    }
+    summary->time_end = frame->timestamp;                                           /* set time end */
+    if (max < summary->frame_max_low)                                               /* check frame max low */
+    {
+        summary->frame_max_low = max;                                               /* update frame max low */
+    }
+    if (max > summary->frame_max_high)                                              /* check frame max high */
+    {
+        summary->frame_max_high = max;                                              /* update frame max high */
+    }
+    if (min < summary->frame_min_low)                                               /* check frame min low */
+    {
+        summary->frame_min_low = min;                                               /* update frame min low */
+    }
+    if (min > summary->frame_min_high)                                              /* check frame min high */
+    {
+        summary->frame_min_high = min;                                              /* update frame min high */
+    }
+    if (sum < summary->frame_sum_low)                                               /* check frame sum low */
+    {
+        summary->frame_sum_low = sum;                                               /* update frame sum low */
+    }
+    if (sum > summary->frame_sum_high)                                              /* check frame sum high */
+    {
+        summary->frame_sum_high = sum;                                              /* update frame sum high */
+    }
+    if (thermistor < summary->thermistor_min)                                       /* check thermistor min */
+    {
+        summary->thermistor_min = thermistor;                                       /* update thermistor min */
+    }
+    if (thermistor > summary->thermistor_max)                                       /* check thermistor max */
+    {
+        summary->thermistor_max = thermistor;                                       /* update thermistor max */
+    }
+    for (i = 0; i < 64; i++)                                                        /* run 64 times */
+    {
+        if (pixel[i] < summary->pixel_min[i])                                       /* check pixel min */
+        {
+            summary->pixel_min[i] = pixel[i];                                       /* update pixel min */
+        }
+        if (pixel[i] > summary->pixel_max[i])                                       /* check pixel max */
+        {
+            summary->pixel_max[i] = pixel[i];                                       /* update pixel max */
+        }
+        summary->pixel_sum[i] += pixel[i];                                          /* update pixel sum */
+    }
+    summary->interrupt_frames += irq;                                               /* update interrupt frames */
+    summary->frame_count++;                                                         /* frame count++ */
+}
+
+/**
+ * @brief     initialize the writer
+ * @param[in] *writer points to a writer structure
+ * @param[in] *buf points to a block buffer
+ * @param[in] block_frames is the frames per block
+ * @param[in] *write points to a write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 writer is NULL
+ *            - 5 block_frames is invalid
+ * @note      buf must hold AMG8833_RECORD_HEADER_SIZE + block_frames * AMG8833_RECORD_FRAME_SIZE bytes
+ */
+uint8_t amg8833_record_writer_init(amg8833_record_writer_t *writer, uint8_t *buf, uint16_t block_frames,
+                                   uint8_t (*write)(const uint8_t *buf, uint32_t len))
+{
+    if ((writer == NULL) || (buf == NULL) || (write == NULL))        /* check writer */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (block_frames == 0)                                           /* check block_frames */
+    {
+        return 5;                                                    /* return error */
+    }
+    
+    writer->write = write;                                           /* set write */
+    writer->buf = buf;                                               /* set buf */
+    writer->block_frames = block_frames;                             /* set block frames */
+    amg8833_record_summary_clear(&writer->summary);                  /* clear summary */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     write a frame
+ * @param[in] *writer points to a writer structure
+ * @param[in] *frame points to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ * @note      a block is written as soon as it is full
+ */
+uint8_t amg8833_record_write(amg8833_record_writer_t *writer, const amg8833_frame_t *frame)
+{
+    if ((writer == NULL) || (frame == NULL))                                                 /* check writer */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    amg8833_record_encode_frame(frame, &writer->buf[AMG8833_RECORD_HEADER_SIZE +             /* encode the frame */
+                                (uint32_t)writer->summary.frame_count * AMG8833_RECORD_FRAME_SIZE]);
+    amg8833_record_summary_add(&writer->summary, frame);                                     /* add to the summary */
+    if (writer->summary.frame_count >= writer->block_frames)                                 /* check the block */
+    {
+        return amg8833_record_flush(writer);                                                 /* write the block */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     write the current partial block
+ * @param[in] *writer points to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_flush(amg8833_record_writer_t *writer)
+{
+    uint32_t len;
+    
+    if (writer == NULL)                                                                      /* check writer */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (writer->summary.frame_count == 0)                                                    /* check the block */
+    {
+        return 0;                                                                            /* nothing to write */
+    }
+    
+    a_record_encode_header(&writer->summary, writer->buf);                                   /* encode the header */
+    len = AMG8833_RECORD_HEADER_SIZE +
+          (uint32_t)writer->summary.frame_count * AMG8833_RECORD_FRAME_SIZE;                 /* set the length */
+    amg8833_record_summary_clear(&writer->summary);                                          /* start a new block */
+    if (writer->write(writer->buf, len) != 0)                                                /* write the block */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      parse a block header
+ * @param[in]  *buf points to a block header buffer
+ * @param[out] *summary points to a summary structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 header is invalid
+ * @note       buf must hold AMG8833_RECORD_HEADER_SIZE bytes
+ */
+uint8_t amg8833_record_parse_header(const uint8_t *buf, amg8833_record_summary_t *summary)
+{
+    uint8_t i;
+    
+    if ((buf[0] != RECORD_MAGIC_0) || (buf[1] != RECORD_MAGIC_1) ||
+        (buf[2] != RECORD_MAGIC_2) || (buf[3] != RECORD_MAGIC_3))                         /* check magic */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (buf[4] != RECORD_VERSION)                                                         /* check version */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    summary->frame_count = (uint16_t)a_record_get(&buf[6], 2);                            /* get frame count */
+    summary->time_start = a_record_get(&buf[8], 8);                                       /* get time start */
+    summary->time_end = a_record_get(&buf[16], 8);                                        /* get time end */
+    summary->frame_max_low = (int16_t)a_record_get(&buf[24], 2);                          /* get frame max low */
+    summary->frame_max_high = (int16_t)a_record_get(&buf[26], 2);                         /* get frame max high */
+    summary->frame_min_low = (int16_t)a_record_get(&buf[28], 2);                          /* get frame min low */
+    summary->frame_min_high = (int16_t)a_record_get(&buf[30], 2);                         /* get frame min high */
+    summary->thermistor_min = (int16_t)a_record_get(&buf[32], 2);                         /* get thermistor min */
+    summary->thermistor_max = (int16_t)a_record_get(&buf[34], 2);                         /* get thermistor max */
+    summary->frame_sum_low = (int32_t)a_record_get(&buf[36], 4);                          /* get frame sum low */
+    summary->frame_sum_high = (int32_t)a_record_get(&buf[40], 4);                         /* get frame sum high */
+    summary->interrupt_frames = (uint16_t)a_record_get(&buf[44], 2);                      /* get interrupt frames */
+    memcpy(summary->interrupt, &buf[48], 8);                                              /* get interrupt */
+    for (i = 0; i < 64; i++)                                                              /* run 64 times */
+    {
+        summary->pixel_min[i] = (int16_t)a_record_get(&buf[56 + i * 2], 2);               /* get pixel min */
+        summary->pixel_max[i] = (int16_t)a_record_get(&buf[184 + i * 2], 2);              /* get pixel max */
+        summary->pixel_sum[i] = (int32_t)a_record_get(&buf[312 + i * 4], 4);              /* get pixel sum */
+    }
+    if (summary->frame_count == 0)                                                        /* check frame count */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize the reader and build the block index
+ * @param[in] *reader points to a reader structure
+ * @param[in] *block points to a block index buffer
+ * @param[in] block_max is the block index size
+ * @param[in] *buf points to a frame records buffer
+ * @param[in] buf_size is the frame records buffer size
+ * @param[in] *read points to a read function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 reader is NULL
+ *            - 4 block index is full
+ * @note      only the block headers are read, the read function returns non zero at the end of the recording
+ */
+uint8_t amg8833_record_reader_init(amg8833_record_reader_t *reader, amg8833_record_block_t *block, uint32_t block_max,
+                                   uint8_t *buf, uint32_t buf_size,
+                                   uint8_t (*read)(uint64_t offset, uint8_t *buf, uint32_t len))
+{
+    uint64_t offset;
+    
+    if ((reader == NULL) || (block == NULL) || (buf == NULL) || (read == NULL))                  /* check reader */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (buf_size < AMG8833_RECORD_HEADER_SIZE)                                                   /* check buf_size */
+    {
+        return 1;                                                                                /* return error */
+    }
+    
+    reader->read = read;                                                                         /* set read */
+    reader->block = block;                                                                       /* set block */
+    reader->block_max = block_max;                                                               /* set block max */
+    reader->block_count = 0;                                                                     /* init block count */
+    reader->buf = buf;                                                                           /* set buf */
+    reader->buf_size = buf_size;                                                                 /* set buf size */
+    reader->decoded_blocks = 0;                                                                  /* init decoded blocks */
+    offset = 0;                                                                                  /* first block */
+    while (reader->read(offset, reader->buf, AMG8833_RECORD_HEADER_SIZE) == 0)                   /* read the header */
+    {
+        if (reader->block_count >= reader->block_max)                                            /* check the index */
+        {
+            return 4;                                                                            /* return error */
+        }
+        if (amg8833_record_parse_header(reader->buf,
+                                        &reader->block[reader->block_count].summary) != 0)       /* parse the header */
+        {
+            return 1;                                                                            /* return error */
+        }
+        reader->block[reader->block_count].offset = offset;                                      /* set the offset */
+        offset += AMG8833_RECORD_HEADER_SIZE +
+                  (uint64_t)reader->block[reader->block_count].summary.frame_count *
+                  AMG8833_RECORD_FRAME_SIZE;                                                     /* next block */
+        reader->block_count++;                                                                   /* block count++ */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      query one pixel in a time range
+ * @param[in]  *reader points to a reader structure
+ * @param[in]  time_start is the first timestamp
+ * @param[in]  time_end is the last timestamp
+ * @param[in]  row is the pixel row
+ * @param[in]  col is the pixel col
+ * @param[out] *min points to a min raw data buffer
+ * @param[out] *max points to a max raw data buffer
+ * @param[out] *mean points to a mean raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 reader is NULL
+ *             - 4 no frame in the range
+ *             - 5 param is invalid
+ * @note       blocks inside the range are answered from the summary, only blocks on the range border are decoded
+ */
+uint8_t amg8833_record_query_pixel(amg8833_record_reader_t *reader, uint64_t time_start, uint64_t time_end,
+                                   uint8_t row, uint8_t col, int16_t *min, int16_t *max, float *mean)
+{
+    uint32_t i;
+    record_scan_t scan;
+    const amg8833_record_summary_t *summary;
+    
+    if (reader == NULL)                                                                              /* check reader */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if ((row > 7) || (col > 7) || (time_start > time_end))                                           /* check param */
+    {
+        return 5;                                                                                    /* return error */
+    }
+    
+    memset(&scan, 0, sizeof(record_scan_t));                                                         /* clear the scan */
+    scan.index = (uint8_t)(row * 8 + col);                                                           /* set the index */
+    scan.min = 0x7FFF;                                                                               /* init min */
+    scan.max = -0x7FFF - 1;                                                                          /* init max */
+    reader->decoded_blocks = 0;                                                                      /* init decoded blocks */
+    for (i = 0; i < reader->block_count; i++)                                                        /* check all blocks */
+    {
+        summary = &reader->block[i].summary;                                                         /* get the summary */
+        if ((summary->time_end < time_start) || (summary->time_start > time_end))                    /* out of the range */
+        {
+            continue;                                                                                /* skip the block */
+        }
+        if ((summary->time_start >= time_start) && (summary->time_end <= time_end))                  /* inside the range */
+        {
+            if (summary->pixel_min[scan.index] < scan.min)                                           /* check min */
+            {
+                scan.min = summary->pixel_min[scan.index];                                           /* update min */
+            }
+            if (summary->pixel_max[scan.index] > scan.max)                                           /* check max */
+            {
+                scan.max = summary->pixel_max[scan.index];                                           /* update max */
+            }
+            scan.sum += summary->pixel_sum[scan.index];                                              /* update sum */
+            scan.count += summary->frame_count;                                                      /* update count */
+        }
+        else
+        {
+            if (a_record_scan_block(reader, &reader->block[i], time_start, time_end, &scan) != 0)    /* scan the block */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+    }
+    if (scan.count == 0)                                                                             /* check the count */
+    {
+        return 4;                                                                                    /* return error */
+    }
+    *min = scan.min;                                                                                 /* set min */
+    *max = scan.max;                                                                                 /* set max */
+    *mean = (float)scan.sum / (float)scan.count;                                                     /* set mean */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     query the frames whose max exceeds a threshold
+ * @param[in] *reader points to a reader structure
+ * @param[in] time_start is the first timestamp
+ * @param[in] time_end is the last timestamp
+ * @param[in] threshold is the raw data threshold
+ * @param[in] *callback points to a callback function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 reader is NULL
+ *            - 5 param is invalid
+ * @note      blocks whose highest frame maximum is not above the threshold are skipped without decoding
+ */
+uint8_t amg8833_record_query_threshold(amg8833_record_reader_t *reader, uint64_t time_start, uint64_t time_end,
+                                       int16_t threshold, void (*callback)(const amg8833_frame_t *frame))
+{
+    uint32_t i;
+    record_scan_t scan;
+    const amg8833_record_summary_t *summary;
+    
+    if (reader == NULL)                                                                          /* check reader */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if ((callback == NULL) || (time_start > time_end))                                           /* check param */
+    {
+        return 5;                                                                                /* return error */
+    }
+    
+    memset(&scan, 0, sizeof(record_scan_t));                                                     /* clear the scan */
+    scan.threshold = threshold;                                                                  /* set the threshold */
+    scan.callback = callback;                                                                    /* set the callback */
+    reader->decoded_blocks = 0;                                                                  /* init decoded blocks */
+    for (i = 0; i < reader->block_count; i++)                                                    /* check all blocks */
+    {
+        summary = &reader->block[i].summary;                                                     /* get the summary */
+        if ((summary->time_end < time_start) || (summary->time_start > time_end))                /* out of the range */
+        {
+            continue;                                                                            /* skip the block */
+        }
+        if (summary->frame_max_high <= threshold)                                                /* no frame above */
+        {
+            continue;                                                                            /* skip the block */
+        }
+        if (a_record_scan_block(reader, &reader->block[i], time_start, time_end, &scan) != 0)    /* scan the block */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
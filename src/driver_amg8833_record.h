@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_record.h
+ * @brief     driver amg8833 record header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_RECORD_H
+#define DRIVER_AMG8833_RECORD_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_record_driver amg8833 record driver function
+ * @brief    amg8833 record driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 record definition
+ * @note  a recording is a sequence of blocks, every block is a block header with the zone map summary
+ *        followed by frame_count frame records, all the multi-byte fields are little endian,
+ *        a frame record is timestamp(8) + pixel registers(128) + thermistor(2) + status(1) + addr(1) + interrupt(8)
+ */
+#define AMG8833_RECORD_FRAME_SIZE            148           /**< frame record size */
+#define AMG8833_RECORD_HEADER_SIZE           568           /**< block header size */
+#define AMG8833_RECORD_DEFAULT_BLOCK_FRAMES  256           /**< default frames per block */
+
+/**
+ * @brief amg8833 record summary structure definition
+ * @note  pixels are in amg8833_read_temperature_array order with index row * 8 + col,
+ *        pixel values are raw data (0.25C/LSB) and thermistor values are signed raw data (0.0625C/LSB)
+ */
+typedef struct amg8833_record_summary_s
+{
+    uint64_t time_start;              /**< first frame timestamp */
+    uint64_t time_end;                /**< last frame timestamp */
+    uint16_t frame_count;             /**< frame count */
+    uint16_t interrupt_frames;        /**< frames with an interrupt */
+    int16_t frame_max_low;            /**< lowest frame maximum */
+    int16_t frame_max_high;           /**< highest frame maximum */
+    int16_t frame_min_low;            /**< lowest frame minimum */
+    int16_t frame_min_high;           /**< highest frame minimum */
+    int32_t frame_sum_low;            /**< lowest frame pixel sum, mean is sum / 64 */
+    int32_t frame_sum_high;           /**< highest frame pixel sum, mean is sum / 64 */
+    int16_t thermistor_min;           /**< min thermistor */
+    int16_t thermistor_max;           /**< max thermistor */
+    uint8_t interrupt[8];             /**< or of all interrupt tables */
+    int16_t pixel_min[64];            /**< per pixel min */
+    int16_t pixel_max[64];            /**< per pixel max */
+    int32_t pixel_sum[64];            /**< per pixel sum, mean is sum / frame_count */
+} amg8833_record_summary_t;
+
+/**
+ * @brief amg8833 record block structure definition
+ */
+typedef struct amg8833_record_block_s
+{
+    uint64_t offset;                        /**< block header offset in the recording */
+    amg8833_record_summary_t summary;       /**< block summary */
+} amg8833_record_block_t;
+
+/**
+ * @brief amg8833 record writer structure definition
+ */
+typedef struct amg8833_record_writer_s
+{
+    uint8_t (*write)(const uint8_t *buf, uint32_t len);        /**< point to a write function address */
+    uint8_t *buf;                                              /**< block buffer */
+    uint16_t block_frames;                                     /**< frames per block */
+    amg8833_record_summary_t summary;                          /**< current block summary */
+} amg8833_record_writer_t;
+
+/**
+ * @brief amg8833 record reader structure definition
+ */
+typedef struct amg8833_record_reader_s
+{
+    uint8_t (*read)(uint64_t offset, uint8_t *buf, uint32_t len);        /**< point to a read function address */
+    amg8833_record_block_t *block;                                       /**< block index */
+    uint32_t block_max;                                                  /**< block index size */
+    uint32_t block_count;                                                /**< indexed block count */
+    uint8_t *buf;                                                        /**< frame records buffer */
+    uint32_t buf_size;                                                   /**< frame records buffer size */
+    uint32_t decoded_blocks;                                             /**< blocks decoded by the last query */
+} amg8833_record_reader_t;
+
+/**
+ * @brief      encode a frame record
+ * @param[in]  *frame points to a frame structure
+ * @param[out] *buf points to a record buffer
+ * @note       buf must hold AMG8833_RECORD_FRAME_SIZE bytes
+ */
+void amg8833_record_encode_frame(const amg8833_frame_t *frame, uint8_t *buf);
+
+/**
+ * @brief      decode a frame record
+ * @param[in]  *buf points to a record buffer
+ * @param[out] *frame points to a frame structure
+ * @note       none
+ */
+void amg8833_record_decode_frame(const uint8_t *buf, amg8833_frame_t *frame);
+
+/**
+ * @brief     clear a summary
+ * @param[in] *summary points to a summary structure
+ * @note      none
+ */
+void amg8833_record_summary_clear(amg8833_record_summary_t *summary);
+
+/**
+ * @brief     add a frame to a summary
+ * @param[in] *summary points to a summary structure
+ * @param[in] *frame points to a frame structure
+ * @note      none
+ */
+void amg8833_record_summary_add(amg8833_record_summary_t *summary, const amg8833_frame_t *frame);
+
+/**
+ * @brief     initialize the writer
+ * @param[in] *writer points to a writer structure
+ * @param[in] *buf points to a block buffer
+ * @param[in] block_frames is the frames per block
+ * @param[in] *write points to a write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 writer is NULL
+ *            - 5 block_frames is invalid
+ * @note      buf must hold AMG8833_RECORD_HEADER_SIZE + block_frames * AMG8833_RECORD_FRAME_SIZE bytes
+ */
+uint8_t amg8833_record_writer_init(amg8833_record_writer_t *writer, uint8_t *buf, uint16_t block_frames,
+                                   uint8_t (*write)(const uint8_t *buf, uint32_t len));
+
+/**
+ * @brief     write a frame
+ * @param[in] *writer points to a writer structure
+ * @param[in] *frame points to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ * @note      a block is written as soon as it is full
+ */
+uint8_t amg8833_record_write(amg8833_record_writer_t *writer, const amg8833_frame_t *frame);
+
+/**
+ * @brief     write the current partial block
+ * @param[in] *writer points to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 writer is NULL
+ * @note      none
+ */
+uint8_t amg8833_record_flush(amg8833_record_writer_t *writer);
+
+/**
+ * @brief      parse a block header
+ * @param[in]  *buf points to a block header buffer
+ * @param[out] *summary points to a summary structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 header is invalid
+ * @note       buf must hold AMG8833_RECORD_HEADER_SIZE bytes
+ */
+uint8_t amg8833_record_parse_header(const uint8_t *buf, amg8833_record_summary_t *summary);
+
+/**
+ * @brief     initialize the reader and build the block index
+ * @param[in] *reader points to a reader structure
+ * @param[in] *block points to a block index buffer
+ * @param[in] block_max is the block index size
+ * @param[in] *buf points to a frame records buffer
+ * @param[in] buf_size is the frame records buffer size
+ * @param[in] *read points to a read function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 reader is NULL
+ *            - 4 block index is full
+ * @note      only the block headers are read, the read function returns non zero at the end of the recording
+ */
+uint8_t amg8833_record_reader_init(amg8833_record_reader_t *reader, amg8833_record_block_t *block, uint32_t block_max,
+                                   uint8_t *buf, uint32_t buf_size,
+                                   uint8_t (*read)(uint64_t offset, uint8_t *buf, uint32_t len));
+
+/**
+ * @brief      query one pixel in a time range
+ * @param[in]  *reader points to a reader structure
+ * @param[in]  time_start is the first timestamp
+ * @param[in]  time_end is the last timestamp
+ * @param[in]  row is the pixel row
+ * @param[in]  col is the pixel col
+ * @param[out] *min points to a min raw data buffer
+ * @param[out] *max points to a max raw data buffer
+ * @param[out] *mean points to a mean raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 reader is NULL
+ *             - 4 no frame in the range
+ *             - 5 param is invalid
+ * @note       blocks inside the range are answered from the summary, only blocks on the range border are decoded
+ */
+uint8_t amg8833_record_query_pixel(amg8833_record_reader_t *reader, uint64_t time_start, uint64_t time_end,
+                                   uint8_t row, uint8_t col, int16_t *min, int16_t *max, float *mean);
+
+/**
+ * @brief     query the frames whose max exceeds a threshold
+ * @param[in] *reader points to a reader structure
+ * @param[in] time_start is the first timestamp
+ * @param[in] time_end is the last timestamp
+ * @param[in] threshold is the raw data threshold
+ * @param[in] *callback points to a callback function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 reader is NULL
+ *            - 5 param is invalid
+ * @note      blocks whose highest frame maximum is not above the threshold are skipped without decoding
+ */
+uint8_t amg8833_record_query_threshold(amg8833_record_reader_t *reader, uint64_t time_start, uint64_t time_end,
+                                       int16_t threshold, void (*callback)(const amg8833_frame_t *frame));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
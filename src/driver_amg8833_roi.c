@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_roi.c
+ * @brief     driver amg8833 roi source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_roi.h"
+
+/**
+ * @brief      compile a roi
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  *weight points to a 64 weights array
+ * @param[in]  threshold is the count threshold raw data
+ * @param[out] *id points to a roi id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 set is full
+ *             - 5 weight is empty
+ * @note       none
+ */
+static uint8_t a_roi_add(amg8833_roi_set_t *set, const uint8_t *weight, int16_t threshold, uint16_t *id)
+{
+    amg8833_roi_t *roi;
+    uint32_t sum;
+    uint8_t len;
+    uint8_t i;
+    
+    len = 0;                                                                       /* init 0 */
+    for (i = 0; i < 64; i++)                                                       /* count the pixels */
+    {
+        len = (uint8_t)(len + (weight[i] != 0));                                   /* non zero weight */
+    }
+    if (len == 0)                                                                  /* check the roi */
+    {
+        return 5;                                                                  /* return error */
+    }
+    if ((set->roi_count >= set->roi_max) ||
+        (set->pool_size - set->pool_used < len))                                   /* check the space */
+    {
+        return 4;                                                                  /* return error */
+    }
+    
+    roi = &set->roi[set->roi_count];                                               /* new roi */
+    roi->start = set->pool_used;                                                   /* first entry */
+    roi->len = len;                                                                /* entries */
+    roi->threshold = threshold;                                                    /* set the threshold */
+    sum = 0;                                                                       /* init 0 */
+    for (i = 0; i < 64; i++)                                                       /* pack the pixels */
+    {
+        if (weight[i] != 0)                                                        /* in the roi */
+        {
+            set->index[set->pool_used] = i;                                        /* pixel index */
+            set->weight[set->pool_used] = weight[i];                               /* pixel weight */
+            set->pool_used++;                                                      /* next entry */
+            sum += weight[i];                                                      /* weight sum */
+        }
+    }
+    roi->weight_sum = sum;                                                         /* set the weight sum */
+    *id = set->roi_count;                                                          /* set the id */
+    set->roi_count++;                                                              /* count */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     initialize the roi set
+ * @param[in] *set points to a roi set structure
+ * @param[in] *roi points to a roi array
+ * @param[in] roi_max is the roi array size
+ * @param[in] *index points to a pixel index pool
+ * @param[in] *weight points to a pixel weight pool
+ * @param[in] pool_size is the pool size
+ * @return    status code
+ *            - 0 success
+ *            - 2 set, roi, index or weight is NULL
+ * @note      a roi uses one pool entry of each pool per pixel
+ */
+uint8_t amg8833_roi_init(amg8833_roi_set_t *set, amg8833_roi_t *roi, uint16_t roi_max,
+                         uint8_t *index, uint8_t *weight, uint32_t pool_size)
+{
+    if ((set == NULL) || (roi == NULL) || (index == NULL) || (weight == NULL))        /* check param */
+    {
+        return 2;                                                                     /* return error */
+    }
+    
+    set->roi = roi;                                                                   /* set the roi array */
+    set->roi_max = roi_max;                                                           /* set the roi array size */
+    set->roi_count = 0;                                                               /* init 0 */
+    set->index = index;                                                               /* set the index pool */
+    set->weight = weight;                                                             /* set the weight pool */
+    set->pool_size = pool_size;                                                       /* set the pool size */
+    set->pool_used = 0;                                                               /* init 0 */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      compile a pixel mask roi
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  mask is the pixel mask, bit (row * 8 + col)
+ * @param[in]  threshold is the count threshold raw data
+ * @param[out] *id points to a roi id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 set or id is NULL
+ *             - 4 set is full
+ *             - 5 mask is empty
+ * @note       every pixel has weight 1
+ */
+uint8_t amg8833_roi_add_mask(amg8833_roi_set_t *set, uint64_t mask, int16_t threshold, uint16_t *id)
+{
+    uint8_t weight[64];
+    uint8_t i;
+    
+    if ((set == NULL) || (id == NULL))                                  /* check param */
+    {
+        return 2;                                                       /* return error */
+    }
+    
+    for (i = 0; i < 64; i++)                                            /* 64 pixels */
+    {
+        weight[i] = (uint8_t)((mask >> i) & 0x01);                      /* weight 1 in the mask */
+    }
+    
+    return a_roi_add(set, weight, threshold, id);                       /* compile the roi */
+}
+
+/**
+ * @brief      compile a weighted roi
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  weight is the weight array, 0 means the pixel is not in the roi
+ * @param[in]  threshold is the count threshold raw data
+ * @param[out] *id points to a roi id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 set, weight or id is NULL
+ *             - 4 set is full
+ *             - 5 weight is empty
+ * @note       max and count use every pixel with a non zero weight
+ */
+uint8_t amg8833_roi_add_weight(amg8833_roi_set_t *set, uint8_t weight[8][8], int16_t threshold, uint16_t *id)
+{
+    if ((set == NULL) || (weight == NULL) || (id == NULL))              /* check param */
+    {
+        return 2;                                                       /* return error */
+    }
+    
+    return a_roi_add(set, &weight[0][0], threshold, id);                /* compile the roi */
+}
+
+/**
+ * @brief     clear all the rois
+ * @param[in] *set points to a roi set structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 set is NULL
+ * @note      none
+ */
+uint8_t amg8833_roi_clear(amg8833_roi_set_t *set)
+{
+    if (set == NULL)                   /* check set */
+    {
+        return 2;                      /* return error */
+    }
+    
+    set->roi_count = 0;                /* no roi */
+    set->pool_used = 0;                /* empty pools */
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief      evaluate all the rois on a frame
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *result points to a result array with one result per roi id
+ * @return     status code
+ *             - 0 success
+ *             - 2 set, raw or result is NULL
+ * @note       one sparse matrix vector pass over the pools
+ */
+uint8_t amg8833_roi_evaluate(amg8833_roi_set_t *set, int16_t raw[8][8], amg8833_roi_result_t *result)
+{
+    const int16_t *z;
+    const uint8_t *index;
+    const uint8_t *weight;
+    const amg8833_roi_t *roi;
+    int32_t sum;
+    int16_t max;
+    int16_t threshold;
+    int16_t v;
+    uint8_t count;
+    uint8_t j;
+    uint16_t i;
+    
+    if ((set == NULL) || (raw == NULL) || (result == NULL))                              /* check param */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    z = &raw[0][0];                                                                      /* flat input */
+    for (i = 0; i < set->roi_count; i++)                                                 /* one row per roi */
+    {
+        roi = &set->roi[i];                                                              /* get the roi */
+        index = &set->index[roi->start];                                                 /* row indices */
+        weight = &set->weight[roi->start];                                               /* row weights */
+        threshold = roi->threshold;                                                      /* row threshold */
+        sum = 0;                                                                         /* init 0 */
+        max = INT16_MIN;                                                                 /* init the max */
+        count = 0;                                                                       /* init 0 */
+        for (j = 0; j < roi->len; j++)                                                   /* row entries */
+        {
+            v = z[index[j]];                                                             /* gather the pixel */
+            sum += (int32_t)weight[j] * v;                                               /* weighted sum */
+            max = (v > max) ? v : max;                                                   /* select the max */
+            count = (uint8_t)(count + (v > threshold));                                  /* count above */
+        }
+        result[i].mean = (float)sum / (float)roi->weight_sum * 0.25f;                    /* convert the mean */
+        result[i].max = max;                                                             /* set the max */
+        result[i].count = count;                                                         /* set the count */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
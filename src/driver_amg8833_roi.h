@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_roi.h
+ * @brief     driver amg8833 roi header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_ROI_H
+#define DRIVER_AMG8833_ROI_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_roi_driver amg8833 roi driver function
+ * @brief    amg8833 roi driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 roi structure definition
+ * @note  the roi pixels are the entries start to start + len - 1 of the set pools
+ */
+typedef struct amg8833_roi_s
+{
+    uint32_t start;             /**< first pool entry */
+    uint32_t weight_sum;        /**< weight sum */
+    int16_t threshold;          /**< count threshold raw data */
+    uint8_t len;                /**< pool entries */
+} amg8833_roi_t;
+
+/**
+ * @brief amg8833 roi set structure definition
+ * @note  the set is a sparse weight matrix with one row per roi and one col per pixel
+ */
+typedef struct amg8833_roi_set_s
+{
+    amg8833_roi_t *roi;          /**< roi array */
+    uint16_t roi_max;            /**< roi array size */
+    uint16_t roi_count;          /**< compiled roi count */
+    uint8_t *index;              /**< pixel index pool, row * 8 + col */
+    uint8_t *weight;             /**< pixel weight pool */
+    uint32_t pool_size;          /**< pool size */
+    uint32_t pool_used;          /**< used pool entries */
+} amg8833_roi_set_t;
+
+/**
+ * @brief amg8833 roi result structure definition
+ */
+typedef struct amg8833_roi_result_s
+{
+    float mean;           /**< weighted mean in C */
+    int16_t max;          /**< max raw data */
+    uint8_t count;        /**< pixels above the threshold */
+} amg8833_roi_result_t;
+
+/**
+ * @brief     initialize the roi set
+ * @param[in] *set points to a roi set structure
+ * @param[in] *roi points to a roi array
+ * @param[in] roi_max is the roi array size
+ * @param[in] *index points to a pixel index pool
+ * @param[in] *weight points to a pixel weight pool
+ * @param[in] pool_size is the pool size
+ * @return    status code
+ *            - 0 success
+ *            - 2 set, roi, index or weight is NULL
+ * @note      a roi uses one pool entry of each pool per pixel
+ */
+uint8_t amg8833_roi_init(amg8833_roi_set_t *set, amg8833_roi_t *roi, uint16_t roi_max,
+                         uint8_t *index, uint8_t *weight, uint32_t pool_size);
+
+/**
+ * @brief      compile a pixel mask roi
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  mask is the pixel mask, bit (row * 8 + col)
+ * @param[in]  threshold is the count threshold raw data
+ * @param[out] *id points to a roi id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 set or id is NULL
+ *             - 4 set is full
+ *             - 5 mask is empty
+ * @note       every pixel has weight 1
+ */
+uint8_t amg8833_roi_add_mask(amg8833_roi_set_t *set, uint64_t mask, int16_t threshold, uint16_t *id);
+
+/**
+ * @brief      compile a weighted roi
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  weight is the weight array, 0 means the pixel is not in the roi
+ * @param[in]  threshold is the count threshold raw data
+ * @param[out] *id points to a roi id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 set, weight or id is NULL
+ *             - 4 set is full
+ *             - 5 weight is empty
+ * @note       max and count use every pixel with a non zero weight
+ */
+uint8_t amg8833_roi_add_weight(amg8833_roi_set_t *set, uint8_t weight[8][8], int16_t threshold, uint16_t *id);
+
+/**
+ * @brief     clear all the rois
+ * @param[in] *set points to a roi set structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 set is NULL
+ * @note      none
+ */
+uint8_t amg8833_roi_clear(amg8833_roi_set_t *set);
+
+/**
+ * @brief      evaluate all the rois on a frame
+ * @param[in]  *set points to a roi set structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *result points to a result array with one result per roi id
+ * @return     status code
+ *             - 0 success
+ *             - 2 set, raw or result is NULL
+ * @note       one sparse matrix vector pass over the pools
+ */
+uint8_t amg8833_roi_evaluate(amg8833_roi_set_t *set, int16_t raw[8][8], amg8833_roi_result_t *result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_rule.c
+ * @brief     driver amg8833 rule source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_rule.h"
+
+/**
+ * @brief rule value slot definition
+ */
+#define RULE_SLOT_ROI        4        /**< first roi slot */
+
+/**
+ * @brief     initialize the rule engine
+ * @param[in] *engine points to a rule engine structure
+ * @param[in] *rule points to a rule table
+ * @param[in] rule_max is the rule table size
+ * @param[in] *value points to a value vector
+ * @param[in] value_max is the value vector size
+ * @param[in] period is the frame period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 engine, rule or value is NULL
+ *            - 5 param is invalid
+ * @note      the value vector needs 4 + 3 * roi count entries
+ */
+uint8_t amg8833_rule_init(amg8833_rule_engine_t *engine, amg8833_rule_t *rule, uint16_t rule_max,
+                          int32_t *value, uint16_t value_max, uint16_t period)
+{
+    if ((engine == NULL) || (rule == NULL) || (value == NULL))              /* check param */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((value_max < RULE_SLOT_ROI) || (period == 0))                       /* check param */
+    {
+        return 5;                                                           /* return error */
+    }
+    
+    memset(engine, 0, sizeof(amg8833_rule_engine_t));                       /* clear the engine */
+    engine->rule = rule;                                                    /* set the rule table */
+    engine->rule_max = rule_max;                                            /* set the rule table size */
+    engine->value = value;                                                  /* set the value vector */
+    engine->value_max = value_max;                                          /* set the value vector size */
+    engine->period = period;                                                /* set the period */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      compile a rule
+ * @param[in]  *engine points to a rule engine structure
+ * @param[in]  source is the rule source
+ * @param[in]  roi is the roi id for the roi sources
+ * @param[in]  op is the rule operator
+ * @param[in]  threshold is the threshold in C, C/s or pixels
+ * @param[in]  frames is the consecutive frames to fire
+ * @param[out] *id points to a rule id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 engine or id is NULL
+ *             - 4 rule table is full
+ *             - 5 param is invalid
+ * @note       "roi kitchen mean > 45C for 3 frames" is (AMG8833_RULE_SOURCE_ROI_MEAN, kitchen, GREATER, 45.0f, 3)
+ */
+uint8_t amg8833_rule_add(amg8833_rule_engine_t *engine, amg8833_rule_source_t source, uint16_t roi,
+                         amg8833_rule_operator_t op, float threshold, uint16_t frames, uint16_t *id)
+{
+    amg8833_rule_t *r;
+    uint32_t slot;
+    float scale;
+    float t;
+    
+    if ((engine == NULL) || (id == NULL))                                                    /* check param */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (engine->rule_count >= engine->rule_max)                                              /* check the table */
+    {
+        return 4;                                                                            /* return error */
+    }
+    if ((source > AMG8833_RULE_SOURCE_ROI_COUNT) || (op > AMG8833_RULE_OPERATOR_LESS_EQUAL) ||
+        (frames == 0))                                                                       /* check param */
+    {
+        return 5;                                                                            /* return error */
+    }
+    
+    if (source < AMG8833_RULE_SOURCE_ROI_MEAN)                                               /* frame value */
+    {
+        slot = (uint32_t)source;                                                             /* the source is the slot */
+    }
+    else
+    {
+        slot = (uint32_t)(source - AMG8833_RULE_SOURCE_ROI_MEAN);                            /* roi value index */
+        slot += RULE_SLOT_ROI + (uint32_t)roi * 3;                                           /* roi value slot */
+    }
+    if (slot >= engine->value_max)                                                           /* check the slot */
+    {
+        return 5;                                                                            /* return error */
+    }
+    scale = (source == AMG8833_RULE_SOURCE_ROI_COUNT) ? 256.0f : 1024.0f;                    /* roi count in 1/256, others in 1/1024 */
+    t = threshold * scale;                                                                   /* fixed point threshold */
+    if ((t > 2.0e9f) || (t < -2.0e9f))                                                       /* check the range */
+    {
+        return 5;                                                                            /* return error */
+    }
+    
+    r = &engine->rule[engine->rule_count];                                                   /* every operator becomes sign * value > bound */
+    r->slot = (uint16_t)slot;                                                                /* set the slot */
+    r->hold = frames;                                                                        /* set the hold frames */
+    r->counter = 0;                                                                          /* init 0 */
+    r->fired = 0;                                                                            /* init 0 */
+    switch (op)
+    {
+        case AMG8833_RULE_OPERATOR_GREATER :
+        {
+            r->sign = 1;                                                                     /* value */
+            r->bound = (int32_t)t;                                                           /* > t */
+            
+            break;
+        }
+        case AMG8833_RULE_OPERATOR_GREATER_EQUAL :
+        {
+            r->sign = 1;                                                                     /* value */
+            r->bound = (int32_t)t - 1;                                                       /* >= t */
+            
+            break;
+        }
+        case AMG8833_RULE_OPERATOR_LESS :
+        {
+            r->sign = -1;                                                                    /* -value */
+            r->bound = -(int32_t)t;                                                          /* < t */
+            
+            break;
+        }
+        default :
+        {
+            r->sign = -1;                                                                    /* -value */
+            r->bound = -(int32_t)t - 1;                                                      /* <= t */
+            
+            break;
+        }
+    }
+    *id = engine->rule_count;                                                                /* set the id */
+    engine->rule_count++;                                                                    /* count */
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      evaluate all the rules on a frame
+ * @param[in]  *engine points to a rule engine structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  *result points to the roi results of the frame from amg8833_roi_evaluate, it can be NULL
+ * @param[in]  roi_count is the roi result count
+ * @param[out] *fired points to a fired rule count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 engine, raw or fired is NULL
+ *             - 5 roi_count is invalid
+ * @note       the values are computed once and every rule is one compare of the flat table,
+ *             rules on missing rois never pass, read the fired flag of each rule in the rule table
+ */
+uint8_t amg8833_rule_evaluate(amg8833_rule_engine_t *engine, int16_t raw[8][8],
+                              const amg8833_roi_result_t *result, uint16_t roi_count, uint16_t *fired)
+{
+    const int16_t *z;
+    const int16_t *old;
+    amg8833_rule_t *r;
+    int32_t *value;
+    int32_t sum;
+    int32_t rise;
+    int32_t d;
+    int16_t min;
+    int16_t max;
+    uint32_t filled;
+    uint16_t n;
+    uint8_t pass;
+    uint16_t i;
+    
+    if ((engine == NULL) || (raw == NULL) || (fired == NULL))                                  /* check param */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (result == NULL)                                                                        /* no roi */
+    {
+        roi_count = 0;                                                                         /* no roi */
+    }
+    filled = RULE_SLOT_ROI + (uint32_t)roi_count * 3;                                          /* used slots */
+    if (filled > engine->value_max)                                                            /* check the slots */
+    {
+        return 5;                                                                              /* return error */
+    }
+    
+    z = &raw[0][0];                                                                            /* frame data */
+    i = (engine->ring_count < AMG8833_RULE_RATE_FRAMES) ? 0 : engine->ring_pos;                /* oldest frame of the ring */
+    old = engine->ring[i];                                                                     /* get the oldest frame */
+    min = z[0];                                                                                /* init the min */
+    max = z[0];                                                                                /* init the max */
+    sum = 0;                                                                                   /* init 0 */
+    rise = 0;                                                                                  /* init 0 */
+    for (i = 0; i < 64; i++)                                                                   /* frame values and the rate of rise in one pass */
+    {
+        min = (z[i] < min) ? z[i] : min;                                                       /* min */
+        max = (z[i] > max) ? z[i] : max;                                                       /* max */
+        sum += z[i];                                                                           /* sum */
+        d = (int32_t)z[i] - old[i];                                                            /* rise over the ring */
+        rise = (d > rise) ? d : rise;                                                          /* max rise */
+    }
+    value = engine->value;                                                                     /* get the values */
+    value[AMG8833_RULE_SOURCE_FRAME_MAX] = (int32_t)max * 256;                                 /* frame max */
+    value[AMG8833_RULE_SOURCE_FRAME_MIN] = (int32_t)min * 256;                                 /* frame min */
+    value[AMG8833_RULE_SOURCE_FRAME_MEAN] = sum * 4;                                           /* frame mean */
+    value[AMG8833_RULE_SOURCE_RATE_MAX] = (engine->ring_count == 0) ? 0 :                      /* rate of rise */
+                                          (int32_t)(((int64_t)rise * 256 * 1000) /             /* in 1/256 degree per second */
+                                          ((int64_t)engine->ring_count * engine->period));     /* over the ring */
+    memcpy(engine->ring[engine->ring_pos], z, sizeof(engine->ring[0]));                        /* push the frame */
+    engine->ring_pos = (uint8_t)((engine->ring_pos + 1) % AMG8833_RULE_RATE_FRAMES);           /* next position */
+    if (engine->ring_count < AMG8833_RULE_RATE_FRAMES)                                         /* check the ring */
+    {
+        engine->ring_count++;                                                                  /* count */
+    }
+    
+    for (i = 0; i < roi_count; i++)                                                            /* roi values */
+    {
+        value[RULE_SLOT_ROI + i * 3 + 0] = (int32_t)(result[i].mean * 1024.0f);                /* roi mean */
+        value[RULE_SLOT_ROI + i * 3 + 1] = (int32_t)result[i].max * 256;                       /* roi max */
+        value[RULE_SLOT_ROI + i * 3 + 2] = (int32_t)result[i].count * 256;                     /* roi count */
+    }
+    
+    n = 0;                                                                                     /* init 0 */
+    for (i = 0; i < engine->rule_count; i++)                                                   /* one compare per rule of the flat table */
+    {
+        r = &engine->rule[i];                                                                  /* get the rule */
+        pass = (uint8_t)((r->slot < filled) &&                                                 /* filled slot */
+                         ((int64_t)r->sign * value[r->slot] > r->bound));                      /* sign * value > bound */
+        r->counter = pass ? (uint16_t)(r->counter + (r->counter < r->hold)) : 0;               /* count the passed frames */
+        r->fired = (uint8_t)(r->counter >= r->hold);                                           /* held long enough */
+        n = (uint16_t)(n + r->fired);                                                          /* count the fired rules */
+    }
+    *fired = n;                                                                                /* set the fired count */
+    
+    return 0;                                                                                  /* success return 0 */
+}
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_rule.h
+ * @brief     driver amg8833 rule header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_RULE_H
+#define DRIVER_AMG8833_RULE_H
+
+#include "driver_amg8833_roi.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_rule_driver amg8833 rule driver function
+ * @brief    amg8833 rule driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 rule definition
+ * @note  the rate of rise is measured over the last AMG8833_RULE_RATE_FRAMES frames
+ */
+#define AMG8833_RULE_RATE_FRAMES        10        /**< rate of rise span in frames */
+
+/**
+ * @brief amg8833 rule source enumeration definition
+ */
+typedef enum
+{
+    AMG8833_RULE_SOURCE_FRAME_MAX  = 0x00,        /**< frame max in C */
+    AMG8833_RULE_SOURCE_FRAME_MIN  = 0x01,        /**< frame min in C */
+    AMG8833_RULE_SOURCE_FRAME_MEAN = 0x02,        /**< frame mean in C */
+    AMG8833_RULE_SOURCE_RATE_MAX   = 0x03,        /**< max pixel rate of rise in C/s */
+    AMG8833_RULE_SOURCE_ROI_MEAN   = 0x04,        /**< roi mean in C */
+    AMG8833_RULE_SOURCE_ROI_MAX    = 0x05,        /**< roi max in C */
+    AMG8833_RULE_SOURCE_ROI_COUNT  = 0x06,        /**< roi pixels above its threshold */
+} amg8833_rule_source_t;
+
+/**
+ * @brief amg8833 rule operator enumeration definition
+ */
+typedef enum
+{
+    AMG8833_RULE_OPERATOR_GREATER       = 0x00,        /**< value > threshold */
+    AMG8833_RULE_OPERATOR_GREATER_EQUAL = 0x01,        /**< value >= threshold */
+    AMG8833_RULE_OPERATOR_LESS          = 0x02,        /**< value < threshold */
+    AMG8833_RULE_OPERATOR_LESS_EQUAL    = 0x03,        /**< value <= threshold */
+} amg8833_rule_operator_t;
+
+/**
+ * @brief amg8833 rule structure definition
+ * @note  a compiled rule passes when sign * value > bound, values are 1/256 raw data,
+ *        1/256 raw data per second or 1/256 pixel counts
+ */
+typedef struct amg8833_rule_s
+{
+    int32_t bound;          /**< compiled bound */
+    uint16_t slot;          /**< value slot */
+    uint16_t hold;          /**< frames to fire */
+    uint16_t counter;       /**< passed frames */
+    int8_t sign;            /**< compiled sign */
+    uint8_t fired;          /**< fired flag */
+} amg8833_rule_t;
+
+/**
+ * @brief amg8833 rule engine structure definition
+ */
+typedef struct amg8833_rule_engine_s
+{
+    amg8833_rule_t *rule;                                   /**< rule table */
+    uint16_t rule_max;                                      /**< rule table size */
+    uint16_t rule_count;                                    /**< compiled rule count */
+    int32_t *value;                                         /**< value vector */
+    uint16_t value_max;                                     /**< value vector size */
+    uint16_t period;                                        /**< frame period in ms */
+    uint8_t ring_pos;                                       /**< next ring frame */
+    uint8_t ring_count;                                     /**< ring frame count */
+    int16_t ring[AMG8833_RULE_RATE_FRAMES][64];             /**< last frames */
+} amg8833_rule_engine_t;
+
+/**
+ * @brief     initialize the rule engine
+ * @param[in] *engine points to a rule engine structure
+ * @param[in] *rule points to a rule table
+ * @param[in] rule_max is the rule table size
+ * @param[in] *value points to a value vector
+ * @param[in] value_max is the value vector size
+ * @param[in] period is the frame period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 engine, rule or value is NULL
+ *            - 5 param is invalid
+ * @note      the value vector needs 4 + 3 * roi count entries
+ */
+uint8_t amg8833_rule_init(amg8833_rule_engine_t *engine, amg8833_rule_t *rule, uint16_t rule_max,
+                          int32_t *value, uint16_t value_max, uint16_t period);
+
+/**
+ * @brief      compile a rule
+ * @param[in]  *engine points to a rule engine structure
+ * @param[in]  source is the rule source
+ * @param[in]  roi is the roi id for the roi sources
+ * @param[in]  op is the rule operator
+ * @param[in]  threshold is the threshold in C, C/s or pixels
+ * @param[in]  frames is the consecutive frames to fire
+ * @param[out] *id points to a rule id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 engine or id is NULL
+ *             - 4 rule table is full
+ *             - 5 param is invalid
+ * @note       "roi kitchen mean > 45C for 3 frames" is (AMG8833_RULE_SOURCE_ROI_MEAN, kitchen, GREATER, 45.0f, 3)
+ */
+uint8_t amg8833_rule_add(amg8833_rule_engine_t *engine, amg8833_rule_source_t source, uint16_t roi,
+                         amg8833_rule_operator_t op, float threshold, uint16_t frames, uint16_t *id);
+
+/**
+ * @brief      evaluate all the rules on a frame
+ * @param[in]  *engine points to a rule engine structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[in]  *result points to the roi results of the frame from amg8833_roi_evaluate, it can be NULL
+ * @param[in]  roi_count is the roi result count
+ * @param[out] *fired points to a fired rule count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 engine, raw or fired is NULL
+ *             - 5 roi_count is invalid
+ * @note       the values are computed once and every rule is one compare of the flat table,
+ *             rules on missing rois never pass, read the fired flag of each rule in the rule table
+ */
+uint8_t amg8833_rule_evaluate(amg8833_rule_engine_t *engine, int16_t raw[8][8],
+                              const amg8833_roi_result_t *result, uint16_t roi_count, uint16_t *fired);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
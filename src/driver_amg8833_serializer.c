@@ -0,0 +1,925 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_serializer.c
+ * @brief     driver amg8833 serializer.ceader file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "driver_amg8833_serializer.h"
+
+/**
+ * @brief serializer item kind definition
+ */
+#define SERIALIZER_KIND_INT          0x00        /**< integer */
+#define SERIALIZER_KIND_BSTR         0x01        /**< byte string */
+#define SERIALIZER_KIND_TSTR         0x02        /**< text string */
+#define SERIALIZER_KIND_ARRAY        0x03        /**< array */
+#define SERIALIZER_KIND_MAP          0x04        /**< map */
+#define SERIALIZER_KIND_OTHER        0x05        /**< other item with a fixed payload */
+#define SERIALIZER_KIND_TAG          0x06        /**< cbor tag followed by one item */
+#define SERIALIZER_MAX_DEPTH         4           /**< max skipped nesting depth */
+
+/**
+ * @brief serializer writer structure definition
+ */
+typedef struct serializer_writer_s
+{
+    uint8_t *buf;          /**< data buffer */
+    uint16_t len;          /**< data length */
+    uint8_t format;        /**< format */
+} serializer_writer_t;
+
+/**
+ * @brief serializer reader structure definition
+ */
+typedef struct serializer_reader_s
+{
+    const uint8_t *buf;        /**< data buffer */
+    uint16_t len;              /**< data length */
+    uint16_t pos;              /**< read position */
+    uint8_t format;            /**< format */
+} serializer_reader_t;
+
+/**
+ * @brief     write a big endian value
+ * @param[in] *w points to a writer structure
+ * @param[in] value is the written value
+ * @param[in] bytes is the value bytes
+ * @note      none
+ */
+static void a_serializer_put_be(serializer_writer_t *w, uint64_t value, uint8_t bytes)
+{
+    while (bytes > 0)                                                    /* write all bytes */
+    {
+        bytes--;                                                         /* next byte */
+        w->buf[w->len++] = (uint8_t)(value >> (bytes * 8));              /* msb first */
+    }
+}
+
+/**
+ * @brief     write a cbor head
+ * @param[in] *w points to a writer structure
+ * @param[in] major is the major type
+ * @param[in] value is the head argument
+ * @note      none
+ */
+static void a_serializer_cbor_head(serializer_writer_t *w, uint8_t major, uint64_t value)
+{
+    major = (uint8_t)(major << 5);                                       /* set the major type */
+    if (value < 24)                                                      /* immediate value */
+    {
+        w->buf[w->len++] = (uint8_t)(major | value);                     /* set the value */
+    }
+    else if (value <= 0xFF)                                              /* 1 byte */
+    {
+        w->buf[w->len++] = (uint8_t)(major | 24);                        /* set the head */
+        a_serializer_put_be(w, value, 1);                                /* set the value */
+    }
+    else if (value <= 0xFFFF)                                            /* 2 bytes */
+    {
+        w->buf[w->len++] = (uint8_t)(major | 25);                        /* set the head */
+        a_serializer_put_be(w, value, 2);                                /* set the value */
+    }
+    else if (value <= 0xFFFFFFFFUL)                                      /* 4 bytes */
+    {
+        w->buf[w->len++] = (uint8_t)(major | 26);                        /* set the head */
+        a_serializer_put_be(w, value, 4);                                /* set the value */
+    }
+    else                                                                 /* 8 bytes */
+    {
+        w->buf[w->len++] = (uint8_t)(major | 27);                        /* set the head */
+        a_serializer_put_be(w, value, 8);                                /* set the value */
+    }
+}
+
+/**
+ * @brief     write an unsigned integer
+ * @param[in] *w points to a writer structure
+ * @param[in] value is the written value
+ * @note      none
+ */
+static void a_serializer_write_uint(serializer_writer_t *w, uint64_t value)
+{
+    if (w->format == AMG8833_SERIALIZER_FORMAT_CBOR)                     /* cbor */
+    {
+        a_serializer_cbor_head(w, 0, value);                             /* major type 0 */
+    }
+    else if (value <= 0x7F)                                              /* positive fixint */
+    {
+        w->buf[w->len++] = (uint8_t)value;                               /* set the value */
+    }
+    else if (value <= 0xFF)                                              /* uint 8 */
+    {
+        w->buf[w->len++] = 0xCC;                                         /* set the head */
+        a_serializer_put_be(w, value, 1);                                /* set the value */
+    }
+    else if (value <= 0xFFFF)                                            /* uint 16 */
+    {
+        w->buf[w->len++] = 0xCD;                                         /* set the head */
+        a_serializer_put_be(w, value, 2);                                /* set the value */
+    }
+    else if (value <= 0xFFFFFFFFUL)                                      /* uint 32 */
+    {
+        w->buf[w->len++] = 0xCE;                                         /* set the head */
+        a_serializer_put_be(w, value, 4);                                /* set the value */
+    }
+    else                                                                 /* uint 64 */
+    {
+        w->buf[w->len++] = 0xCF;                                         /* set the head */
+        a_serializer_put_be(w, value, 8);                                /* set the value */
+    }
+}
+
+/**
+ * @brief     write a signed 16 bits integer
+ * @param[in] *w points to a writer structure
+ * @param[in] value is the written value
+ * @note      none
+ */
+static void a_serializer_write_int(serializer_writer_t *w, int16_t value)
+{
+    if (value >= 0)                                                       /* positive */
+    {
+        a_serializer_write_uint(w, (uint64_t)value);                      /* write as uint */
+    }
+    else if (w->format == AMG8833_SERIALIZER_FORMAT_CBOR)                 /* cbor */
+    {
+        a_serializer_cbor_head(w, 1, (uint64_t)(-1 - (int32_t)value));    /* major type 1 */
+    }
+    else if (value >= -32)                                                /* negative fixint */
+    {
+        w->buf[w->len++] = (uint8_t)value;                                /* set the value */
+    }
+    else if (value >= -128)                                               /* int 8 */
+    {
+        w->buf[w->len++] = 0xD0;                                          /* set the head */
+        a_serializer_put_be(w, (uint8_t)value, 1);                        /* set the value */
+    }
+    else                                                                  /* int 16 */
+    {
+        w->buf[w->len++] = 0xD1;                                          /* set the head */
+        a_serializer_put_be(w, (uint16_t)value, 2);                       /* set the value */
+    }
+}
+
+/**
+ * @brief     write a short text string
+ * @param[in] *w points to a writer structure
+ * @param[in] *str points to a string
+ * @note      the string must be shorter than 24 bytes
+ */
+static void a_serializer_write_key(serializer_writer_t *w, const char *str)
+{
+    uint8_t n;
+    
+    n = (uint8_t)strlen(str);                                            /* get the length */
+    if (w->format == AMG8833_SERIALIZER_FORMAT_CBOR)                     /* cbor */
+    {
+        w->buf[w->len++] = (uint8_t)(0x60 | n);                          /* major type 3 */
+    }
+    else
+    {
+        w->buf[w->len++] = (uint8_t)(0xA0 | n);                          /* fixstr */
+    }
+    memcpy(&w->buf[w->len], str, n);                                     /* copy the string */
+    w->len = (uint16_t)(w->len + n);                                     /* add the length */
+}
+
+/**
+ * @brief      read a big endian value
+ * @param[in]  *r points to a reader structure
+ * @param[in]  bytes is the value bytes
+ * @param[out] *value points to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ * @note       none
+ */
+static uint8_t a_serializer_get_be(serializer_reader_t *r, uint8_t bytes, uint64_t *value)
+{
+    if ((uint16_t)(r->pos + bytes) > r->len)                             /* check the length */
+    {
+        return 1;                                                        /* need more data */
+    }
+    *value = 0;                                                          /* init value */
+    while (bytes > 0)                                                    /* read all bytes */
+    {
+        *value = (*value << 8) | r->buf[r->pos++];                       /* msb first */
+        bytes--;                                                         /* next byte */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      read a cbor head
+ * @param[in]  *r points to a reader structure
+ * @param[in]  head is the head byte
+ * @param[out] *kind points to a kind buffer
+ * @param[out] *value points to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 4 item is invalid
+ * @note       none
+ */
+static uint8_t a_serializer_cbor_head_read(serializer_reader_t *r, uint8_t head, uint8_t *kind, int64_t *value)
+{
+    static const uint8_t kinds[8] =
+    {
+        SERIALIZER_KIND_INT, SERIALIZER_KIND_INT, SERIALIZER_KIND_BSTR, SERIALIZER_KIND_TSTR,
+        SERIALIZER_KIND_ARRAY, SERIALIZER_KIND_MAP, SERIALIZER_KIND_TAG, SERIALIZER_KIND_OTHER,
+    };
+    uint8_t major;
+    uint8_t info;
+    uint8_t size;
+    uint64_t arg;
+    
+    major = head >> 5;                                                   /* get the major type */
+    info = head & 0x1F;                                                  /* get the additional information */
+    if (info < 24)                                                       /* immediate value */
+    {
+        arg = info;                                                      /* set the argument */
+    }
+    else if (info <= 27)                                                 /* 1, 2, 4 or 8 bytes */
+    {
+        size = (uint8_t)(1 << (info - 24));                              /* get the size */
+        if (a_serializer_get_be(r, size, &arg) != 0)                     /* read the argument */
+        {
+            return 1;                                                    /* need more data */
+        }
+    }
+    else
+    {
+        return 4;                                                        /* indefinite length is not supported */
+    }
+    *kind = kinds[major];                                                /* set the kind */
+    if (major == 1)                                                      /* negative */
+    {
+        *value = -1 - (int64_t)arg;                                      /* set the value */
+    }
+    else if (major == 7)                                                 /* simple and float */
+    {
+        *value = 0;                                                      /* argument is already read */
+    }
+    else
+    {
+        *value = (int64_t)arg;                                           /* set the value */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      read a messagepack head
+ * @param[in]  *r points to a reader structure
+ * @param[in]  head is the head byte
+ * @param[out] *kind points to a kind buffer
+ * @param[out] *value points to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 4 item is invalid
+ * @note       none
+ */
+static uint8_t a_serializer_msgpack_head_read(serializer_reader_t *r, uint8_t head, uint8_t *kind, int64_t *value)
+{
+    uint64_t arg;
+    uint8_t size;
+    
+    if ((head <= 0x7F) || (head >= 0xE0))                                /* fixint */
+    {
+        *kind = SERIALIZER_KIND_INT;                                     /* integer */
+        *value = (int8_t)head;                                           /* set the value */
+        
+        return 0;                                                        /* success return 0 */
+    }
+    if (head <= 0x8F)                                                    /* fixmap */
+    {
+        *kind = SERIALIZER_KIND_MAP;                                     /* map */
+        *value = head & 0x0F;                                            /* set the count */
+        
+        return 0;                                                        /* success return 0 */
+    }
+    if (head <= 0x9F)                                                    /* fixarray */
+    {
+        *kind = SERIALIZER_KIND_ARRAY;                                   /* array */
+        *value = head & 0x0F;                                            /* set the count */
+        
+        return 0;                                                        /* success return 0 */
+    }
+    if (head <= 0xBF)                                                    /* fixstr */
+    {
+        *kind = SERIALIZER_KIND_TSTR;                                    /* text string */
+        *value = head & 0x1F;                                            /* set the length */
+        
+        return 0;                                                        /* success return 0 */
+    }
+    switch (head)
+    {
+        case 0xC0 :                                                      /* nil */
+        case 0xC2 :                                                      /* false */
+        case 0xC3 :                                                      /* true */
+        {
+            *kind = SERIALIZER_KIND_OTHER;                               /* other */
+            *value = 0;                                                  /* no payload */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xC4 :                                                      /* bin 8 */
+        case 0xC5 :                                                      /* bin 16 */
+        case 0xC6 :                                                      /* bin 32 */
+        {
+            size = (uint8_t)(1 << (head - 0xC4));                        /* get the size */
+            if (a_serializer_get_be(r, size, &arg) != 0)                 /* read the length */
+            {
+                return 1;                                                /* need more data */
+            }
+            *kind = SERIALIZER_KIND_BSTR;                                /* byte string */
+            *value = (int64_t)arg;                                       /* set the length */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xCA :                                                      /* float 32 */
+        case 0xCB :                                                      /* float 64 */
+        {
+            *kind = SERIALIZER_KIND_OTHER;                               /* other */
+            *value = (head == 0xCA) ? 4 : 8;                             /* payload length */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xCC :                                                      /* uint 8 */
+        case 0xCD :                                                      /* uint 16 */
+        case 0xCE :                                                      /* uint 32 */
+        case 0xCF :                                                      /* uint 64 */
+        {
+            size = (uint8_t)(1 << (head - 0xCC));                        /* get the size */
+            if (a_serializer_get_be(r, size, &arg) != 0)                 /* read the value */
+            {
+                return 1;                                                /* need more data */
+            }
+            *kind = SERIALIZER_KIND_INT;                                 /* integer */
+            *value = (int64_t)arg;                                       /* set the value */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xD0 :                                                      /* int 8 */
+        case 0xD1 :                                                      /* int 16 */
+        case 0xD2 :                                                      /* int 32 */
+        case 0xD3 :                                                      /* int 64 */
+        {
+            size = (uint8_t)(1 << (head - 0xD0));                        /* get the size */
+            if (a_serializer_get_be(r, size, &arg) != 0)                 /* read the value */
+            {
+                return 1;                                                /* need more data */
+            }
+            *kind = SERIALIZER_KIND_INT;                                 /* integer */
+            if (head == 0xD0)                                            /* int 8 */
+            {
+                *value = (int8_t)arg;                                    /* sign extend */
+            }
+            else if (head == 0xD1)                                       /* int 16 */
+            {
+                *value = (int16_t)arg;                                   /* sign extend */
+            }
+            else if (head == 0xD2)                                       /* int 32 */
+            {
+                *value = (int32_t)arg;                                   /* sign extend */
+            }
+            else                                                         /* int 64 */
+            {
+                *value = (int64_t)arg;                                   /* set the value */
+            }
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xD9 :                                                      /* str 8 */
+        case 0xDA :                                                      /* str 16 */
+        case 0xDB :                                                      /* str 32 */
+        {
+            size = (uint8_t)(1 << (head - 0xD9));                        /* get the size */
+            if (a_serializer_get_be(r, size, &arg) != 0)                 /* read the length */
+            {
+                return 1;                                                /* need more data */
+            }
+            *kind = SERIALIZER_KIND_TSTR;                                /* text string */
+            *value = (int64_t)arg;                                       /* set the length */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        case 0xDC :                                                      /* array 16 */
+        case 0xDD :                                                      /* array 32 */
+        case 0xDE :                                                      /* map 16 */
+        case 0xDF :                                                      /* map 32 */
+        {
+            size = (uint8_t)(((head & 0x01) != 0) ? 4 : 2);              /* get the size */
+            if (a_serializer_get_be(r, size, &arg) != 0)                 /* read the count */
+            {
+                return 1;                                                /* need more data */
+            }
+            if (head <= 0xDD)                                            /* array */
+            {
+                *kind = SERIALIZER_KIND_ARRAY;                           /* set the kind */
+            }
+            else
+            {
+                *kind = SERIALIZER_KIND_MAP;                             /* set the kind */
+            }
+            *value = (int64_t)arg;                                       /* set the count */
+            
+            return 0;                                                    /* success return 0 */
+        }
+        default :
+        {
+            return 4;                                                    /* ext types are not supported */
+        }
+    }
+}
+
+/**
+ * @brief      read an item head
+ * @param[in]  *r points to a reader structure
+ * @param[out] *kind points to a kind buffer
+ * @param[out] *value points to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 4 item is invalid
+ * @note       value is the integer, the string length or the item count
+ */
+static uint8_t a_serializer_read_head(serializer_reader_t *r, uint8_t *kind, int64_t *value)
+{
+    uint8_t head;
+    uint8_t res;
+    
+    if (r->pos >= r->len)                                                /* check the length */
+    {
+        return 1;                                                        /* need more data */
+    }
+    head = r->buf[r->pos++];                                             /* get the head */
+    if (r->format == AMG8833_SERIALIZER_FORMAT_CBOR)                     /* cbor */
+    {
+        res = a_serializer_cbor_head_read(r, head, kind, value);         /* read cbor head */
+    }
+    else
+    {
+        res = a_serializer_msgpack_head_read(r, head, kind, value);      /* read messagepack head */
+    }
+    
+    return res;                                                          /* return the result */
+}
+
+/**
+ * @brief      skip the payload of an item
+ * @param[in]  *r points to a reader structure
+ * @param[in]  n is the payload length
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ * @note       none
+ */
+static uint8_t a_serializer_skip_bytes(serializer_reader_t *r, int64_t n)
+{
+    if ((n < 0) || ((int64_t)r->pos + n > (int64_t)r->len))              /* check the length */
+    {
+        return 1;                                                        /* need more data */
+    }
+    r->pos = (uint16_t)(r->pos + n);                                     /* skip */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     skip a whole item
+ * @param[in] *r points to a reader structure
+ * @param[in] depth is the allowed nesting depth
+ * @return    status code
+ *            - 0 success
+ *            - 1 need more data
+ *            - 4 item is invalid
+ * @note      none
+ */
+static uint8_t a_serializer_skip_item(serializer_reader_t *r, uint8_t depth)
+{
+    uint8_t res;
+    uint8_t kind;
+    int64_t value;
+    int64_t i;
+    
+    if (depth == 0)                                                       /* check the depth */
+    {
+        return 4;                                                         /* nesting is too deep */
+    }
+    res = a_serializer_read_head(r, &kind, &value);                       /* read the head */
+    if (res != 0)                                                         /* check the result */
+    {
+        return res;                                                       /* return the result */
+    }
+    switch (kind)
+    {
+        case SERIALIZER_KIND_BSTR :                                       /* byte string */
+        case SERIALIZER_KIND_TSTR :                                       /* text string */
+        case SERIALIZER_KIND_OTHER :                                      /* fixed payload */
+        {
+            return a_serializer_skip_bytes(r, value);                     /* skip the payload */
+        }
+        case SERIALIZER_KIND_ARRAY :                                      /* array */
+        case SERIALIZER_KIND_MAP :                                        /* map */
+        {
+            if (kind == SERIALIZER_KIND_MAP)                              /* map */
+            {
+                value = value * 2;                                        /* keys and values */
+            }
+            if (value > r->len)                                           /* every item takes one byte at least */
+            {
+                return (value > AMG8833_SERIALIZER_MAX_SIZE) ? 4 : 1;     /* check the count */
+            }
+            for (i = 0; i < value; i++)                                   /* skip all items */
+            {
+                res = a_serializer_skip_item(r, (uint8_t)(depth - 1));    /* skip the item */
+                if (res != 0)                                             /* check the result */
+                {
+                    return res;                                           /* return the result */
+                }
+            }
+            
+            return 0;                                                     /* success return 0 */
+        }
+        case SERIALIZER_KIND_TAG :                                        /* tag */
+        {
+            return a_serializer_skip_item(r, depth);                      /* skip the tagged item */
+        }
+        default :                                                         /* integer */
+        {
+            return 0;                                                     /* success return 0 */
+        }
+    }
+}
+
+/**
+ * @brief      read an integer item
+ * @param[in]  *r points to a reader structure
+ * @param[out] *value points to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 4 item is invalid
+ * @note       none
+ */
+static uint8_t a_serializer_read_int(serializer_reader_t *r, int64_t *value)
+{
+    uint8_t res;
+    uint8_t kind;
+    
+    res = a_serializer_read_head(r, &kind, value);                       /* read the head */
+    if (res != 0)                                                        /* check the result */
+    {
+        return res;                                                      /* return the result */
+    }
+    if (kind != SERIALIZER_KIND_INT)                                     /* check the kind */
+    {
+        return 4;                                                        /* return error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      parse a frame
+ * @param[in]  *r points to a reader structure
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 4 item is invalid
+ * @note       none
+ */
+static uint8_t a_serializer_parse(serializer_reader_t *r, amg8833_frame_t *frame)
+{
+    uint8_t res;
+    uint8_t kind;
+    uint8_t i;
+    int64_t n;
+    int64_t k;
+    int64_t value;
+    char key[12];
+    
+    res = a_serializer_read_head(r, &kind, &n);                                          /* read the map head */
+    if (res != 0)                                                                        /* check the result */
+    {
+        return res;                                                                      /* return the result */
+    }
+    if ((kind != SERIALIZER_KIND_MAP) || (n > 32))                                       /* check the map */
+    {
+        return 4;                                                                        /* return error */
+    }
+    for (k = 0; k < n; k++)                                                              /* parse all entries */
+    {
+        res = a_serializer_read_head(r, &kind, &value);                                  /* read the key head */
+        if (res != 0)                                                                    /* check the result */
+        {
+            return res;                                                                  /* return the result */
+        }
+        if ((kind != SERIALIZER_KIND_TSTR) || (value < 0))                               /* check the key */
+        {
+            return 4;                                                                    /* return error */
+        }
+        if ((value >= (int64_t)sizeof(key)) || (r->pos + value > r->len))                /* long or incomplete key */
+        {
+            res = a_serializer_skip_bytes(r, value);                                     /* skip the key */
+            if (res != 0)                                                                /* check the result */
+            {
+                return res;                                                              /* return the result */
+            }
+            key[0] = '\0';                                                               /* unknown key */
+        }
+        else
+        {
+            memcpy(key, &r->buf[r->pos], (size_t)value);                                 /* copy the key */
+            key[value] = '\0';                                                           /* end the string */
+            r->pos = (uint16_t)(r->pos + value);                                         /* skip the key */
+        }
+        
+        if (strcmp(key, "ts") == 0)                                                      /* timestamp */
+        {
+            res = a_serializer_read_int(r, &value);                                      /* read the value */
+            frame->timestamp = (uint64_t)value;                                          /* set the timestamp */
+        }
+        else if (strcmp(key, "addr") == 0)                                               /* address */
+        {
+            res = a_serializer_read_int(r, &value);                                      /* read the value */
+            frame->addr = (uint8_t)value;                                                /* set the address */
+        }
+        else if (strcmp(key, "status") == 0)                                             /* status */
+        {
+            res = a_serializer_read_int(r, &value);                                      /* read the value */
+            frame->status = (uint8_t)value;                                              /* set the status */
+        }
+        else if (strcmp(key, "thermistor") == 0)                                         /* thermistor */
+        {
+            res = a_serializer_read_int(r, &value);                                      /* read the value */
+            if (value < 0)                                                               /* negative */
+            {
+                frame->thermistor = (int16_t)(0x800 | ((-value) & 0x7FF));               /* sign and magnitude */
+            }
+            else
+            {
+                frame->thermistor = (int16_t)(value & 0x7FF);                            /* magnitude */
+            }
+        }
+        else if (strcmp(key, "pixels") == 0)                                             /* pixels */
+        {
+            res = a_serializer_read_head(r, &kind, &value);                              /* read the array head */
+            if (res != 0)                                                                /* check the result */
+            {
+                return res;                                                              /* return the result */
+            }
+            if ((kind != SERIALIZER_KIND_ARRAY) || (value != 64))                        /* check the array */
+            {
+                return 4;                                                                /* return error */
+            }
+            for (i = 0; (i < 64) && (res == 0); i++)                                     /* read all pixels */
+            {
+                res = a_serializer_read_int(r, &value);                                  /* read the value */
+                frame->raw[126 - i * 2] = (uint8_t)((uint16_t)value >> 0);               /* set the lsb */
+                frame->raw[127 - i * 2] = (uint8_t)((uint16_t)value >> 8);               /* set the msb */
+            }
+        }
+        else if (strcmp(key, "interrupt") == 0)                                          /* interrupt */
+        {
+            res = a_serializer_read_head(r, &kind, &value);                              /* read the string head */
+            if (res != 0)                                                                /* check the result */
+            {
+                return res;                                                              /* return the result */
+            }
+            if ((kind != SERIALIZER_KIND_BSTR) || (value != 8))                          /* check the string */
+            {
+                return 4;                                                                /* return error */
+            }
+            if (r->pos + 8 > r->len)                                                     /* check the length */
+            {
+                return 1;                                                                /* need more data */
+            }
+            memcpy(frame->interrupt, &r->buf[r->pos], 8);                                /* copy the table */
+            r->pos = (uint16_t)(r->pos + 8);                                             /* skip the table */
+        }
+        else
+        {
+            res = a_serializer_skip_item(r, SERIALIZER_MAX_DEPTH);                       /* skip unknown entry */
+        }
+        if (res != 0)                                                                    /* check the result */
+        {
+            return res;                                                                  /* return the result */
+        }
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      serialize a frame
+ * @param[in]  format is the serializer format
+ * @param[in]  *frame points to a frame structure
+ * @param[out] *buf points to a data buffer
+ * @param[in]  size is the data buffer size
+ * @param[out] *len points to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 frame or buf is NULL
+ *             - 5 format is invalid
+ * @note       the frame is written in one pass without any heap allocation
+ */
+uint8_t amg8833_serializer_encode(amg8833_serializer_format_t format, const amg8833_frame_t *frame,
+                                  uint8_t *buf, uint16_t size, uint16_t *len)
+{
+    serializer_writer_t w;
+    int16_t thermistor;
+    uint8_t i;
+    
+    if ((frame == NULL) || (buf == NULL))                                                /* check frame and buf */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if ((format != AMG8833_SERIALIZER_FORMAT_CBOR) &&                                    /* check format */
+        (format != AMG8833_SERIALIZER_FORMAT_MSGPACK))
+    {
+        return 5;                                                                        /* return error */
+    }
+    if (size < AMG8833_SERIALIZER_MAX_SIZE)                                              /* check size */
+    {
+        return 1;                                                                        /* return error */
+    }
+    
+    w.buf = buf;                                                                         /* set the buffer */
+    w.len = 0;                                                                           /* init the length */
+    w.format = (uint8_t)format;                                                          /* set the format */
+    if (format == AMG8833_SERIALIZER_FORMAT_CBOR)                                        /* cbor */
+    {
+        w.buf[w.len++] = 0xA6;                                                           /* map of 6 */
+    }
+    else
+    {
+        w.buf[w.len++] = 0x86;                                                           /* fixmap of 6 */
+    }
+    a_serializer_write_key(&w, "ts");                                                    /* timestamp */
+    a_serializer_write_uint(&w, frame->timestamp);                                       /* set the timestamp */
+    a_serializer_write_key(&w, "addr");                                                  /* address */
+    a_serializer_write_uint(&w, frame->addr);                                            /* set the address */
+    a_serializer_write_key(&w, "pixels");                                                /* pixels */
+    if (format == AMG8833_SERIALIZER_FORMAT_CBOR)                                        /* cbor */
+    {
+        a_serializer_cbor_head(&w, 4, 64);                                               /* array of 64 */
+    }
+    else
+    {
+        w.buf[w.len++] = 0xDC;                                                           /* array 16 */
+        a_serializer_put_be(&w, 64, 2);                                                  /* 64 items */
+    }
+    for (i = 0; i < 64; i++)                                                             /* pixel_64 first */
+    {
+        a_serializer_write_int(&w, amg8833_frame_get_pixel(frame, i));                   /* set the pixel */
+    }
+    a_serializer_write_key(&w, "thermistor");                                            /* thermistor */
+    thermistor = (int16_t)(frame->thermistor & 0x7FF);                                   /* get the magnitude */
+    if ((frame->thermistor & 0x800) != 0)                                                /* if negtive */
+    {
+        thermistor = (int16_t)(-thermistor);                                             /* x (-1) */
+    }
+    a_serializer_write_int(&w, thermistor);                                              /* set the thermistor */
+    a_serializer_write_key(&w, "status");                                                /* status */
+    a_serializer_write_uint(&w, frame->status);                                          /* set the status */
+    a_serializer_write_key(&w, "interrupt");                                             /* interrupt */
+    if (format == AMG8833_SERIALIZER_FORMAT_CBOR)                                        /* cbor */
+    {
+        w.buf[w.len++] = 0x48;                                                           /* byte string of 8 */
+    }
+    else
+    {
+        w.buf[w.len++] = 0xC4;                                                           /* bin 8 */
+        w.buf[w.len++] = 0x08;                                                           /* 8 bytes */
+    }
+    memcpy(&w.buf[w.len], frame->interrupt, 8);                                          /* copy the table */
+    w.len = (uint16_t)(w.len + 8);                                                       /* add the length */
+    *len = w.len;                                                                        /* set the length */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder points to a decoder structure
+ * @param[in] format is the serializer format
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ *            - 5 format is invalid
+ * @note      none
+ */
+uint8_t amg8833_serializer_decoder_init(amg8833_serializer_decoder_t *decoder, amg8833_serializer_format_t format)
+{
+    if (decoder == NULL)                                                 /* check decoder */
+    {
+        return 2;                                                        /* return error */
+    }
+    if ((format != AMG8833_SERIALIZER_FORMAT_CBOR) &&                    /* check format */
+        (format != AMG8833_SERIALIZER_FORMAT_MSGPACK))
+    {
+        return 5;                                                        /* return error */
+    }
+    
+    decoder->len = 0;                                                    /* clear the buffer */
+    decoder->format = (uint8_t)format;                                   /* set the format */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      decode the received stream
+ * @param[in]  *decoder points to a decoder structure
+ * @param[in]  *buf points to a received data buffer
+ * @param[in]  len is the received data length
+ * @param[out] *used points to a used length buffer
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 2 decoder is NULL
+ *             - 4 item is invalid
+ * @note       decoding stops after each frame, so call it again with buf + used until all the data is used,
+ *             unknown map entries are skipped and the decoder is reset after an invalid item
+ */
+uint8_t amg8833_serializer_decode(amg8833_serializer_decoder_t *decoder, const uint8_t *buf, uint16_t len,
+                                  uint16_t *used, amg8833_frame_t *frame)
+{
+    uint8_t res;
+    uint16_t n;
+    uint16_t prev;
+    serializer_reader_t r;
+    
+    if ((decoder == NULL) || (buf == NULL) || (used == NULL) || (frame == NULL))         /* check decoder */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    prev = decoder->len;                                                                 /* save the buffered length */
+    n = (uint16_t)(AMG8833_SERIALIZER_MAX_SIZE - prev);                                  /* get the free space */
+    if (n > len)                                                                         /* check the length */
+    {
+        n = len;                                                                         /* copy all */
+    }
+    memcpy(&decoder->buf[prev], buf, n);                                                 /* append the data */
+    decoder->len = (uint16_t)(prev + n);                                                 /* add the length */
+    
+    r.buf = decoder->buf;                                                                /* set the buffer */
+    r.len = decoder->len;                                                                /* set the length */
+    r.pos = 0;                                                                           /* init the position */
+    r.format = decoder->format;                                                          /* set the format */
+    memset(frame, 0, sizeof(amg8833_frame_t));                                           /* clear the frame */
+    res = a_serializer_parse(&r, frame);                                                 /* parse the frame */
+    if (res == 0)                                                                        /* frame is complete */
+    {
+        *used = (uint16_t)(r.pos - prev);                                                /* set the used length */
+        decoder->len = 0;                                                                /* clear the buffer */
+        
+        return 0;                                                                        /* success return 0 */
+    }
+    *used = n;                                                                           /* all copied data is used */
+    if ((res == 1) && (decoder->len < AMG8833_SERIALIZER_MAX_SIZE))                      /* need more data */
+    {
+        return 1;                                                                        /* need more data */
+    }
+    decoder->len = 0;                                                                    /* reset the decoder */
+    
+    return 4;                                                                            /* return error */
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_serializer.h
+ * @brief     driver amg8833 serializer header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_SERIALIZER_H
+#define DRIVER_AMG8833_SERIALIZER_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_serializer_driver amg8833 serializer driver function
+ * @brief    amg8833 serializer driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 serializer definition
+ * @note  a frame is a map of six entries:
+ *        "ts" is the timestamp in ms,
+ *        "addr" is the iic address,
+ *        "pixels" is an array of 64 raw pixels (0.25C/LSB) in amg8833_read_temperature_array order,
+ *        "thermistor" is the signed thermistor raw data (0.0625C/LSB),
+ *        "status" is the status register,
+ *        "interrupt" is an 8 bytes string in amg8833_get_interrupt_table order
+ */
+#define AMG8833_SERIALIZER_MAX_SIZE        272        /**< max encoded frame size */
+
+/**
+ * @brief amg8833 serializer format enumeration definition
+ */
+typedef enum
+{
+    AMG8833_SERIALIZER_FORMAT_CBOR    = 0x00,        /**< cbor, rfc 8949 */
+    AMG8833_SERIALIZER_FORMAT_MSGPACK = 0x01,        /**< messagepack */
+} amg8833_serializer_format_t;
+
+/**
+ * @brief amg8833 serializer decoder structure definition
+ */
+typedef struct amg8833_serializer_decoder_s
+{
+    uint8_t buf[AMG8833_SERIALIZER_MAX_SIZE];        /**< item buffer */
+    uint16_t len;                                    /**< item buffer length */
+    uint8_t format;                                  /**< format */
+} amg8833_serializer_decoder_t;
+
+/**
+ * @brief      serialize a frame
+ * @param[in]  format is the serializer format
+ * @param[in]  *frame points to a frame structure
+ * @param[out] *buf points to a data buffer
+ * @param[in]  size is the data buffer size
+ * @param[out] *len points to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 frame or buf is NULL
+ *             - 5 format is invalid
+ * @note       the frame is written in one pass without any heap allocation
+ */
+uint8_t amg8833_serializer_encode(amg8833_serializer_format_t format, const amg8833_frame_t *frame,
+                                  uint8_t *buf, uint16_t size, uint16_t *len);
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder points to a decoder structure
+ * @param[in] format is the serializer format
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ *            - 5 format is invalid
+ * @note      none
+ */
+uint8_t amg8833_serializer_decoder_init(amg8833_serializer_decoder_t *decoder, amg8833_serializer_format_t format);
+
+/**
+ * @brief      decode the received stream
+ * @param[in]  *decoder points to a decoder structure
+ * @param[in]  *buf points to a received data buffer
+ * @param[in]  len is the received data length
+ * @param[out] *used points to a used length buffer
+ * @param[out] *frame points to a frame structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 need more data
+ *             - 2 decoder is NULL
+ *             - 4 item is invalid
+ * @note       decoding stops after each frame, so call it again with buf + used until all the data is used,
+ *             unknown map entries are skipped and the decoder is reset after an invalid item
+ */
+uint8_t amg8833_serializer_decode(amg8833_serializer_decoder_t *decoder, const uint8_t *buf, uint16_t len,
+                                  uint16_t *used, amg8833_frame_t *frame);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_softint.c
+ * @brief     driver amg8833 softint source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_softint.h"
+
+/**
+ * @brief     initialize the software interrupt
+ * @param[in] *softint points to a softint structure
+ * @param[in] mode is the interrupt mode
+ * @param[in] high is the high level of all pixels
+ * @param[in] low is the low level of all pixels
+ * @param[in] hysteresis is the hysteresis level of all pixels
+ * @return    status code
+ *            - 0 success
+ *            - 2 softint is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_softint_init(amg8833_softint_t *softint, amg8833_interrupt_mode_t mode,
+                             int16_t high, int16_t low, int16_t hysteresis)
+{
+    if (softint == NULL)                                                             /* check softint */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if ((mode != AMG8833_INTERRUPT_MODE_DIFFERENCE) &&
+        (mode != AMG8833_INTERRUPT_MODE_ABSOLUTE))                                   /* check mode */
+    {
+        return 5;                                                                    /* return error */
+    }
+    
+    memset(softint, 0, sizeof(amg8833_softint_t));                                   /* clear the softint */
+    softint->mode = mode;                                                            /* set the mode */
+    
+    return amg8833_softint_set_level(softint, 0xFFFFFFFFFFFFFFFFULL,
+                                     high, low, hysteresis);                         /* set all the pixels */
+}
+
+/**
+ * @brief     set the levels of a group of pixels
+ * @param[in] *softint points to a softint structure
+ * @param[in] mask is the pixel mask, bit (row * 8 + col)
+ * @param[in] high is the high level
+ * @param[in] low is the low level
+ * @param[in] hysteresis is the hysteresis level
+ * @return    status code
+ *            - 0 success
+ *            - 2 softint is NULL
+ *            - 5 param is invalid
+ * @note      one call per zone lets zones with different limits share one sensor
+ */
+uint8_t amg8833_softint_set_level(amg8833_softint_t *softint, uint64_t mask, int16_t high, int16_t low, int16_t hysteresis)
+{
+    uint8_t i;
+    
+    if (softint == NULL)                                                     /* check softint */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((low > high) || (hysteresis < 0))                                    /* check param */
+    {
+        return 5;                                                            /* return error */
+    }
+    
+    for (i = 0; i < 64; i++)                                                 /* 64 pixels */
+    {
+        if (((mask >> i) & 0x01) != 0)                                       /* in the group */
+        {
+            softint->high[i] = high;                                         /* set the high level */
+            softint->low[i] = low;                                           /* set the low level */
+            softint->hysteresis[i] = hysteresis;                             /* set the hysteresis level */
+        }
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      evaluate the software interrupt on a frame
+ * @param[in]  *softint points to a softint structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] table is the interrupt table in amg8833_get_interrupt_table format, it can be NULL
+ * @param[out] *mask points to an interrupt mask buffer, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 softint or raw is NULL
+ * @note       like the chip, a pixel goes active above high or below low and stays active until it falls
+ *             below high - hysteresis or rises above low + hysteresis, in the difference mode the levels
+ *             apply to the change from the previous frame, the mask has bit (row * 8 + col)
+ */
+uint8_t amg8833_softint_update(amg8833_softint_t *softint, int16_t raw[8][8], uint8_t table[8][1], uint64_t *mask)
+{
+    const int16_t *z;
+    uint64_t high;
+    uint64_t low;
+    uint64_t x;
+    int32_t v;
+    uint8_t hi;
+    uint8_t lo;
+    uint8_t i;
+    
+    if ((softint == NULL) || (raw == NULL))                                                          /* check param */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    z = &raw[0][0];                                                                                  /* flat input */
+    if ((softint->mode == AMG8833_INTERRUPT_MODE_DIFFERENCE) && (softint->seeded == 0))              /* first frame */
+    {
+        memcpy(softint->prev, z, sizeof(softint->prev));                                             /* no change */
+    }
+    softint->seeded = 1;                                                                             /* seeded */
+    high = softint->high_active;                                                                     /* last high state */
+    low = softint->low_active;                                                                       /* last low state */
+    for (i = 0; i < 64; i++)                                                                         /* 64 pixels */
+    {
+        v = (softint->mode == AMG8833_INTERRUPT_MODE_DIFFERENCE) ?
+            ((int32_t)z[i] - softint->prev[i]) : (int32_t)z[i];                                      /* compared value */
+        softint->prev[i] = z[i];                                                                     /* save the raw */
+        hi = (uint8_t)(((high >> i) & 0x01) ?
+             (v >= (int32_t)softint->high[i] - softint->hysteresis[i]) : (v > softint->high[i]));    /* high with hysteresis */
+        lo = (uint8_t)(((low >> i) & 0x01) ?
+             (v <= (int32_t)softint->low[i] + softint->hysteresis[i]) : (v < softint->low[i]));      /* low with hysteresis */
+        high = (high & ~(1ULL << i)) | ((uint64_t)hi << i);                                          /* update the high state */
+        low = (low & ~(1ULL << i)) | ((uint64_t)lo << i);                                            /* update the low state */
+    }
+    softint->high_active = high;                                                                     /* save the high state */
+    softint->low_active = low;                                                                       /* save the low state */
+    x = high | low;                                                                                  /* active pixels */
+    if (mask != NULL)                                                                                /* check the mask */
+    {
+        *mask = x;                                                                                   /* set the mask */
+    }
+    if (table != NULL)                                                                               /* check the table */
+    {
+        for (i = 0; i < 8; i++)                                                                      /* 8 rows */
+        {
+            v = (int32_t)((x >> (i * 8)) & 0xFF);                                                    /* row bits */
+            v = ((v >> 1) & 0x55) | ((v & 0x55) << 1);                                               /* swap bits */
+            v = ((v >> 2) & 0x33) | ((v & 0x33) << 2);                                               /* swap bit pairs */
+            v = ((v >> 4) & 0x0F) | ((v & 0x0F) << 4);                                               /* swap nibbles */
+            table[i][0] = (uint8_t)v;                                                                /* col 0 is bit 7 */
+        }
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_softint.h
+ * @brief     driver amg8833 softint header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_SOFTINT_H
+#define DRIVER_AMG8833_SOFTINT_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_softint_driver amg8833 softint driver function
+ * @brief    amg8833 softint driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 softint structure definition
+ * @note  levels are raw data (0.25C/LSB) like the interrupt level registers,
+ *        arrays are indexed row * 8 + col in amg8833_read_temperature_array order
+ */
+typedef struct amg8833_softint_s
+{
+    amg8833_interrupt_mode_t mode;        /**< interrupt mode */
+    uint8_t seeded;                       /**< seeded flag */
+    uint64_t high_active;                 /**< pixels above the high level */
+    uint64_t low_active;                  /**< pixels below the low level */
+    int16_t high[64];                     /**< high levels */
+    int16_t low[64];                      /**< low levels */
+    int16_t hysteresis[64];               /**< hysteresis levels */
+    int16_t prev[64];                     /**< previous raw data for the difference mode */
+} amg8833_softint_t;
+
+/**
+ * @brief     initialize the software interrupt
+ * @param[in] *softint points to a softint structure
+ * @param[in] mode is the interrupt mode
+ * @param[in] high is the high level of all pixels
+ * @param[in] low is the low level of all pixels
+ * @param[in] hysteresis is the hysteresis level of all pixels
+ * @return    status code
+ *            - 0 success
+ *            - 2 softint is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_softint_init(amg8833_softint_t *softint, amg8833_interrupt_mode_t mode,
+                             int16_t high, int16_t low, int16_t hysteresis);
+
+/**
+ * @brief     set the levels of a group of pixels
+ * @param[in] *softint points to a softint structure
+ * @param[in] mask is the pixel mask, bit (row * 8 + col)
+ * @param[in] high is the high level
+ * @param[in] low is the low level
+ * @param[in] hysteresis is the hysteresis level
+ * @return    status code
+ *            - 0 success
+ *            - 2 softint is NULL
+ *            - 5 param is invalid
+ * @note      one call per zone lets zones with different limits share one sensor
+ */
+uint8_t amg8833_softint_set_level(amg8833_softint_t *softint, uint64_t mask, int16_t high, int16_t low, int16_t hysteresis);
+
+/**
+ * @brief      evaluate the software interrupt on a frame
+ * @param[in]  *softint points to a softint structure
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] table is the interrupt table in amg8833_get_interrupt_table format, it can be NULL
+ * @param[out] *mask points to an interrupt mask buffer, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 softint or raw is NULL
+ * @note       like the chip, a pixel goes active above high or below low and stays active until it falls
+ *             below high - hysteresis or rises above low + hysteresis, in the difference mode the levels
+ *             apply to the change from the previous frame, the mask has bit (row * 8 + col)
+ */
+uint8_t amg8833_softint_update(amg8833_softint_t *softint, int16_t raw[8][8], uint8_t table[8][1], uint64_t *mask);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stats.c
+ * @brief     driver amg8833 stats source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_stats.h"
+
+/**
+ * @brief     get the histogram bin of a raw data
+ * @param[in] v is the raw data
+ * @return    bin
+ * @note      out of range raw data is clamped
+ */
+static uint16_t a_stats_bin(int16_t v)
+{
+    int32_t b;
+    
+    b = (int32_t)v + AMG8833_STATS_HISTOGRAM_OFFSET;                                      /* offset */
+    b = (b < 0) ? 0 : ((b > (AMG8833_STATS_HISTOGRAM_SIZE - 1)) ?
+        (AMG8833_STATS_HISTOGRAM_SIZE - 1) : b);                                          /* clamp */
+    
+    return (uint16_t)b;                                                                   /* return the bin */
+}
+
+/**
+ * @brief     initialize the stats
+ * @param[in] *stats points to a stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ * @note      none
+ */
+uint8_t amg8833_stats_init(amg8833_stats_t *stats)
+{
+    if (stats == NULL)                                     /* check stats */
+    {
+        return 2;                                          /* return error */
+    }
+    
+    memset(stats, 0, sizeof(amg8833_stats_t));             /* clear the stats */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     compute the stats of a frame
+ * @param[in] *stats points to a stats structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats or raw is NULL
+ * @note      all the stats and the histogram are computed in one pass,
+ *            only the histogram bins of the last frame range are cleared
+ */
+uint8_t amg8833_stats_update(amg8833_stats_t *stats, int16_t raw[8][8])
+{
+    const int16_t *z;
+    int32_t sum;
+    uint32_t sum2;
+    uint16_t low;
+    uint16_t high;
+    int16_t min;
+    int16_t max;
+    int16_t v;
+    uint8_t argmin;
+    uint8_t argmax;
+    uint8_t i;
+    
+    if ((stats == NULL) || (raw == NULL))                                                     /* check param */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    low = a_stats_bin(stats->min);                                                            /* last low bin */
+    high = a_stats_bin(stats->max);                                                           /* last high bin */
+    memset(&stats->histogram[low], 0, (size_t)(high - low + 1));                              /* clear the last range */
+    z = &raw[0][0];                                                                           /* flat input */
+    min = z[0];                                                                               /* init the min */
+    max = z[0];                                                                               /* init the max */
+    argmin = 0;                                                                               /* init 0 */
+    argmax = 0;                                                                               /* init 0 */
+    sum = 0;                                                                                  /* init 0 */
+    sum2 = 0;                                                                                 /* init 0 */
+    for (i = 0; i < 64; i++)                                                                  /* one pass */
+    {
+        v = z[i];                                                                             /* get the raw */
+        sum += v;                                                                             /* sum */
+        sum2 += (uint32_t)((int32_t)v * v);                                                   /* square sum */
+        stats->histogram[a_stats_bin(v)]++;                                                   /* histogram */
+        argmin = (v < min) ? i : argmin;                                                      /* select the min index */
+        min = (v < min) ? v : min;                                                            /* select the min */
+        argmax = (v > max) ? i : argmax;                                                      /* select the max index */
+        max = (v > max) ? v : max;                                                            /* select the max */
+    }
+    stats->min = min;                                                                         /* set the min */
+    stats->max = max;                                                                         /* set the max */
+    stats->argmin = argmin;                                                                   /* set the min index */
+    stats->argmax = argmax;                                                                   /* set the max index */
+    stats->sum = sum;                                                                         /* set the sum */
+    stats->sum2 = sum2;                                                                       /* set the square sum */
+    stats->mean = (float)sum / 64.0f * 0.25f;                                                 /* convert the mean */
+    stats->variance = (float)((int64_t)sum2 * 64 - (int64_t)sum * sum) /
+                      (64.0f * 64.0f) * 0.0625f;                                              /* exact numerator, convert the variance */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get a percentile of the last frame
+ * @param[in]  *stats points to a stats structure
+ * @param[in]  percent is the percentile in 0 - 100
+ * @param[out] *raw points to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or raw is NULL
+ *             - 5 percent is invalid
+ * @note       nearest rank, only the bins between min and max are scanned
+ */
+uint8_t amg8833_stats_get_percentile(amg8833_stats_t *stats, float percent, int16_t *raw)
+{
+    uint16_t high;
+    uint16_t b;
+    uint8_t rank;
+    uint8_t n;
+    
+    if ((stats == NULL) || (raw == NULL))                                              /* check param */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((percent < 0.0f) || (percent > 100.0f))                                        /* check percent */
+    {
+        return 5;                                                                      /* return error */
+    }
+    
+    rank = (uint8_t)(percent * 64.0f / 100.0f);                                        /* floor rank */
+    if (((float)rank * 100.0f < percent * 64.0f) || (rank == 0))                       /* ceil, at least 1 */
+    {
+        rank++;                                                                        /* next rank */
+    }
+    b = a_stats_bin(stats->min);                                                       /* low bin */
+    high = a_stats_bin(stats->max);                                                    /* high bin */
+    n = stats->histogram[b];                                                           /* first bin */
+    while ((n < rank) && (b < high))                                                   /* cumulate */
+    {
+        b++;                                                                           /* next bin */
+        n = (uint8_t)(n + stats->histogram[b]);                                        /* add the bin */
+    }
+    *raw = (int16_t)((int32_t)b - AMG8833_STATS_HISTOGRAM_OFFSET);                     /* set the raw */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     initialize the stats window
+ * @param[in] *window points to a stats window structure
+ * @param[in] *frame points to a frame ring buffer
+ * @param[in] size is the window size
+ * @return    status code
+ *            - 0 success
+ *            - 2 window or frame is NULL
+ *            - 5 size is invalid
+ * @note      frame must hold size frames
+ */
+uint8_t amg8833_stats_window_init(amg8833_stats_window_t *window, int16_t (*frame)[8][8], uint16_t size)
+{
+    if ((window == NULL) || (frame == NULL))                          /* check param */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (size == 0)                                                    /* check size */
+    {
+        return 5;                                                     /* return error */
+    }
+    
+    memset(window, 0, sizeof(amg8833_stats_window_t));                /* clear the window */
+    window->frame = frame;                                            /* set the ring buffer */
+    window->size = size;                                              /* set the size */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     add a frame to the stats window
+ * @param[in] *window points to a stats window structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @return    status code
+ *            - 0 success
+ *            - 2 window or raw is NULL
+ * @note      the oldest frame is removed from the sums once the window is full
+ */
+uint8_t amg8833_stats_window_update(amg8833_stats_window_t *window, int16_t raw[8][8])
+{
+    const int16_t *z;
+    int16_t *old;
+    int32_t v;
+    int32_t o;
+    uint8_t full;
+    uint8_t i;
+    
+    if ((window == NULL) || (raw == NULL))                                                   /* check param */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    z = &raw[0][0];                                                                          /* flat input */
+    old = &window->frame[window->pos][0][0];                                                 /* oldest frame slot */
+    full = (uint8_t)(window->count == window->size);                                         /* check the window */
+    for (i = 0; i < 64; i++)                                                                 /* 64 pixels */
+    {
+        v = z[i];                                                                            /* new raw */
+        o = full ? old[i] : 0;                                                               /* old raw */
+        window->sum[i] += v - o;                                                             /* update the sum */
+        window->sum2[i] += (uint64_t)(v * v);                                                /* add the new square */
+        window->sum2[i] -= (uint64_t)(o * o);                                                /* remove the old square */
+        old[i] = (int16_t)v;                                                                 /* save the new raw */
+    }
+    window->pos = (uint16_t)((window->pos + 1 == window->size) ? 0 : (window->pos + 1));     /* next slot */
+    if (full == 0)                                                                           /* growing */
+    {
+        window->count++;                                                                     /* count */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the per pixel window stats
+ * @param[in]  *window points to a stats window structure
+ * @param[out] mean is the mean array in C, it can be NULL
+ * @param[out] variance is the variance array in C^2, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 window is NULL
+ *             - 4 window is empty
+ * @note       none
+ */
+uint8_t amg8833_stats_window_get(amg8833_stats_window_t *window, float mean[8][8], float variance[8][8])
+{
+    int64_t num;
+    float n;
+    uint8_t i;
+    
+    if (window == NULL)                                                                        /* check window */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (window->count == 0)                                                                    /* check the count */
+    {
+        return 4;                                                                              /* return error */
+    }
+    
+    n = (float)window->count;                                                                  /* frame count */
+    for (i = 0; i < 64; i++)                                                                   /* 64 pixels */
+    {
+        if (mean != NULL)                                                                      /* check the mean */
+        {
+            mean[i / 8][i % 8] = (float)window->sum[i] / n * 0.25f;                            /* convert the mean */
+        }
+        if (variance != NULL)                                                                  /* check the variance */
+        {
+            num = (int64_t)window->sum2[i] * window->count -
+                  (int64_t)window->sum[i] * window->sum[i];                                    /* exact numerator */
+            variance[i / 8][i % 8] = (float)num / (n * n) * 0.0625f;                           /* convert the variance */
+        }
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
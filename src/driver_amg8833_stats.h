@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stats.h
+ * @brief     driver amg8833 stats header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_STATS_H
+#define DRIVER_AMG8833_STATS_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_stats_driver amg8833 stats driver function
+ * @brief    amg8833 stats driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 stats definition
+ * @note  the histogram has one bin per 12 bits raw data, bin (raw + AMG8833_STATS_HISTOGRAM_OFFSET)
+ */
+#define AMG8833_STATS_HISTOGRAM_SIZE          4096        /**< histogram bins */
+#define AMG8833_STATS_HISTOGRAM_OFFSET        2048        /**< histogram bin of raw data 0 */
+
+/**
+ * @brief amg8833 stats structure definition
+ * @note  index is row * 8 + col in amg8833_read_temperature_array order
+ */
+typedef struct amg8833_stats_s
+{
+    int16_t min;                                          /**< min raw data */
+    int16_t max;                                          /**< max raw data */
+    uint8_t argmin;                                       /**< first min index */
+    uint8_t argmax;                                       /**< first max index */
+    int32_t sum;                                          /**< raw data sum */
+    uint32_t sum2;                                        /**< raw data square sum */
+    float mean;                                           /**< mean in C */
+    float variance;                                       /**< variance in C^2 */
+    uint8_t histogram[AMG8833_STATS_HISTOGRAM_SIZE];      /**< histogram */
+} amg8833_stats_t;
+
+/**
+ * @brief amg8833 stats window structure definition
+ */
+typedef struct amg8833_stats_window_s
+{
+    int16_t (*frame)[8][8];        /**< frame ring buffer */
+    uint16_t size;                 /**< window size */
+    uint16_t count;                /**< frames in the window */
+    uint16_t pos;                  /**< next ring position */
+    int32_t sum[64];               /**< per pixel raw data sum */
+    uint64_t sum2[64];             /**< per pixel raw data square sum */
+} amg8833_stats_window_t;
+
+/**
+ * @brief     initialize the stats
+ * @param[in] *stats points to a stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ * @note      none
+ */
+uint8_t amg8833_stats_init(amg8833_stats_t *stats);
+
+/**
+ * @brief     compute the stats of a frame
+ * @param[in] *stats points to a stats structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats or raw is NULL
+ * @note      all the stats and the histogram are computed in one pass,
+ *            only the histogram bins of the last frame range are cleared
+ */
+uint8_t amg8833_stats_update(amg8833_stats_t *stats, int16_t raw[8][8]);
+
+/**
+ * @brief      get a percentile of the last frame
+ * @param[in]  *stats points to a stats structure
+ * @param[in]  percent is the percentile in 0 - 100
+ * @param[out] *raw points to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or raw is NULL
+ *             - 5 percent is invalid
+ * @note       nearest rank, only the bins between min and max are scanned
+ */
+uint8_t amg8833_stats_get_percentile(amg8833_stats_t *stats, float percent, int16_t *raw);
+
+/**
+ * @brief     initialize the stats window
+ * @param[in] *window points to a stats window structure
+ * @param[in] *frame points to a frame ring buffer
+ * @param[in] size is the window size
+ * @return    status code
+ *            - 0 success
+ *            - 2 window or frame is NULL
+ *            - 5 size is invalid
+ * @note      frame must hold size frames
+ */
+uint8_t amg8833_stats_window_init(amg8833_stats_window_t *window, int16_t (*frame)[8][8], uint16_t size);
+
+/**
+ * @brief     add a frame to the stats window
+ * @param[in] *window points to a stats window structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @return    status code
+ *            - 0 success
+ *            - 2 window or raw is NULL
+ * @note      the oldest frame is removed from the sums once the window is full
+ */
+uint8_t amg8833_stats_window_update(amg8833_stats_window_t *window, int16_t raw[8][8]);
+
+/**
+ * @brief      get the per pixel window stats
+ * @param[in]  *window points to a stats window structure
+ * @param[out] mean is the mean array in C, it can be NULL
+ * @param[out] variance is the variance array in C^2, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 window is NULL
+ *             - 4 window is empty
+ * @note       none
+ */
+uint8_t amg8833_stats_window_get(amg8833_stats_window_t *window, float mean[8][8], float variance[8][8]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
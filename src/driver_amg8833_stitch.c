@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stitch.c
+ * @brief     driver amg8833 stitch source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_stitch.h"
+
+/**
+ * @brief     initialize the stitch
+ * @param[in] *stitch points to a stitch structure
+ * @param[in] *start points to a start array
+ * @param[in] start_max is the start array size
+ * @param[in] *tap points to a tap array
+ * @param[in] tap_max is the tap array size
+ * @return    status code
+ *            - 0 success
+ *            - 2 stitch, start or tap is NULL
+ * @note      start needs width * height + 1 entries, tap needs at most 4 entries per sensor per mosaic pixel
+ */
+uint8_t amg8833_stitch_init(amg8833_stitch_t *stitch, uint32_t *start, uint32_t start_max,
+                            amg8833_stitch_tap_t *tap, uint32_t tap_max)
+{
+    if ((stitch == NULL) || (start == NULL) || (tap == NULL))        /* check param */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    memset(stitch, 0, sizeof(amg8833_stitch_t));                     /* clear the stitch */
+    stitch->start = start;                                           /* set the start array */
+    stitch->start_max = start_max;                                   /* set the start array size */
+    stitch->tap = tap;                                               /* set the tap array */
+    stitch->tap_max = tap_max;                                       /* set the tap array size */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     compile the remap table
+ * @param[in] *stitch points to a stitch structure
+ * @param[in] *sensor points to a sensor geometry array
+ * @param[in] count is the sensor count
+ * @param[in] width is the mosaic width
+ * @param[in] height is the mosaic height
+ * @return    status code
+ *            - 0 success
+ *            - 2 stitch or sensor is NULL
+ *            - 4 table is full
+ *            - 5 param is invalid
+ * @note      every sensor is sampled bilinearly and feathered towards its border,
+ *            the weights of a mosaic pixel are normalized to exactly 16384 and mosaic pixels outside all sensors have no tap
+ */
+uint8_t amg8833_stitch_compile(amg8833_stitch_t *stitch, const amg8833_stitch_sensor_t *sensor, uint8_t count,
+                               uint16_t width, uint16_t height)
+{
+    float w[4 * AMG8833_STITCH_MAX_SENSORS];
+    uint16_t src[4 * AMG8833_STITCH_MAX_SENSORS];
+    float a;
+    float b;
+    float u;
+    float v;
+    float fu;
+    float fv;
+    float wu;
+    float wv;
+    float feather;
+    float total;
+    uint32_t used;
+    uint32_t sum;
+    uint32_t p;
+    uint16_t q;
+    uint16_t best;
+    uint8_t n;
+    uint8_t s;
+    uint8_t k;
+    int8_t u0;
+    int8_t v0;
+    uint16_t x;
+    uint16_t y;
+    
+    if ((stitch == NULL) || (sensor == NULL))                                                     /* check param */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if ((count == 0) || (count > AMG8833_STITCH_MAX_SENSORS) || (width == 0) || (height == 0))    /* check param */
+    {
+        return 5;                                                                                 /* return error */
+    }
+    for (s = 0; s < count; s++)                                                                   /* check the sensors */
+    {
+        if ((sensor[s].scale <= 0.0f) || (sensor[s].rotation > AMG8833_STITCH_ROTATION_270))      /* check the geometry */
+        {
+            return 5;                                                                             /* return error */
+        }
+    }
+    if ((uint32_t)width * height + 1 > stitch->start_max)                                         /* check the start array */
+    {
+        return 4;                                                                                 /* return error */
+    }
+    
+    used = 0;                                                                                     /* init 0 */
+    for (y = 0; y < height; y++)                                                                  /* mosaic rows */
+    {
+        for (x = 0; x < width; x++)                                                               /* mosaic cols */
+        {
+            n = 0;                                                                                /* init 0 */
+            total = 0.0f;                                                                         /* init 0 */
+            for (s = 0; s < count; s++)                                                           /* bilinear taps of every covering sensor */
+            {
+                a = ((float)y - sensor[s].row) / sensor[s].scale;                                 /* sensor row */
+                b = ((float)x - sensor[s].col) / sensor[s].scale;                                 /* sensor col */
+                if (sensor[s].rotation == AMG8833_STITCH_ROTATION_90)                             /* rotate 90 */
+                {
+                    u = 7.0f - b;                                                                 /* row */
+                    v = a;                                                                        /* col */
+                }
+                else if (sensor[s].rotation == AMG8833_STITCH_ROTATION_180)                       /* rotate 180 */
+                {
+                    u = 7.0f - a;                                                                 /* row */
+                    v = 7.0f - b;                                                                 /* col */
+                }
+                else if (sensor[s].rotation == AMG8833_STITCH_ROTATION_270)                       /* rotate 270 */
+                {
+                    u = b;                                                                        /* row */
+                    v = 7.0f - a;                                                                 /* col */
+                }
+                else
+                {
+                    u = a;                                                                        /* row */
+                    v = b;                                                                        /* col */
+                }
+                if ((u < -0.5f) || (u > 7.5f) || (v < -0.5f) || (v > 7.5f))                       /* not covered */
+                {
+                    continue;                                                                     /* skip */
+                }
+                feather = u + 0.5f;                                                               /* feather by the distance to the sensor border */
+                feather = (7.5f - u < feather) ? (7.5f - u) : feather;                            /* bottom border */
+                feather = (v + 0.5f < feather) ? (v + 0.5f) : feather;                            /* left border */
+                feather = (7.5f - v < feather) ? (7.5f - v) : feather;                            /* right border */
+                u = (u < 0.0f) ? 0.0f : ((u > 7.0f) ? 7.0f : u);                                  /* clamp the row */
+                v = (v < 0.0f) ? 0.0f : ((v > 7.0f) ? 7.0f : v);                                  /* clamp the col */
+                u0 = (int8_t)((u >= 7.0f) ? 6 : (int8_t)u);                                       /* top left row */
+                v0 = (int8_t)((v >= 7.0f) ? 6 : (int8_t)v);                                       /* top left col */
+                fu = u - (float)u0;                                                               /* row fraction */
+                fv = v - (float)v0;                                                               /* col fraction */
+                for (k = 0; k < 4; k++)                                                           /* 4 taps */
+                {
+                    wu = ((k & 0x02) != 0) ? fu : (1.0f - fu);                                    /* row weight */
+                    wv = ((k & 0x01) != 0) ? fv : (1.0f - fv);                                    /* col weight */
+                    w[n] = feather * wu * wv;                                                     /* feathered bilinear weight */
+                    src[n] = (uint16_t)((u0 + ((k >> 1) & 0x01)) * 8 + (v0 + (k & 0x01)));        /* pixel of the sensor */
+                    src[n] = (uint16_t)(src[n] + s * 64);                                         /* frame of the sensor */
+                    total += w[n];                                                                /* sum the weights */
+                    n++;                                                                          /* count */
+                }
+            }
+            
+            p = (uint32_t)y * width + x;                                                          /* mosaic pixel */
+            stitch->start[p] = used;                                                              /* first tap of the pixel */
+            if (total <= 0.0f)                                                                    /* no covering sensor */
+            {
+                continue;                                                                         /* skip */
+            }
+            sum = 0;                                                                              /* init 0 */
+            best = 0;                                                                             /* init 0 */
+            for (k = 0; k < n; k++)                                                               /* quantize to 16384 in total */
+            {
+                q = (uint16_t)(w[k] / total * 16384.0f + 0.5f);                                   /* quantized weight */
+                if (q == 0)                                                                       /* too small */
+                {
+                    continue;                                                                     /* skip */
+                }
+                if (used >= stitch->tap_max)                                                      /* check the tap array */
+                {
+                    return 4;                                                                     /* return error */
+                }
+                stitch->tap[used].src = src[k];                                                   /* set the source */
+                stitch->tap[used].weight = q;                                                     /* set the weight */
+                if (q > stitch->tap[stitch->start[p] + best].weight)                              /* larger tap */
+                {
+                    best = (uint16_t)(used - stitch->start[p]);                                   /* save the largest */
+                }
+                sum += q;                                                                         /* sum the weights */
+                used++;                                                                           /* count */
+            }
+            if (used > stitch->start[p])                                                          /* any tap */
+            {
+                p = stitch->start[p] + best;                                                      /* largest tap */
+                stitch->tap[p].weight = (uint16_t)(stitch->tap[p].weight + 16384 - sum);          /* the rounding rest goes to the largest tap */
+            }
+        }
+    }
+    stitch->start[(uint32_t)width * height] = used;                                               /* end of the last pixel */
+    stitch->width = width;                                                                        /* set the width */
+    stitch->height = height;                                                                      /* set the height */
+    stitch->sensors = count;                                                                      /* set the sensor count */
+    stitch->tap_count = used;                                                                     /* set the tap count */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      stitch the frames
+ * @param[in]  *stitch points to a stitch structure
+ * @param[in]  raw is the raw array of every sensor from amg8833_read_temperature_array
+ * @param[out] *out points to a width * height raw data mosaic
+ * @param[out] *temp points to a width * height temperature mosaic, it can be NULL
+ * @param[in]  empty is the raw data of the mosaic pixels outside all sensors
+ * @return     status code
+ *             - 0 success
+ *             - 2 stitch, raw or out is NULL
+ * @note       one integer gather pass over the compiled taps
+ */
+uint8_t amg8833_stitch_run(amg8833_stitch_t *stitch, int16_t (*raw)[8][8], int16_t *out, float *temp, int16_t empty)
+{
+    const amg8833_stitch_tap_t *tap;
+    const int16_t *z;
+    uint32_t pixels;
+    uint32_t end;
+    uint32_t p;
+    uint32_t i;
+    int32_t acc;
+    
+    if ((stitch == NULL) || (raw == NULL) || (out == NULL))                                /* check param */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    z = &raw[0][0][0];                                                                     /* flat sources */
+    tap = stitch->tap;                                                                     /* taps */
+    pixels = (uint32_t)stitch->width * stitch->height;                                     /* mosaic pixels */
+    i = 0;                                                                                 /* first tap */
+    for (p = 0; p < pixels; p++)                                                           /* all mosaic pixels */
+    {
+        end = stitch->start[p + 1];                                                        /* last tap */
+        if (i == end)                                                                      /* not covered */
+        {
+            out[p] = empty;                                                                /* empty pixel */
+        }
+        else
+        {
+            acc = 0;                                                                       /* init 0 */
+            for (; i < end; i++)                                                           /* gather */
+            {
+                acc += (int32_t)tap[i].weight * z[tap[i].src];                             /* weighted sum */
+            }
+            out[p] = (int16_t)((acc + 8192) >> 14);                                        /* round */
+        }
+        if (temp != NULL)                                                                  /* check the temp */
+        {
+            temp[p] = (float)out[p] * 0.25f;                                               /* convert */
+        }
+    }
+    
+    return 0;                                                                              /* success return 0 */
+}
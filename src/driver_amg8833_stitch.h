@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stitch.h
+ * @brief     driver amg8833 stitch header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_STITCH_H
+#define DRIVER_AMG8833_STITCH_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_stitch_driver amg8833 stitch driver function
+ * @brief    amg8833 stitch driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 stitch definition
+ */
+#define AMG8833_STITCH_MAX_SENSORS        16        /**< max sensors */
+
+/**
+ * @brief amg8833 stitch rotation enumeration definition
+ */
+typedef enum
+{
+    AMG8833_STITCH_ROTATION_0   = 0x00,        /**< not rotated */
+    AMG8833_STITCH_ROTATION_90  = 0x01,        /**< rotated 90 degrees clockwise */
+    AMG8833_STITCH_ROTATION_180 = 0x02,        /**< rotated 180 degrees */
+    AMG8833_STITCH_ROTATION_270 = 0x03,        /**< rotated 270 degrees clockwise */
+} amg8833_stitch_rotation_t;
+
+/**
+ * @brief amg8833 stitch sensor structure definition
+ * @note  the sensor image from amg8833_read_temperature_array is rotated first,
+ *        then its pixel [0][0] center is placed at (row, col) of the mosaic with scale mosaic pixels per sensor pixel
+ */
+typedef struct amg8833_stitch_sensor_s
+{
+    float row;                                  /**< mosaic row of the first pixel center */
+    float col;                                  /**< mosaic col of the first pixel center */
+    float scale;                                /**< mosaic pixels per sensor pixel */
+    amg8833_stitch_rotation_t rotation;         /**< sensor rotation */
+} amg8833_stitch_sensor_t;
+
+/**
+ * @brief amg8833 stitch tap structure definition
+ */
+typedef struct amg8833_stitch_tap_s
+{
+    uint16_t src;            /**< source pixel, sensor * 64 + row * 8 + col */
+    uint16_t weight;         /**< weight, 16384 is 1.0 */
+} amg8833_stitch_tap_t;
+
+/**
+ * @brief amg8833 stitch structure definition
+ * @note  the taps of mosaic pixel p are tap[start[p]] to tap[start[p + 1] - 1]
+ */
+typedef struct amg8833_stitch_s
+{
+    uint16_t width;                    /**< mosaic width */
+    uint16_t height;                   /**< mosaic height */
+    uint8_t sensors;                   /**< sensor count */
+    uint32_t *start;                   /**< first tap of every mosaic pixel */
+    uint32_t start_max;                /**< start array size */
+    amg8833_stitch_tap_t *tap;         /**< tap array */
+    uint32_t tap_max;                  /**< tap array size */
+    uint32_t tap_count;                /**< compiled tap count */
+} amg8833_stitch_t;
+
+/**
+ * @brief     initialize the stitch
+ * @param[in] *stitch points to a stitch structure
+ * @param[in] *start points to a start array
+ * @param[in] start_max is the start array size
+ * @param[in] *tap points to a tap array
+ * @param[in] tap_max is the tap array size
+ * @return    status code
+ *            - 0 success
+ *            - 2 stitch, start or tap is NULL
+ * @note      start needs width * height + 1 entries, tap needs at most 4 entries per sensor per mosaic pixel
+ */
+uint8_t amg8833_stitch_init(amg8833_stitch_t *stitch, uint32_t *start, uint32_t start_max,
+                            amg8833_stitch_tap_t *tap, uint32_t tap_max);
+
+/**
+ * @brief     compile the remap table
+ * @param[in] *stitch points to a stitch structure
+ * @param[in] *sensor points to a sensor geometry array
+ * @param[in] count is the sensor count
+ * @param[in] width is the mosaic width
+ * @param[in] height is the mosaic height
+ * @return    status code
+ *            - 0 success
+ *            - 2 stitch or sensor is NULL
+ *            - 4 table is full
+ *            - 5 param is invalid
+ * @note      every sensor is sampled bilinearly and feathered towards its border,
+ *            the weights of a mosaic pixel are normalized to exactly 16384 and mosaic pixels outside all sensors have no tap
+ */
+uint8_t amg8833_stitch_compile(amg8833_stitch_t *stitch, const amg8833_stitch_sensor_t *sensor, uint8_t count,
+                               uint16_t width, uint16_t height);
+
+/**
+ * @brief      stitch the frames
+ * @param[in]  *stitch points to a stitch structure
+ * @param[in]  raw is the raw array of every sensor from amg8833_read_temperature_array
+ * @param[out] *out points to a width * height raw data mosaic
+ * @param[out] *temp points to a width * height temperature mosaic, it can be NULL
+ * @param[in]  empty is the raw data of the mosaic pixels outside all sensors
+ * @return     status code
+ *             - 0 success
+ *             - 2 stitch, raw or out is NULL
+ * @note       one integer gather pass over the compiled taps
+ */
+uint8_t amg8833_stitch_run(amg8833_stitch_t *stitch, int16_t (*raw)[8][8], int16_t *out, float *temp, int16_t empty);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
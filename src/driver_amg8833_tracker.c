@@ -0,0 +1,447 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_tracker.c
+ * @brief     driver amg8833 tracker source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_tracker.h"
+
+/**
+ * @brief tracker filter gain definition
+ */
+#define TRACKER_ALPHA        0.7f        /**< position gain */
+#define TRACKER_BETA         0.3f        /**< velocity gain */
+
+/**
+ * @brief tracker pair structure definition
+ */
+typedef struct tracker_pair_s
+{
+    float d2;             /**< squared distance */
+    uint8_t track;        /**< track index */
+    uint8_t det;          /**< detection index */
+} tracker_pair_t;
+
+/**
+ * @brief     get the side of the counting line
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] row is the point row
+ * @param[in] col is the point col
+ * @param[in] side is the last side
+ * @return    side
+ * @note      inside the dead band the last side is kept
+ */
+static int8_t a_tracker_side(amg8833_tracker_t *tracker, float row, float col, int8_t side)
+{
+    float s;
+    
+    s = tracker->line_a * row + tracker->line_b * col + tracker->line_c;      /* scaled signed distance */
+    if ((s * s) <= tracker->margin)                                           /* inside the dead band */
+    {
+        return side;                                                          /* keep the side */
+    }
+    else if (s > 0.0f)                                                        /* positive side */
+    {
+        return 1;                                                             /* return 1 */
+    }
+    else
+    {
+        return -1;                                                            /* return -1 */
+    }
+}
+
+/**
+ * @brief     initialize the tracker
+ * @param[in] *tracker points to a tracker structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ * @note      gate is 2 pixels, min area is 1, 2 hits confirm a track, 3 misses drop it and no line is set
+ */
+uint8_t amg8833_tracker_init(amg8833_tracker_t *tracker)
+{
+    if (tracker == NULL)                                          /* check tracker */
+    {
+        return 2;                                                 /* return error */
+    }
+    
+    memset(tracker, 0, sizeof(amg8833_tracker_t));                /* clear the tracker */
+    tracker->next_id = 1;                                         /* first id */
+    tracker->gate = 2.0f;                                         /* 2 pixels */
+    tracker->min_area = 1;                                        /* 1 pixel */
+    tracker->confirm_hits = 2;                                    /* 2 hits */
+    tracker->max_misses = 3;                                      /* 3 misses */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     set the association params
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] gate is the gate distance in pixels
+ * @param[in] min_area is the min detection area
+ * @param[in] confirm_hits is the hits to confirm a track
+ * @param[in] max_misses is the misses to drop a track
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_tracker_set_param(amg8833_tracker_t *tracker, float gate, uint8_t min_area,
+                                  uint8_t confirm_hits, uint8_t max_misses)
+{
+    if (tracker == NULL)                                                   /* check tracker */
+    {
+        return 2;                                                          /* return error */
+    }
+    if ((gate <= 0.0f) || (min_area == 0) || (confirm_hits == 0))          /* check param */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    tracker->gate = gate;                                                  /* set the gate */
+    tracker->min_area = min_area;                                          /* set the min area */
+    tracker->confirm_hits = confirm_hits;                                  /* set the confirm hits */
+    tracker->max_misses = max_misses;                                      /* set the max misses */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the counting line
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] row0 is the first point row
+ * @param[in] col0 is the first point col
+ * @param[in] row1 is the second point row
+ * @param[in] col1 is the second point col
+ * @param[in] margin is the dead band in pixels
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ *            - 5 line is invalid
+ * @note      the positive side is on the left of the direction from the first to the second point,
+ *            a confirmed track counts once each time it moves from one side beyond the dead band to the other
+ */
+uint8_t amg8833_tracker_set_line(amg8833_tracker_t *tracker, float row0, float col0, float row1, float col1, float margin)
+{
+    float dr;
+    float dc;
+    float len2;
+    uint8_t i;
+    
+    if (tracker == NULL)                                                                      /* check tracker */
+    {
+        return 2;                                                                             /* return error */
+    }
+    dr = row1 - row0;                                                                         /* row direction */
+    dc = col1 - col0;                                                                         /* col direction */
+    len2 = dr * dr + dc * dc;                                                                 /* squared line length */
+    if ((len2 < 1e-6f) || (margin < 0.0f))                                                    /* check the line */
+    {
+        return 5;                                                                             /* return error */
+    }
+    
+    tracker->line_a = dc;                                                                     /* normal row */
+    tracker->line_b = -dr;                                                                    /* normal col */
+    tracker->line_c = -(dc * row0 - dr * col0);                                               /* offset */
+    tracker->margin = margin * margin * len2;                                                 /* scaled squared margin */
+    tracker->line_enable = 1;                                                                 /* enable */
+    for (i = 0; i < AMG8833_TRACKER_MAX_TRACKS; i++)                                          /* all tracks */
+    {
+        tracker->track[i].side = a_tracker_side(tracker, tracker->track[i].row,
+                                                tracker->track[i].col, 0);                    /* restart the side */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     track a frame
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @param[in] mask is the foreground mask of the frame
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker or raw is NULL
+ * @note      the mask comes from amg8833_background_update or amg8833_blob_mask_from_raw,
+ *            blobs are associated by gated global nearest neighbour with a constant velocity prediction
+ */
+uint8_t amg8833_tracker_update(amg8833_tracker_t *tracker, int16_t raw[8][8], uint64_t mask)
+{
+    amg8833_blob_t blob[AMG8833_BLOB_MAX];
+    amg8833_blob_t det[AMG8833_TRACKER_MAX_DETECTIONS];
+    tracker_pair_t pair[AMG8833_TRACKER_MAX_TRACKS * AMG8833_TRACKER_MAX_DETECTIONS];
+    tracker_pair_t p;
+    amg8833_track_t *t;
+    uint8_t det_used[AMG8833_TRACKER_MAX_DETECTIONS];
+    uint8_t track_used[AMG8833_TRACKER_MAX_TRACKS];
+    float pr;
+    float pc;
+    float dr;
+    float dc;
+    float gate2;
+    uint8_t blob_count;
+    uint8_t det_count;
+    uint16_t pair_count;
+    uint16_t k;
+    int8_t side;
+    uint8_t i;
+    uint8_t j;
+    
+    if ((tracker == NULL) || (raw == NULL))                                                          /* check param */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    (void)amg8833_blob_label(mask, AMG8833_BLOB_CONNECTIVITY_8, raw,                                 /* label the blobs */
+                             blob, AMG8833_BLOB_MAX, &blob_count);                                   /* 64 pixels hold at most 32 blobs */
+    det_count = 0;                                                                                   /* init 0 */
+    for (i = 0; i < blob_count; i++)                                                                 /* check all blobs */
+    {
+        if (blob[i].area < tracker->min_area)                                                        /* too small */
+        {
+            continue;                                                                                /* skip */
+        }
+        if (det_count < AMG8833_TRACKER_MAX_DETECTIONS)                                              /* free slot */
+        {
+            det[det_count] = blob[i];                                                                /* append */
+            det_count++;                                                                             /* count */
+        }
+        else
+        {
+            for (j = 0, k = 0; j < AMG8833_TRACKER_MAX_DETECTIONS; j++)                              /* find the smallest */
+            {
+                if (det[j].area < det[k].area)                                                       /* smaller */
+                {
+                    k = j;                                                                           /* save */
+                }
+            }
+            if (blob[i].area > det[k].area)                                                          /* larger */
+            {
+                det[k] = blob[i];                                                                    /* replace */
+            }
+        }
+    }
+    
+    gate2 = tracker->gate * tracker->gate;                                                           /* get the square gate */
+    pair_count = 0;                                                                                  /* init 0 */
+    for (i = 0; i < AMG8833_TRACKER_MAX_TRACKS; i++)                                                 /* loop all tracks */
+    {
+        t = &tracker->track[i];                                                                      /* get the track */
+        track_used[i] = 0;                                                                           /* clear the flag */
+        if (t->id == 0)                                                                              /* free slot */
+        {
+            continue;                                                                                /* skip */
+        }
+        pr = t->row + t->vrow;                                                                       /* predict the row */
+        pc = t->col + t->vcol;                                                                       /* predict the col */
+        for (j = 0; j < det_count; j++)                                                              /* loop all detections */
+        {
+            dr = det[j].row - pr;                                                                    /* row offset */
+            dc = det[j].col - pc;                                                                    /* col offset */
+            p.d2 = dr * dr + dc * dc;                                                                /* square distance */
+            if (p.d2 > gate2)                                                                        /* out of the gate */
+            {
+                continue;                                                                            /* skip */
+            }
+            p.track = i;                                                                             /* save the track */
+            p.det = j;                                                                               /* save the detection */
+            k = pair_count;                                                                          /* start at the end */
+            while ((k > 0) && (pair[k - 1].d2 > p.d2))                                               /* insertion sort */
+            {
+                pair[k] = pair[k - 1];                                                               /* shift */
+                k--;                                                                                 /* move up */
+            }
+            pair[k] = p;                                                                             /* insert */
+            pair_count++;                                                                            /* count */
+        }
+    }
+    
+    memset(det_used, 0, sizeof(det_used));                                                           /* clear the detections */
+    for (k = 0; k < pair_count; k++)                                                                 /* greedy nearest neighbour by distance */
+    {
+        if ((track_used[pair[k].track] != 0) || (det_used[pair[k].det] != 0))                        /* already assigned */
+        {
+            continue;                                                                                /* skip */
+        }
+        track_used[pair[k].track] = 1;                                                               /* mark the track */
+        det_used[pair[k].det] = 1;                                                                   /* mark the detection */
+        t = &tracker->track[pair[k].track];                                                          /* get the track */
+        pr = t->row + t->vrow;                                                                       /* predict the row */
+        pc = t->col + t->vcol;                                                                       /* predict the col */
+        dr = det[pair[k].det].row - pr;                                                              /* row innovation */
+        dc = det[pair[k].det].col - pc;                                                              /* col innovation */
+        t->row = pr + TRACKER_ALPHA * dr;                                                            /* alpha beta update */
+        t->col = pc + TRACKER_ALPHA * dc;                                                            /* update the col */
+        t->vrow += TRACKER_BETA * dr;                                                                /* update the row velocity */
+        t->vcol += TRACKER_BETA * dc;                                                                /* update the col velocity */
+        t->area = det[pair[k].det].area;                                                             /* save the area */
+        t->peak = det[pair[k].det].peak;                                                             /* save the peak */
+        t->misses = 0;                                                                               /* clear the misses */
+        if (t->hits < 0xFF)                                                                          /* check the hits */
+        {
+            t->hits++;                                                                               /* hits++ */
+        }
+        if (t->hits >= tracker->confirm_hits)                                                        /* enough hits */
+        {
+            t->confirmed = 1;                                                                        /* confirm */
+        }
+    }
+    
+    for (i = 0; i < AMG8833_TRACKER_MAX_TRACKS; i++)                                                 /* coast or drop the missed tracks */
+    {
+        t = &tracker->track[i];                                                                      /* get the track */
+        if (t->id == 0)                                                                              /* free slot */
+        {
+            continue;                                                                                /* skip */
+        }
+        if (track_used[i] == 0)                                                                      /* missed */
+        {
+            t->misses++;                                                                             /* misses++ */
+            if (t->misses > tracker->max_misses)                                                     /* lost */
+            {
+                memset(t, 0, sizeof(amg8833_track_t));                                               /* free the slot */
+                
+                continue;                                                                            /* skip */
+            }
+            t->row += t->vrow;                                                                       /* coast */
+            t->col += t->vcol;                                                                       /* coast the col */
+        }
+        if ((tracker->line_enable != 0) && (t->confirmed != 0))                                      /* count the line crossings */
+        {
+            side = a_tracker_side(tracker, t->row, t->col, t->side);                                 /* get the side */
+            if ((t->side < 0) && (side > 0))                                                         /* negative to positive */
+            {
+                tracker->count_in++;                                                                 /* count in */
+            }
+            else if ((t->side > 0) && (side < 0))                                                    /* positive to negative */
+            {
+                tracker->count_out++;                                                                /* count out */
+            }
+            t->side = side;                                                                          /* save the side */
+        }
+    }
+    
+    for (j = 0; j < det_count; j++)                                                                  /* new tentative tracks from the unassigned detections */
+    {
+        if (det_used[j] != 0)                                                                        /* assigned */
+        {
+            continue;                                                                                /* skip */
+        }
+        for (i = 0; i < AMG8833_TRACKER_MAX_TRACKS; i++)                                             /* find a free slot */
+        {
+            if (tracker->track[i].id == 0)                                                           /* free */
+            {
+                break;
+            }
+        }
+        if (i == AMG8833_TRACKER_MAX_TRACKS)                                                         /* no free slot */
+        {
+            break;
+        }
+        t = &tracker->track[i];                                                                      /* get the track */
+        t->id = tracker->next_id;                                                                    /* set the id */
+        tracker->next_id = (uint16_t)((tracker->next_id == 0xFFFF) ? 1 : (tracker->next_id + 1));    /* next id, skip 0 */
+        t->hits = 1;                                                                                 /* first hit */
+        t->misses = 0;                                                                               /* no misses */
+        t->confirmed = (uint8_t)(tracker->confirm_hits <= 1);                                        /* confirm at once if required */
+        t->row = det[j].row;                                                                         /* set the row */
+        t->col = det[j].col;                                                                         /* set the col */
+        t->vrow = 0.0f;                                                                              /* no row velocity */
+        t->vcol = 0.0f;                                                                              /* no col velocity */
+        t->area = det[j].area;                                                                       /* save the area */
+        t->peak = det[j].peak;                                                                       /* save the peak */
+        t->side = (tracker->line_enable != 0) ? a_tracker_side(tracker, t->row, t->col, 0) : 0;      /* initial side */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the active tracks
+ * @param[in]  *tracker points to a tracker structure
+ * @param[out] *track points to a track array
+ * @param[in]  max is the track array size
+ * @param[out] *count points to a track count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tracker, track or count is NULL
+ * @note       only confirmed tracks are returned
+ */
+uint8_t amg8833_tracker_get_tracks(amg8833_tracker_t *tracker, amg8833_track_t *track, uint8_t max, uint8_t *count)
+{
+    uint8_t n;
+    uint8_t i;
+    
+    if ((tracker == NULL) || (track == NULL) || (count == NULL))                                 /* check param */
+    {
+        return 2;                                                                                /* return error */
+    }
+    
+    n = 0;                                                                                       /* init 0 */
+    for (i = 0; (i < AMG8833_TRACKER_MAX_TRACKS) && (n < max); i++)                              /* all slots */
+    {
+        if ((tracker->track[i].id != 0) && (tracker->track[i].confirmed != 0))                   /* confirmed */
+        {
+            track[n] = tracker->track[i];                                                        /* copy */
+            n++;                                                                                 /* count */
+        }
+    }
+    *count = n;                                                                                  /* set the count */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the line crossing counters
+ * @param[in]  *tracker points to a tracker structure
+ * @param[out] *count_in points to a positive crossing counter buffer
+ * @param[out] *count_out points to a negative crossing counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tracker is NULL
+ * @note       none
+ */
+uint8_t amg8833_tracker_get_count(amg8833_tracker_t *tracker, uint32_t *count_in, uint32_t *count_out)
+{
+    if ((tracker == NULL) || (count_in == NULL) || (count_out == NULL))        /* check param */
+    {
+        return 2;                                                              /* return error */
+    }
+    
+    *count_in = tracker->count_in;                                             /* get the in counter */
+    *count_out = tracker->count_out;                                           /* get the out counter */
+    
+    return 0;                                                                  /* success return 0 */
+}
@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_tracker.h
+ * @brief     driver amg8833 tracker header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_TRACKER_H
+#define DRIVER_AMG8833_TRACKER_H
+
+#include "driver_amg8833_blob.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_tracker_driver amg8833 tracker driver function
+ * @brief    amg8833 tracker driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 tracker definition
+ * @note  the work per frame is bounded by these sizes, positions are in pixels of amg8833_read_temperature_array
+ */
+#define AMG8833_TRACKER_MAX_TRACKS            8        /**< max tracks */
+#define AMG8833_TRACKER_MAX_DETECTIONS        8        /**< max detections per frame, the largest blobs are kept */
+
+/**
+ * @brief amg8833 track structure definition
+ */
+typedef struct amg8833_track_s
+{
+    uint16_t id;                 /**< track id, 0 means the slot is free */
+    uint8_t hits;                /**< matched frame count */
+    uint8_t misses;              /**< consecutive missed frame count */
+    uint8_t confirmed;           /**< confirmed flag */
+    int8_t side;                 /**< side of the counting line, 0 means unknown */
+    uint8_t area;                /**< last blob area */
+    int16_t peak;                /**< last blob peak raw data */
+    float row;                   /**< centroid row */
+    float col;                   /**< centroid col */
+    float vrow;                  /**< row velocity in pixels per frame */
+    float vcol;                  /**< col velocity in pixels per frame */
+} amg8833_track_t;
+
+/**
+ * @brief amg8833 tracker structure definition
+ */
+typedef struct amg8833_tracker_s
+{
+    amg8833_track_t track[AMG8833_TRACKER_MAX_TRACKS];        /**< track slots */
+    uint16_t next_id;                                         /**< next track id */
+    float gate;                                               /**< gate distance in pixels */
+    uint8_t min_area;                                         /**< min detection area */
+    uint8_t confirm_hits;                                     /**< hits to confirm a track */
+    uint8_t max_misses;                                       /**< misses to drop a track */
+    uint8_t line_enable;                                      /**< counting line enable flag */
+    float line_a;                                             /**< line row factor */
+    float line_b;                                             /**< line col factor */
+    float line_c;                                             /**< line offset */
+    float margin;                                             /**< squared dead band scaled by the squared line length */
+    uint32_t count_in;                                        /**< crossings to the positive side */
+    uint32_t count_out;                                       /**< crossings to the negative side */
+} amg8833_tracker_t;
+
+/**
+ * @brief     initialize the tracker
+ * @param[in] *tracker points to a tracker structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ * @note      gate is 2 pixels, min area is 1, 2 hits confirm a track, 3 misses drop it and no line is set
+ */
+uint8_t amg8833_tracker_init(amg8833_tracker_t *tracker);
+
+/**
+ * @brief     set the association params
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] gate is the gate distance in pixels
+ * @param[in] min_area is the min detection area
+ * @param[in] confirm_hits is the hits to confirm a track
+ * @param[in] max_misses is the misses to drop a track
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t amg8833_tracker_set_param(amg8833_tracker_t *tracker, float gate, uint8_t min_area,
+                                  uint8_t confirm_hits, uint8_t max_misses);
+
+/**
+ * @brief     set the counting line
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] row0 is the first point row
+ * @param[in] col0 is the first point col
+ * @param[in] row1 is the second point row
+ * @param[in] col1 is the second point col
+ * @param[in] margin is the dead band in pixels
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker is NULL
+ *            - 5 line is invalid
+ * @note      the positive side is on the left of the direction from the first to the second point,
+ *            a confirmed track counts once each time it moves from one side beyond the dead band to the other
+ */
+uint8_t amg8833_tracker_set_line(amg8833_tracker_t *tracker, float row0, float col0, float row1, float col1, float margin);
+
+/**
+ * @brief     track a frame
+ * @param[in] *tracker points to a tracker structure
+ * @param[in] raw is the raw array from amg8833_read_temperature_array
+ * @param[in] mask is the foreground mask of the frame
+ * @return    status code
+ *            - 0 success
+ *            - 2 tracker or raw is NULL
+ * @note      the mask comes from amg8833_background_update or amg8833_blob_mask_from_raw,
+ *            blobs are associated by gated global nearest neighbour with a constant velocity prediction
+ */
+uint8_t amg8833_tracker_update(amg8833_tracker_t *tracker, int16_t raw[8][8], uint64_t mask);
+
+/**
+ * @brief      get the active tracks
+ * @param[in]  *tracker points to a tracker structure
+ * @param[out] *track points to a track array
+ * @param[in]  max is the track array size
+ * @param[out] *count points to a track count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tracker, track or count is NULL
+ * @note       only confirmed tracks are returned
+ */
+uint8_t amg8833_tracker_get_tracks(amg8833_tracker_t *tracker, amg8833_track_t *track, uint8_t max, uint8_t *count);
+
+/**
+ * @brief      get the line crossing counters
+ * @param[in]  *tracker points to a tracker structure
+ * @param[out] *count_in points to a positive crossing counter buffer
+ * @param[out] *count_out points to a negative crossing counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 tracker is NULL
+ * @note       none
+ */
+uint8_t amg8833_tracker_get_count(amg8833_tracker_t *tracker, uint32_t *count_in, uint32_t *count_out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
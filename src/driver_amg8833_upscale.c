@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_upscale.c
+ * @brief     driver amg8833 upscale source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_upscale.h"
+
+/**
+ * @brief upscale tap structure definition
+ */
+typedef struct upscale_tap_s
+{
+    uint8_t index[4];         /**< source pixel index */
+    float weight[4];          /**< float weight */
+    int16_t fixed[4];         /**< q10 weight */
+} upscale_tap_t;
+
+/**
+ * @brief upscale weight definition
+ * @note  output j of an upscale by f samples the source at (j + 0.5) / f - 0.5, so the weights only depend
+ *        on j % f and every table entry is a constant expression evaluated by the compiler
+ */
+#define UPSCALE_LEFT(f, j)        ((2 * ((j) % (f)) + 1) < (f))                                      /**< sample left of the source pixel */
+#define UPSCALE_BASE(f, j)        ((int)((j) / (f)) - (UPSCALE_LEFT(f, j) ? 1 : 0))                  /**< first source pixel */
+#define UPSCALE_U(f, j)           ((float)(2 * ((j) % (f)) + 1 + (UPSCALE_LEFT(f, j) ? (f) : -(f))) / \
+                                   (float)(2 * (f)))                                                 /**< fraction to the next source pixel */
+#define UPSCALE_CLAMP(i)          ((uint8_t)(((i) < 0) ? 0 : (((i) > 7) ? 7 : (i))))                 /**< replicate the border */
+#define UPSCALE_Q10(w)            ((int16_t)((w) * 1024.0f + (((w) < 0.0f) ? -0.5f : 0.5f)))         /**< round to q10 */
+#define UPSCALE_CUBIC_0(u)        ((((-0.5f * (u)) + 1.0f) * (u) - 0.5f) * (u))                      /**< catmull-rom tap 0 */
+#define UPSCALE_CUBIC_2(u)        ((((-1.5f * (u)) + 2.0f) * (u) + 0.5f) * (u))                      /**< catmull-rom tap 2 */
+#define UPSCALE_CUBIC_3(u)        (((0.5f * (u)) - 0.5f) * (u) * (u))                                /**< catmull-rom tap 3 */
+#define UPSCALE_CUBIC_1(u)        (1.0f - UPSCALE_CUBIC_0(u) - UPSCALE_CUBIC_2(u) - UPSCALE_CUBIC_3(u))  /**< catmull-rom tap 1 */
+
+/**
+ * @brief upscale table entry definition
+ * @note  the q10 weight of the nearest tap is derived from the others so that every entry sums to 1024
+ */
+#define UPSCALE_BILINEAR(f, j)                                                                         \
+    {{UPSCALE_CLAMP(UPSCALE_BASE(f, j)), UPSCALE_CLAMP(UPSCALE_BASE(f, j) + 1), 0, 0},                 \
+     {1.0f - UPSCALE_U(f, j), UPSCALE_U(f, j), 0.0f, 0.0f},                                            \
+     {(int16_t)(1024 - UPSCALE_Q10(UPSCALE_U(f, j))), UPSCALE_Q10(UPSCALE_U(f, j)), 0, 0}}
+#define UPSCALE_BICUBIC(f, j)                                                                          \
+    {{UPSCALE_CLAMP(UPSCALE_BASE(f, j) - 1), UPSCALE_CLAMP(UPSCALE_BASE(f, j)),                        \
+      UPSCALE_CLAMP(UPSCALE_BASE(f, j) + 1), UPSCALE_CLAMP(UPSCALE_BASE(f, j) + 2)},                   \
+     {UPSCALE_CUBIC_0(UPSCALE_U(f, j)), UPSCALE_CUBIC_1(UPSCALE_U(f, j)),                              \
+      UPSCALE_CUBIC_2(UPSCALE_U(f, j)), UPSCALE_CUBIC_3(UPSCALE_U(f, j))},                             \
+     {UPSCALE_Q10(UPSCALE_CUBIC_0(UPSCALE_U(f, j))),                                                    \
+      (int16_t)(1024 - UPSCALE_Q10(UPSCALE_CUBIC_0(UPSCALE_U(f, j))) -                                   \
+                UPSCALE_Q10(UPSCALE_CUBIC_2(UPSCALE_U(f, j))) -                                         \
+                UPSCALE_Q10(UPSCALE_CUBIC_3(UPSCALE_U(f, j)))),                                         \
+      UPSCALE_Q10(UPSCALE_CUBIC_2(UPSCALE_U(f, j))), UPSCALE_Q10(UPSCALE_CUBIC_3(UPSCALE_U(f, j)))}}
+#define UPSCALE_ROW(m, f, j)      m(f, (j) + 0), m(f, (j) + 1), m(f, (j) + 2), m(f, (j) + 3), \
+                                  m(f, (j) + 4), m(f, (j) + 5), m(f, (j) + 6), m(f, (j) + 7)
+#define UPSCALE_TABLE_16(m)       UPSCALE_ROW(m, 2, 0), UPSCALE_ROW(m, 2, 8)
+#define UPSCALE_TABLE_32(m)       UPSCALE_ROW(m, 4, 0), UPSCALE_ROW(m, 4, 8), UPSCALE_ROW(m, 4, 16), UPSCALE_ROW(m, 4, 24)
+#define UPSCALE_TABLE_64(m)       UPSCALE_ROW(m, 8, 0), UPSCALE_ROW(m, 8, 8), UPSCALE_ROW(m, 8, 16), UPSCALE_ROW(m, 8, 24), \
+                                  UPSCALE_ROW(m, 8, 32), UPSCALE_ROW(m, 8, 40), UPSCALE_ROW(m, 8, 48), UPSCALE_ROW(m, 8, 56)
+
+/**
+ * @brief upscale table definition
+ */
+static const upscale_tap_t gs_bilinear_16[16] = {UPSCALE_TABLE_16(UPSCALE_BILINEAR)};        /**< bilinear 16x16 taps */
+static const upscale_tap_t gs_bilinear_32[32] = {UPSCALE_TABLE_32(UPSCALE_BILINEAR)};        /**< bilinear 32x32 taps */
+static const upscale_tap_t gs_bilinear_64[64] = {UPSCALE_TABLE_64(UPSCALE_BILINEAR)};        /**< bilinear 64x64 taps */
+static const upscale_tap_t gs_bicubic_16[16] = {UPSCALE_TABLE_16(UPSCALE_BICUBIC)};          /**< bicubic 16x16 taps */
+static const upscale_tap_t gs_bicubic_32[32] = {UPSCALE_TABLE_32(UPSCALE_BICUBIC)};          /**< bicubic 32x32 taps */
+static const upscale_tap_t gs_bicubic_64[64] = {UPSCALE_TABLE_64(UPSCALE_BICUBIC)};          /**< bicubic 64x64 taps */
+
+/**
+ * @brief      get the tap table
+ * @param[in]  method is the upscale method
+ * @param[in]  size is the output size
+ * @param[out] *taps points to a tap number buffer
+ * @return     pointer to the tap table or NULL if the param is invalid
+ * @note       none
+ */
+static const upscale_tap_t *a_upscale_get_table(amg8833_upscale_method_t method, amg8833_upscale_size_t size,
+                                                uint8_t *taps)
+{
+    if (method == AMG8833_UPSCALE_METHOD_BILINEAR)                         /* bilinear */
+    {
+        *taps = 2;                                                         /* 2 taps */
+        switch (size)
+        {
+            case AMG8833_UPSCALE_SIZE_16 :
+            {
+                return gs_bilinear_16;                                     /* 16x16 */
+            }
+            case AMG8833_UPSCALE_SIZE_32 :
+            {
+                return gs_bilinear_32;                                     /* 32x32 */
+            }
+            case AMG8833_UPSCALE_SIZE_64 :
+            {
+                return gs_bilinear_64;                                     /* 64x64 */
+            }
+            default :
+            {
+                return NULL;                                               /* invalid */
+            }
+        }
+    }
+    else if (method == AMG8833_UPSCALE_METHOD_BICUBIC)                     /* bicubic */
+    {
+        *taps = 4;                                                         /* 4 taps */
+        switch (size)
+        {
+            case AMG8833_UPSCALE_SIZE_16 :
+            {
+                return gs_bicubic_16;                                      /* 16x16 */
+            }
+            case AMG8833_UPSCALE_SIZE_32 :
+            {
+                return gs_bicubic_32;                                      /* 32x32 */
+            }
+            case AMG8833_UPSCALE_SIZE_64 :
+            {
+                return gs_bicubic_64;                                      /* 64x64 */
+            }
+            default :
+            {
+                return NULL;                                               /* invalid */
+            }
+        }
+    }
+    else
+    {
+        return NULL;                                                       /* invalid */
+    }
+}
+
+/**
+ * @brief      upscale a temperature array
+ * @param[in]  method is the upscale method
+ * @param[in]  size is the output size
+ * @param[in]  temp is the temperature array from amg8833_read_temperature_array
+ * @param[out] *out points to a size * size output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 temp or out is NULL
+ *             - 5 param is invalid
+ * @note       out[y * size + x] keeps the orientation of temp and pixel centers are aligned,
+ *             bicubic output may overshoot the input range near sharp edges
+ */
+uint8_t amg8833_upscale(amg8833_upscale_method_t method, amg8833_upscale_size_t size,
+                        float temp[8][8], float *out)
+{
+    const upscale_tap_t *tap;
+    const float *src;
+    float row[8][64];
+    float *dst;
+    float w;
+    uint8_t taps;
+    uint8_t n;
+    uint8_t r;
+    uint8_t x;
+    uint8_t y;
+    uint8_t k;
+    
+    if ((temp == NULL) || (out == NULL))                                   /* check param */
+    {
+        return 2;                                                          /* return error */
+    }
+    tap = a_upscale_get_table(method, size, &taps);                        /* get the table */
+    if (tap == NULL)                                                       /* check the table */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    n = (uint8_t)size;                                                     /* set the size */
+    for (r = 0; r < 8; r++)                                                /* horizontal pass */
+    {
+        for (x = 0; x < n; x++)                                            /* 8 rows of size taps */
+        {
+            w = 0.0f;                                                      /* init 0 */
+            for (k = 0; k < taps; k++)                                     /* run taps */
+            {
+                w += tap[x].weight[k] * temp[r][tap[x].index[k]];          /* sum */
+            }
+            row[r][x] = w;                                                 /* save the sample */
+        }
+    }
+    for (y = 0; y < n; y++)                                                /* vertical pass */
+    {
+        dst = &out[y * n];                                                 /* output row */
+        src = row[tap[y].index[0]];                                        /* first source row */
+        w = tap[y].weight[0];                                              /* first weight */
+        for (x = 0; x < n; x++)                                            /* contiguous row */
+        {
+            dst[x] = w * src[x];                                           /* init the row */
+        }
+        for (k = 1; k < taps; k++)                                         /* run other taps */
+        {
+            src = row[tap[y].index[k]];                                    /* source row */
+            w = tap[y].weight[k];                                          /* weight */
+            for (x = 0; x < n; x++)                                        /* contiguous row */
+            {
+                dst[x] += w * src[x];                                      /* accumulate */
+            }
+        }
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      upscale a raw array with the fixed point kernel
+ * @param[in]  method is the upscale method
+ * @param[in]  size is the output size
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *out points to a size * size output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw or out is NULL
+ *             - 5 param is invalid
+ * @note       the output has the same unit as raw (0.25C/LSB) and only integer math is used
+ */
+uint8_t amg8833_upscale_raw(amg8833_upscale_method_t method, amg8833_upscale_size_t size,
+                            int16_t raw[8][8], int16_t *out)
+{
+    const upscale_tap_t *tap;
+    const int32_t *src;
+    int32_t row[8][64];
+    int32_t acc[64];
+    int32_t w;
+    uint8_t taps;
+    uint8_t n;
+    uint8_t r;
+    uint8_t x;
+    uint8_t y;
+    uint8_t k;
+    
+    if ((raw == NULL) || (out == NULL))                                    /* check param */
+    {
+        return 2;                                                          /* return error */
+    }
+    tap = a_upscale_get_table(method, size, &taps);                        /* get the table */
+    if (tap == NULL)                                                       /* check the table */
+    {
+        return 5;                                                          /* return error */
+    }
+    
+    n = (uint8_t)size;                                                     /* set the size */
+    for (r = 0; r < 8; r++)                                                /* horizontal pass */
+    {
+        for (x = 0; x < n; x++)                                            /* 8 rows of size taps */
+        {
+            w = 0;                                                         /* init 0 */
+            for (k = 0; k < taps; k++)                                     /* run taps */
+            {
+                w += (int32_t)tap[x].fixed[k] * raw[r][tap[x].index[k]];   /* sum */
+            }
+            row[r][x] = (w + 2) >> 2;                                      /* save the sample in q8 */
+        }
+    }
+    for (y = 0; y < n; y++)                                                /* vertical pass in q18 */
+    {
+        src = row[tap[y].index[0]];                                        /* first source row */
+        w = tap[y].fixed[0];                                               /* first weight */
+        for (x = 0; x < n; x++)                                            /* contiguous row */
+        {
+            acc[x] = w * src[x] + (1 << 17);                               /* init the row with rounding */
+        }
+        for (k = 1; k < taps; k++)                                         /* run other taps */
+        {
+            src = row[tap[y].index[k]];                                    /* source row */
+            w = tap[y].fixed[k];                                           /* weight */
+            for (x = 0; x < n; x++)                                        /* contiguous row */
+            {
+                acc[x] += w * src[x];                                      /* accumulate */
+            }
+        }
+        for (x = 0; x < n; x++)                                            /* back to raw unit */
+        {
+            out[y * n + x] = (int16_t)(acc[x] >> 18);                      /* save the row */
+        }
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
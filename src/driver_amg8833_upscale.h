@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_upscale.h
+ * @brief     driver amg8833 upscale header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AMG8833_UPSCALE_H
+#define DRIVER_AMG8833_UPSCALE_H
+
+#include "driver_amg8833.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup amg8833_upscale_driver amg8833 upscale driver function
+ * @brief    amg8833 upscale driver modules
+ * @ingroup  amg8833_driver
+ * @{
+ */
+
+/**
+ * @brief amg8833 upscale size enumeration definition
+ */
+typedef enum
+{
+    AMG8833_UPSCALE_SIZE_16 = 16,        /**< 16x16 */
+    AMG8833_UPSCALE_SIZE_32 = 32,        /**< 32x32 */
+    AMG8833_UPSCALE_SIZE_64 = 64,        /**< 64x64 */
+} amg8833_upscale_size_t;
+
+/**
+ * @brief amg8833 upscale method enumeration definition
+ */
+typedef enum
+{
+    AMG8833_UPSCALE_METHOD_BILINEAR = 0x00,        /**< bilinear */
+    AMG8833_UPSCALE_METHOD_BICUBIC  = 0x01,        /**< bicubic, catmull-rom */
+} amg8833_upscale_method_t;
+
+/**
+ * @brief      upscale a temperature array
+ * @param[in]  method is the upscale method
+ * @param[in]  size is the output size
+ * @param[in]  temp is the temperature array from amg8833_read_temperature_array
+ * @param[out] *out points to a size * size output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 temp or out is NULL
+ *             - 5 param is invalid
+ * @note       out[y * size + x] keeps the orientation of temp and pixel centers are aligned,
+ *             bicubic output may overshoot the input range near sharp edges
+ */
+uint8_t amg8833_upscale(amg8833_upscale_method_t method, amg8833_upscale_size_t size,
+                        float temp[8][8], float *out);
+
+/**
+ * @brief      upscale a raw array with the fixed point kernel
+ * @param[in]  method is the upscale method
+ * @param[in]  size is the output size
+ * @param[in]  raw is the raw array from amg8833_read_temperature_array
+ * @param[out] *out points to a size * size output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 raw or out is NULL
+ *             - 5 param is invalid
+ * @note       the output has the same unit as raw (0.25C/LSB) and only integer math is used
+ */
+uint8_t amg8833_upscale_raw(amg8833_upscale_method_t method, amg8833_upscale_size_t size,
+                            int16_t raw[8][8], int16_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
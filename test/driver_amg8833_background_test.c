@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_background_test.c
+ * @brief     driver amg8833 background test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_background_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+static amg8833_background_t gs_background;        /**< background model */
+static int16_t gs_raw[8][8];                       /**< raw buffer */
+static float gs_temp[8][8];                        /**< temperature buffer */
+
+/**
+ * @brief     make a noisy frame with an object
+ * @param[in] object is the object mask
+ * @note      the background is 100 +- 4 raw data and the object is 60 raw data warmer
+ */
+static void a_background_test_frame(uint64_t object)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        gs_raw[i / 8][i % 8] = (int16_t)(100 + rand() % 9 - 4);
+        if (((object >> i) & 1) != 0)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] + 60);
+        }
+    }
+}
+
+/**
+ * @brief     background test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_background_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t t;
+    uint32_t k;
+    uint64_t object;
+    uint64_t mask;
+    
+    /* start background test */
+    amg8833_interface_debug_print("amg8833: start background test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_background_init(NULL, 4, 64, 8) != 2) || (amg8833_background_init(&gs_background, 0, 64, 8) != 5) ||
+        (amg8833_background_init(&gs_background, 16, 64, 8) != 5) || (amg8833_background_init(&gs_background, 4, 64, 2048) != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check init param error.\n");
+        
+        return 1;
+    }
+    res = amg8833_background_init(&gs_background, 4, 64, 8);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: background init failed.\n");
+        
+        return 1;
+    }
+    if ((amg8833_background_set_absorb(&gs_background, 16) != 5) ||
+        (amg8833_background_update(&gs_background, gs_raw, NULL) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* foreground test */
+    amg8833_interface_debug_print("amg8833: foreground test.\n");
+    object = 0;
+    for (t = 0; t < times; t++)
+    {
+        /* learn the background */
+        (void)amg8833_background_init(&gs_background, 4, 64, 8);
+        for (k = 0; k < 64; k++)
+        {
+            a_background_test_frame(0);
+            (void)amg8833_background_update(&gs_background, gs_raw, &mask);
+            if (mask != 0)
+            {
+                amg8833_interface_debug_print("amg8833: check background mask error.\n");
+                
+                return 1;
+            }
+        }
+        
+        /* the object is foreground and is never learned */
+        object = 0;
+        for (i = 0; i < 64; i++)
+        {
+            object |= (uint64_t)((rand() % 4) == 0) << i;
+        }
+        for (k = 0; k < 64; k++)
+        {
+            a_background_test_frame(object);
+            (void)amg8833_background_update(&gs_background, gs_raw, &mask);
+            if (mask != object)
+            {
+                amg8833_interface_debug_print("amg8833: check foreground mask error.\n");
+                
+                return 1;
+            }
+        }
+        (void)amg8833_background_get_mean(&gs_background, gs_temp);
+        for (i = 0; i < 64; i++)
+        {
+            if (fabsf(gs_temp[i / 8][i % 8] - 25.0f) > 1.0f)
+            {
+                amg8833_interface_debug_print("amg8833: check background mean error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check foreground ok.\n");
+    
+    /* absorb test */
+    amg8833_interface_debug_print("amg8833: absorb test.\n");
+    res = amg8833_background_set_absorb(&gs_background, 3);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set absorb failed.\n");
+        
+        return 1;
+    }
+    for (k = 0; k < 256; k++)
+    {
+        a_background_test_frame(object);
+        (void)amg8833_background_update(&gs_background, gs_raw, &mask);
+    }
+    if (mask != 0)
+    {
+        amg8833_interface_debug_print("amg8833: check absorb error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check absorb ok.\n");
+    
+    /* reset test */
+    amg8833_interface_debug_print("amg8833: reset test.\n");
+    (void)amg8833_background_reset(&gs_background);
+    a_background_test_frame(0);
+    (void)amg8833_background_update(&gs_background, gs_raw, &mask);
+    (void)amg8833_background_get_mean(&gs_background, gs_temp);
+    if ((mask != 0) || (gs_temp[4][2] != (float)gs_raw[4][2] * 0.25f))
+    {
+        amg8833_interface_debug_print("amg8833: check reset error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check reset ok.\n");
+    
+    /* finish background test */
+    amg8833_interface_debug_print("amg8833: finish background test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_badpixel_test.c
+ * @brief     driver amg8833 badpixel test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_badpixel_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief register address definition
+ */
+#define BADPIXEL_TEST_REG_T01L        0x80        /**< pixel 1 output value lower level register */
+
+static amg8833_handle_t gs_handle;        /**< amg8833 handle */
+static uint8_t gs_reg[256];               /**< fake register file */
+static int16_t gs_input[8][8];            /**< pixel register data */
+static int16_t gs_raw[8][8];              /**< raw buffer */
+static float gs_temp[8][8];               /**< temperature buffer */
+static int32_t gs_offset[8][8];           /**< identity offset table */
+static uint16_t gs_gain[8][8];            /**< identity gain table */
+
+/**
+ * @brief  fake iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_badpixel_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_badpixel_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      fake iic read from the register file
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_badpixel_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = gs_reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write to the register file
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_badpixel_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        gs_reg[(uint8_t)(reg + i)] = buf[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake delay
+ * @param[in] ms is the delay time in ms
+ * @note      none
+ */
+static void a_badpixel_test_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     fake receive callback
+ * @param[in] type is the interrupt type
+ * @note      none
+ */
+static void a_badpixel_test_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     write a frame to the pixel registers
+ * @param[in] raw is the raw array in amg8833_read_temperature_array order
+ * @note      pixel_01 is stored at raw[7][7] and pixel_64 is stored at raw[0][0]
+ */
+static void a_badpixel_test_set_pixels(int16_t raw[8][8])
+{
+    uint8_t p;
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        p = (uint8_t)(63 - i);
+        gs_reg[BADPIXEL_TEST_REG_T01L + p * 2 + 0] = (uint8_t)((uint16_t)raw[i / 8][i % 8] & 0xFF);
+        gs_reg[BADPIXEL_TEST_REG_T01L + p * 2 + 1] = (uint8_t)((uint16_t)raw[i / 8][i % 8] >> 8);
+    }
+}
+
+/**
+ * @brief      reference neighbour estimate of a bad pixel
+ * @param[in]  mask is the bad pixel mask
+ * @param[in]  k is the bad pixel index
+ * @param[out] *count points to a used neighbour count buffer
+ * @return     sum of the used neighbours
+ * @note       the good 4 neighbours are used, or the good diagonal neighbours when no 4 neighbour is good
+ */
+static int32_t a_badpixel_test_estimate(uint64_t mask, uint8_t k, uint8_t *count)
+{
+    const int8_t dr[8] = {-1, 1, 0, 0, -1, -1, 1, 1};
+    const int8_t dc[8] = {0, 0, -1, 1, -1, 1, -1, 1};
+    int32_t sum;
+    uint8_t n;
+    int8_t r;
+    int8_t c;
+    
+    sum = 0;
+    *count = 0;
+    for (n = 0; n < 8; n++)
+    {
+        if ((n == 4) && (*count != 0))
+        {
+            break;
+        }
+        r = (int8_t)(k / 8 + dr[n]);
+        c = (int8_t)(k % 8 + dc[n]);
+        if ((r < 0) || (r > 7) || (c < 0) || (c > 7) || (((mask >> (r * 8 + c)) & 1) != 0))
+        {
+            continue;
+        }
+        sum += gs_input[r][c];
+        (*count)++;
+    }
+    
+    return sum;
+}
+
+/**
+ * @brief     badpixel test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_badpixel_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t bits;
+    uint8_t n;
+    uint8_t i;
+    uint32_t t;
+    int32_t sum;
+    uint64_t mask;
+    uint64_t mask_check;
+    float expect;
+    float err;
+    const uint64_t fixed_mask[3] =
+    {
+        /* a cross, the center falls back to its diagonals */
+        ((uint64_t)1 << 27) | ((uint64_t)1 << 19) | ((uint64_t)1 << 35) | ((uint64_t)1 << 26) | ((uint64_t)1 << 28),
+        /* a corner block, the corner has no good neighbour and is kept */
+        ((uint64_t)1 << 0) | ((uint64_t)1 << 1) | ((uint64_t)1 << 8) | ((uint64_t)1 << 9),
+        /* a border pair */
+        ((uint64_t)1 << 7) | ((uint64_t)1 << 63),
+    };
+    
+    /* start badpixel test */
+    amg8833_interface_debug_print("amg8833: start badpixel test.\n");
+    
+    /* link the fake register file */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, a_badpixel_test_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, a_badpixel_test_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, a_badpixel_test_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, a_badpixel_test_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_badpixel_test_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_badpixel_test_receive_callback);
+    res = amg8833_init(&gs_handle);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_set_bad_pixel_mask(NULL, 1) != 2) ||
+        (amg8833_set_bad_pixel_mask(&gs_handle, fixed_mask[0]) != 0) ||
+        (amg8833_set_bad_pixel_mask(&gs_handle, 0x1FF) != 5) ||
+        (amg8833_get_bad_pixel_mask(&gs_handle, &mask_check) != 0) || (mask_check != fixed_mask[0]))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* substitution test */
+    amg8833_interface_debug_print("amg8833: substitution test.\n");
+    for (i = 0; i < 64; i++)
+    {
+        gs_offset[i / 8][i % 8] = 0;
+        gs_gain[i / 8][i % 8] = 16384;
+    }
+    res = amg8833_nuc_set_table(&gs_handle, gs_offset, gs_gain);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: nuc set table failed.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (t = 0; t < times + 3; t++)
+    {
+        /* fixed masks first, then random masks of up to AMG8833_BAD_PIXEL_MAX pixels */
+        if (t < 3)
+        {
+            mask = fixed_mask[t];
+        }
+        else
+        {
+            mask = 0;
+            bits = (uint8_t)(rand() % (AMG8833_BAD_PIXEL_MAX + 1));
+            for (n = 0; n < bits; n++)
+            {
+                mask |= (uint64_t)1 << (rand() % 64);
+            }
+        }
+        
+        /* both decode paths substitute */
+        res = amg8833_nuc_set_enable(&gs_handle, ((t % 2) == 0) ? AMG8833_BOOL_FALSE : AMG8833_BOOL_TRUE);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: nuc set enable failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if ((amg8833_set_bad_pixel_mask(&gs_handle, mask) != 0) ||
+            (amg8833_get_bad_pixel_mask(&gs_handle, &mask_check) != 0) || (mask_check != mask))
+        {
+            amg8833_interface_debug_print("amg8833: check mask error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            gs_input[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+        }
+        a_badpixel_test_set_pixels(gs_input);
+        res = amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            if (((mask >> i) & 1) == 0)
+            {
+                /* good pixels are untouched */
+                if ((gs_raw[i / 8][i % 8] != gs_input[i / 8][i % 8]) ||
+                    (gs_temp[i / 8][i % 8] != (float)gs_input[i / 8][i % 8] * 0.25f))
+                {
+                    amg8833_interface_debug_print("amg8833: check good pixel error.\n");
+                    
+                    (void)amg8833_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+                continue;
+            }
+            
+            /* bad pixels are the mean of their good neighbours */
+            sum = a_badpixel_test_estimate(mask, i, &count);
+            expect = (count != 0) ? ((float)sum / (float)count) : (float)gs_input[i / 8][i % 8];
+            err = (float)gs_raw[i / 8][i % 8] - expect;
+            if ((err > 0.5f) || (err < -0.5f))
+            {
+                amg8833_interface_debug_print("amg8833: check bad pixel %d raw error.\n", i);
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+            err = gs_temp[i / 8][i % 8] - expect * 0.25f;
+            if ((err > 0.001f) || (err < -0.001f))
+            {
+                amg8833_interface_debug_print("amg8833: check bad pixel %d temperature error.\n", i);
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check substitution ok.\n");
+    
+    /* finish badpixel test */
+    amg8833_interface_debug_print("amg8833: finish badpixel test.\n");
+    (void)amg8833_deinit(&gs_handle);
+    
+    return 0;
+}
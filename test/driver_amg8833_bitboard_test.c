@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_bitboard_test.c
+ * @brief     driver amg8833 bitboard test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_bitboard_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief     morphology with a per pixel neighbour scan
+ * @param[in] mask is the bitboard
+ * @param[in] connectivity is the pixel connectivity
+ * @param[in] erode is 0 for dilate and 1 for erode
+ * @return    result bitboard
+ * @note      pixels outside the frame are ignored by dilate and count as set for erode
+ */
+static uint64_t a_bitboard_test_morph(uint64_t mask, amg8833_bitboard_connectivity_t connectivity, uint8_t erode)
+{
+    uint64_t out;
+    uint8_t hit;
+    uint8_t i;
+    int8_t dr;
+    int8_t dc;
+    int8_t r;
+    int8_t c;
+    
+    out = 0;
+    for (i = 0; i < 64; i++)
+    {
+        hit = (uint8_t)((mask >> i) & 1);
+        for (dr = -1; dr <= 1; dr++)
+        {
+            for (dc = -1; dc <= 1; dc++)
+            {
+                if ((connectivity == AMG8833_BITBOARD_CONNECTIVITY_4) && (dr != 0) && (dc != 0))
+                {
+                    continue;
+                }
+                r = (int8_t)(i / 8 + dr);
+                c = (int8_t)(i % 8 + dc);
+                if ((r < 0) || (r > 7) || (c < 0) || (c > 7))
+                {
+                    continue;
+                }
+                if (erode != 0)
+                {
+                    hit &= (uint8_t)((mask >> (r * 8 + c)) & 1);
+                }
+                else
+                {
+                    hit |= (uint8_t)((mask >> (r * 8 + c)) & 1);
+                }
+            }
+        }
+        out |= (uint64_t)hit << i;
+    }
+    
+    return out;
+}
+
+/**
+ * @brief     bitboard test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_bitboard_test(uint32_t times)
+{
+    uint8_t count;
+    uint8_t i;
+    uint32_t t;
+    uint32_t density;
+    uint64_t mask;
+    uint64_t prev;
+    uint64_t rise;
+    uint64_t fall;
+    uint64_t check;
+    amg8833_bitboard_connectivity_t connectivity;
+    
+    /* start bitboard test */
+    amg8833_interface_debug_print("amg8833: start bitboard test.\n");
+    
+    /* random bitboard test */
+    amg8833_interface_debug_print("amg8833: random bitboard test.\n");
+    for (t = 0; t < times; t++)
+    {
+        density = (uint32_t)(rand() % 100);
+        mask = 0;
+        prev = 0;
+        count = 0;
+        for (i = 0; i < 64; i++)
+        {
+            if ((uint32_t)(rand() % 100) < density)
+            {
+                mask |= AMG8833_BITBOARD_BIT(i / 8, i % 8);
+                count++;
+            }
+            prev |= (uint64_t)(rand() % 2) << i;
+        }
+        connectivity = ((t % 2) == 0) ? AMG8833_BITBOARD_CONNECTIVITY_4 : AMG8833_BITBOARD_CONNECTIVITY_8;
+        
+        /* popcount */
+        if (amg8833_bitboard_popcount(mask) != count)
+        {
+            amg8833_interface_debug_print("amg8833: check popcount error.\n");
+            
+            return 1;
+        }
+        
+        /* morphology */
+        if (amg8833_bitboard_dilate(mask, connectivity) != a_bitboard_test_morph(mask, connectivity, 0))
+        {
+            amg8833_interface_debug_print("amg8833: check dilate error.\n");
+            
+            return 1;
+        }
+        check = a_bitboard_test_morph(mask, connectivity, 1);
+        if (amg8833_bitboard_erode(mask, connectivity) != check)
+        {
+            amg8833_interface_debug_print("amg8833: check erode error.\n");
+            
+            return 1;
+        }
+        if (amg8833_bitboard_edge(mask, connectivity) != (mask & ~check))
+        {
+            amg8833_interface_debug_print("amg8833: check edge error.\n");
+            
+            return 1;
+        }
+        
+        /* diff */
+        if ((amg8833_bitboard_diff(mask, prev, &rise, &fall) != (mask ^ prev)) ||
+            (rise != (mask & ~prev)) || (fall != (prev & ~mask)))
+        {
+            amg8833_interface_debug_print("amg8833: check diff error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check random bitboard ok.\n");
+    
+    /* border test */
+    amg8833_interface_debug_print("amg8833: border test.\n");
+    if ((amg8833_bitboard_dilate(AMG8833_BITBOARD_COL_7, AMG8833_BITBOARD_CONNECTIVITY_8) != 0xC0C0C0C0C0C0C0C0ULL) ||
+        (amg8833_bitboard_dilate(AMG8833_BITBOARD_COL_0, AMG8833_BITBOARD_CONNECTIVITY_4) != 0x0303030303030303ULL) ||
+        (amg8833_bitboard_dilate(AMG8833_BITBOARD_ROW_7, AMG8833_BITBOARD_CONNECTIVITY_8) != 0xFFFF000000000000ULL) ||
+        (amg8833_bitboard_erode(0xFFFFFFFFFFFFFFFFULL, AMG8833_BITBOARD_CONNECTIVITY_8) != 0xFFFFFFFFFFFFFFFFULL) ||
+        (amg8833_bitboard_popcount(0xFFFFFFFFFFFFFFFFULL) != 64))
+    {
+        amg8833_interface_debug_print("amg8833: check border error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check border ok.\n");
+    
+    /* finish bitboard test */
+    amg8833_interface_debug_print("amg8833: finish bitboard test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,298 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_blob_test.c
+ * @brief     driver amg8833 blob test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_blob_test.h"
+#include <stdlib.h>
+
+static amg8833_blob_t gs_blob[AMG8833_BLOB_MAX];        /**< blob buffer */
+static amg8833_blob_t gs_check[AMG8833_BLOB_MAX];       /**< reference blob buffer */
+static int16_t gs_raw[8][8];                            /**< raw buffer */
+
+/**
+ * @brief      label a mask with a breadth first search
+ * @param[in]  mask is the mask
+ * @param[in]  connectivity is the pixel connectivity
+ * @param[in]  raw is the raw array
+ * @param[out] *blob points to a blob array
+ * @return     blob count
+ * @note       blobs are found in the order of their lowest bit
+ */
+static uint8_t a_blob_test_bfs(uint64_t mask, amg8833_blob_connectivity_t connectivity, int16_t raw[8][8],
+                               amg8833_blob_t *blob)
+{
+    uint8_t queue[64];
+    uint8_t head;
+    uint8_t tail;
+    uint8_t n;
+    uint8_t i;
+    uint8_t p;
+    int8_t dr;
+    int8_t dc;
+    int8_t r;
+    int8_t c;
+    uint32_t sum_row;
+    uint32_t sum_col;
+    
+    n = 0;
+    for (i = 0; i < 64; i++)
+    {
+        if (((mask >> i) & 1) == 0)
+        {
+            continue;
+        }
+        
+        /* search from the lowest remaining bit */
+        memset(&blob[n], 0, sizeof(amg8833_blob_t));
+        mask &= ~(1ULL << i);
+        queue[0] = i;
+        head = 0;
+        tail = 1;
+        while (head < tail)
+        {
+            p = queue[head++];
+            blob[n].mask |= 1ULL << p;
+            for (dr = -1; dr <= 1; dr++)
+            {
+                for (dc = -1; dc <= 1; dc++)
+                {
+                    if ((dr == 0) && (dc == 0))
+                    {
+                        continue;
+                    }
+                    if ((connectivity == AMG8833_BLOB_CONNECTIVITY_4) && (dr != 0) && (dc != 0))
+                    {
+                        continue;
+                    }
+                    r = (int8_t)(p / 8 + dr);
+                    c = (int8_t)(p % 8 + dc);
+                    if ((r < 0) || (r > 7) || (c < 0) || (c > 7))
+                    {
+                        continue;
+                    }
+                    if (((mask >> (r * 8 + c)) & 1) != 0)
+                    {
+                        mask &= ~(1ULL << (r * 8 + c));
+                        queue[tail++] = (uint8_t)(r * 8 + c);
+                    }
+                }
+            }
+        }
+        
+        /* statistics in the pixel order */
+        sum_row = 0;
+        sum_col = 0;
+        blob[n].row_min = 7;
+        blob[n].col_min = 7;
+        blob[n].peak = raw[i / 8][i % 8];
+        blob[n].peak_row = i / 8;
+        blob[n].peak_col = i % 8;
+        for (p = 0; p < 64; p++)
+        {
+            if (((blob[n].mask >> p) & 1) == 0)
+            {
+                continue;
+            }
+            blob[n].area++;
+            sum_row += p / 8;
+            sum_col += p % 8;
+            blob[n].row_min = (p / 8 < blob[n].row_min) ? p / 8 : blob[n].row_min;
+            blob[n].row_max = (p / 8 > blob[n].row_max) ? p / 8 : blob[n].row_max;
+            blob[n].col_min = (p % 8 < blob[n].col_min) ? p % 8 : blob[n].col_min;
+            blob[n].col_max = (p % 8 > blob[n].col_max) ? p % 8 : blob[n].col_max;
+            if (raw[p / 8][p % 8] > blob[n].peak)
+            {
+                blob[n].peak = raw[p / 8][p % 8];
+                blob[n].peak_row = p / 8;
+                blob[n].peak_col = p % 8;
+            }
+        }
+        blob[n].row = (float)sum_row / (float)blob[n].area;
+        blob[n].col = (float)sum_col / (float)blob[n].area;
+        n++;
+    }
+    
+    return n;
+}
+
+/**
+ * @brief     blob test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_blob_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t count_check;
+    uint8_t table[8][1];
+    uint8_t i;
+    uint8_t j;
+    uint32_t t;
+    uint32_t density;
+    uint64_t mask;
+    uint64_t mask_check;
+    amg8833_blob_connectivity_t connectivity;
+    
+    /* start blob test */
+    amg8833_interface_debug_print("amg8833: start blob test.\n");
+    
+    /* mask test */
+    amg8833_interface_debug_print("amg8833: mask test.\n");
+    for (t = 0; t < times; t++)
+    {
+        mask_check = 0;
+        for (i = 0; i < 8; i++)
+        {
+            table[i][0] = (uint8_t)(rand() % 256);
+            for (j = 0; j < 8; j++)
+            {
+                gs_raw[i][j] = (int16_t)(rand() % 1024 - 512);
+                mask_check |= (uint64_t)((table[i][0] >> (7 - j)) & 1) << (i * 8 + j);
+            }
+        }
+        res = amg8833_blob_mask_from_table(table, &mask);
+        if ((res != 0) || (mask != mask_check))
+        {
+            amg8833_interface_debug_print("amg8833: check table mask error.\n");
+            
+            return 1;
+        }
+        mask_check = 0;
+        for (i = 0; i < 64; i++)
+        {
+            mask_check |= (uint64_t)(gs_raw[i / 8][i % 8] > 100) << i;
+        }
+        res = amg8833_blob_mask_from_raw(gs_raw, 100, &mask);
+        if ((res != 0) || (mask != mask_check))
+        {
+            amg8833_interface_debug_print("amg8833: check raw mask error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check mask ok.\n");
+    
+    /* label test */
+    amg8833_interface_debug_print("amg8833: label test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* random mask and raw data */
+        density = (uint32_t)(rand() % 100);
+        mask = 0;
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % 64);
+            mask |= (uint64_t)(((uint32_t)(rand() % 100)) < density) << i;
+        }
+        connectivity = ((t % 2) == 0) ? AMG8833_BLOB_CONNECTIVITY_4 : AMG8833_BLOB_CONNECTIVITY_8;
+        
+        /* compare with the breadth first search */
+        res = amg8833_blob_label(mask, connectivity, gs_raw, gs_blob, AMG8833_BLOB_MAX, &count);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: label failed.\n");
+            
+            return 1;
+        }
+        count_check = a_blob_test_bfs(mask, connectivity, gs_raw, gs_check);
+        if (count != count_check)
+        {
+            amg8833_interface_debug_print("amg8833: check blob count error.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < count; i++)
+        {
+            if ((gs_blob[i].mask != gs_check[i].mask) || (gs_blob[i].area != gs_check[i].area) ||
+                (gs_blob[i].row_min != gs_check[i].row_min) || (gs_blob[i].row_max != gs_check[i].row_max) ||
+                (gs_blob[i].col_min != gs_check[i].col_min) || (gs_blob[i].col_max != gs_check[i].col_max) ||
+                (gs_blob[i].row != gs_check[i].row) || (gs_blob[i].col != gs_check[i].col))
+            {
+                amg8833_interface_debug_print("amg8833: check blob %d error.\n", i);
+                
+                return 1;
+            }
+            if ((gs_blob[i].peak != gs_check[i].peak) || (gs_blob[i].peak_row != gs_check[i].peak_row) ||
+                (gs_blob[i].peak_col != gs_check[i].peak_col))
+            {
+                amg8833_interface_debug_print("amg8833: check blob %d peak error.\n", i);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check label ok.\n");
+    
+    /* limit test */
+    amg8833_interface_debug_print("amg8833: limit test.\n");
+    res = amg8833_blob_label(0xAA55AA55AA55AA55ULL, AMG8833_BLOB_CONNECTIVITY_4, NULL, gs_blob, AMG8833_BLOB_MAX, &count);
+    if ((res != 0) || (count != 32))
+    {
+        amg8833_interface_debug_print("amg8833: check full array error.\n");
+        
+        return 1;
+    }
+    res = amg8833_blob_label(0xAA55AA55AA55AA55ULL, AMG8833_BLOB_CONNECTIVITY_8, NULL, gs_blob, AMG8833_BLOB_MAX, &count);
+    if ((res != 0) || (count != 1))
+    {
+        amg8833_interface_debug_print("amg8833: check corner connectivity error.\n");
+        
+        return 1;
+    }
+    res = amg8833_blob_label(0xAA55AA55AA55AA55ULL, AMG8833_BLOB_CONNECTIVITY_4, NULL, gs_blob, 8, &count);
+    if ((res != 4) || (count != 8))
+    {
+        amg8833_interface_debug_print("amg8833: check small array error.\n");
+        
+        return 1;
+    }
+    res = amg8833_blob_label(0, (amg8833_blob_connectivity_t)6, NULL, gs_blob, AMG8833_BLOB_MAX, &count);
+    if (res != 5)
+    {
+        amg8833_interface_debug_print("amg8833: check connectivity error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check limit ok.\n");
+    
+    /* finish blob test */
+    amg8833_interface_debug_print("amg8833: finish blob test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_defect_test.c
+ * @brief     driver amg8833 defect test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_defect_test.h"
+#include <stdlib.h>
+
+#define DEFECT_TEST_WINDOW        16        /**< window size */
+#define DEFECT_TEST_DIVERGE       40        /**< divergence threshold */
+
+static amg8833_defect_t gs_defect;        /**< defect detector */
+static int16_t gs_raw[8][8];              /**< raw buffer */
+
+/**
+ * @brief     make a noisy gradient frame with defects
+ * @param[in] stuck is the stuck pixel index
+ * @param[in] saturated is the saturated pixel index
+ * @param[in] hot is the diverged pixel index
+ * @note      64 means no such defect
+ */
+static void a_defect_test_frame(uint8_t stuck, uint8_t saturated, uint8_t hot)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        gs_raw[i / 8][i % 8] = (int16_t)(100 + (i / 8) * 3 + (i % 8) * 3 + rand() % 5 - 2);
+    }
+    if (stuck < 64)
+    {
+        gs_raw[stuck / 8][stuck % 8] = (int16_t)(100 + (stuck / 8) * 3 + (stuck % 8) * 3);
+    }
+    if (saturated < 64)
+    {
+        gs_raw[saturated / 8][saturated % 8] = 2047;
+    }
+    if (hot < 64)
+    {
+        gs_raw[hot / 8][hot % 8] = (int16_t)(gs_raw[hot / 8][hot % 8] + 200);
+    }
+}
+
+/**
+ * @brief     defect test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_defect_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t stuck;
+    uint8_t saturated;
+    uint8_t hot;
+    uint32_t t;
+    uint32_t k;
+    uint64_t mask;
+    uint64_t mask_check;
+    
+    /* start defect test */
+    amg8833_interface_debug_print("amg8833: start defect test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_defect_init(NULL, DEFECT_TEST_WINDOW, DEFECT_TEST_DIVERGE) != 2) ||
+        (amg8833_defect_init(&gs_defect, 1, DEFECT_TEST_DIVERGE) != 5) ||
+        (amg8833_defect_init(&gs_defect, DEFECT_TEST_WINDOW, 0) != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* clean scene test */
+    amg8833_interface_debug_print("amg8833: clean scene test.\n");
+    (void)amg8833_defect_init(&gs_defect, DEFECT_TEST_WINDOW, DEFECT_TEST_DIVERGE);
+    for (k = 0; k < DEFECT_TEST_WINDOW * 2; k++)
+    {
+        a_defect_test_frame(64, 64, 64);
+        res = amg8833_defect_update(&gs_defect, gs_raw, &mask);
+        if ((res != (((k + 1) % DEFECT_TEST_WINDOW) == 0 ? 0 : 4)) || (mask != 0))
+        {
+            amg8833_interface_debug_print("amg8833: check clean scene error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check clean scene ok.\n");
+    
+    /* defect test */
+    amg8833_interface_debug_print("amg8833: defect test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* three different inner pixels */
+        stuck = (uint8_t)((rand() % 6 + 1) * 8 + rand() % 6 + 1);
+        do
+        {
+            saturated = (uint8_t)((rand() % 6 + 1) * 8 + rand() % 6 + 1);
+        } while (saturated == stuck);
+        do
+        {
+            hot = (uint8_t)((rand() % 6 + 1) * 8 + rand() % 6 + 1);
+        } while ((hot == stuck) || (hot == saturated));
+        mask_check = ((uint64_t)1 << stuck) | ((uint64_t)1 << saturated) | ((uint64_t)1 << hot);
+        
+        /* the mask is only updated at the end of the window */
+        (void)amg8833_defect_init(&gs_defect, DEFECT_TEST_WINDOW, DEFECT_TEST_DIVERGE);
+        for (k = 0; k < DEFECT_TEST_WINDOW; k++)
+        {
+            a_defect_test_frame(stuck, saturated, hot);
+            res = amg8833_defect_update(&gs_defect, gs_raw, &mask);
+            if ((k < DEFECT_TEST_WINDOW - 1) && ((res != 4) || (mask != 0)))
+            {
+                amg8833_interface_debug_print("amg8833: check open window error.\n");
+                
+                return 1;
+            }
+        }
+        if ((res != 0) || (mask != mask_check))
+        {
+            amg8833_interface_debug_print("amg8833: check defect mask error.\n");
+            
+            return 1;
+        }
+        
+        /* the mask is sticky */
+        for (k = 0; k < DEFECT_TEST_WINDOW; k++)
+        {
+            a_defect_test_frame(64, 64, 64);
+            res = amg8833_defect_update(&gs_defect, gs_raw, &mask);
+        }
+        if ((res != 0) || (mask != mask_check))
+        {
+            amg8833_interface_debug_print("amg8833: check sticky mask error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check defect ok.\n");
+    
+    /* finish defect test */
+    amg8833_interface_debug_print("amg8833: finish defect test.\n");
+    
+    return 0;
+}
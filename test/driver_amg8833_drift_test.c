@@ -0,0 +1,495 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_drift_test.c
+ * @brief     driver amg8833 drift test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_drift_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief register address definition
+ */
+#define DRIFT_TEST_REG_TTHL        0x0E        /**< thermistor output value lower level register */
+#define DRIFT_TEST_REG_T01L        0x80        /**< pixel 1 output value lower level register */
+
+static amg8833_handle_t gs_handle;               /**< amg8833 handle */
+static amg8833_drift_table_t gs_table;           /**< drift table */
+static uint8_t gs_reg[256];                      /**< fake register file */
+static int16_t gs_input[8][8];                   /**< pixel register data */
+static int16_t gs_raw[8][8];                     /**< raw buffer */
+static float gs_temp[8][8];                      /**< temperature buffer */
+static int32_t gs_mean[8][8];                    /**< mean array */
+static int32_t gs_base[8][8];                    /**< base array */
+static int16_t gs_thermistor[3];                 /**< point thermistors */
+static int16_t gs_offset[3][64];                 /**< point offsets */
+
+/**
+ * @brief  fake iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_drift_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_drift_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      fake iic read from the register file
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_drift_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = gs_reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write to the register file
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_drift_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        gs_reg[(uint8_t)(reg + i)] = buf[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake delay
+ * @param[in] ms is the delay time in ms
+ * @note      none
+ */
+static void a_drift_test_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     fake receive callback
+ * @param[in] type is the interrupt type
+ * @note      none
+ */
+static void a_drift_test_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     write a frame to the pixel registers
+ * @param[in] raw is the raw array in amg8833_read_temperature_array order
+ * @note      pixel_01 is stored at raw[7][7] and pixel_64 is stored at raw[0][0]
+ */
+static void a_drift_test_set_pixels(int16_t raw[8][8])
+{
+    uint8_t p;
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        p = (uint8_t)(63 - i);
+        gs_reg[DRIFT_TEST_REG_T01L + p * 2 + 0] = (uint8_t)((uint16_t)raw[i / 8][i % 8] & 0xFF);
+        gs_reg[DRIFT_TEST_REG_T01L + p * 2 + 1] = (uint8_t)((uint16_t)raw[i / 8][i % 8] >> 8);
+    }
+}
+
+/**
+ * @brief     write the thermistor register
+ * @param[in] data is the signed thermistor raw data
+ * @note      the register is 12 bit sign and magnitude
+ */
+static void a_drift_test_set_thermistor(int16_t data)
+{
+    uint16_t m;
+    
+    m = (uint16_t)((data < 0) ? -data : data);
+    gs_reg[DRIFT_TEST_REG_TTHL + 0] = (uint8_t)(m & 0xFF);
+    gs_reg[DRIFT_TEST_REG_TTHL + 1] = (uint8_t)(((m >> 8) & 0x07) | ((data < 0) ? 0x08 : 0x00));
+}
+
+/**
+ * @brief     read a frame and check the removed offsets
+ * @param[in] *offset points to the expected offsets in 1/256 raw data, NULL means no compensation
+ * @param[in] *tolerance points to the tolerances in 1/256 raw data, NULL means exact
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the temperature keeps the corrected value in 1/256 raw data
+ */
+static uint8_t a_drift_test_check(const float *offset, const float *tolerance)
+{
+    uint8_t i;
+    int32_t c;
+    float err;
+    
+    if (amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 64; i++)
+    {
+        c = (int32_t)(gs_temp[i / 8][i % 8] * 1024.0f);
+        if (gs_raw[i / 8][i % 8] != (int16_t)((c + 128) >> 8))
+        {
+            return 1;
+        }
+        err = (float)c - (float)gs_input[i / 8][i % 8] * 256.0f;
+        if (offset != NULL)
+        {
+            err += offset[i];
+        }
+        if (tolerance != NULL)
+        {
+            if ((err > tolerance[i]) || (err < -tolerance[i]))
+            {
+                return 1;
+            }
+        }
+        else if (err != 0.0f)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     drift test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_drift_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t n;
+    uint8_t m;
+    uint8_t i;
+    uint32_t t;
+    int16_t th;
+    int16_t raw;
+    float temp;
+    float d;
+    float offset[64];
+    float tolerance[64];
+    
+    /* start drift test */
+    amg8833_interface_debug_print("amg8833: start drift test.\n");
+    
+    /* link the fake register file */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, a_drift_test_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, a_drift_test_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, a_drift_test_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, a_drift_test_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_drift_test_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_drift_test_receive_callback);
+    res = amg8833_init(&gs_handle);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    (void)amg8833_drift_table_clear(&gs_table);
+    for (n = 0; n < AMG8833_DRIFT_MAX_POINTS; n++)
+    {
+        if (amg8833_drift_table_add(&gs_table, (int16_t)(n * 100), gs_mean, gs_base) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: drift table add failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    if ((amg8833_drift_table_add(&gs_table, 1000, gs_mean, gs_base) != 4) ||
+        (amg8833_drift_set_table(&gs_handle, &gs_table, 0) != 5) ||
+        (amg8833_drift_table_clear(&gs_table) != 0) ||
+        (amg8833_drift_table_add(&gs_table, 100, gs_mean, gs_base) != 0) ||
+        (amg8833_drift_table_add(&gs_table, 100, gs_mean, gs_base) != 5) ||
+        (amg8833_drift_set_table(&gs_handle, &gs_table, 1) != 0) ||
+        (amg8833_drift_set_table(&gs_handle, NULL, 1) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_table.thermistor[1] = gs_table.thermistor[0];
+    gs_table.points = 2;
+    if (amg8833_drift_set_table(&gs_handle, &gs_table, 1) != 5)
+    {
+        amg8833_interface_debug_print("amg8833: check table order error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* interpolation test */
+    amg8833_interface_debug_print("amg8833: interpolation test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* 3 distinct points added out of order */
+        (void)amg8833_drift_table_clear(&gs_table);
+        for (n = 0; n < 3; n++)
+        {
+            do
+            {
+                gs_thermistor[n] = (int16_t)(rand() % 1401 - 200);
+                for (m = 0; m < n; m++)
+                {
+                    if (gs_thermistor[m] == gs_thermistor[n])
+                    {
+                        break;
+                    }
+                }
+            } while (m != n);
+            for (i = 0; i < 64; i++)
+            {
+                gs_base[i / 8][i % 8] = rand() % 200001 - 100000;
+                gs_offset[n][i] = (int16_t)(rand() % 6001 - 3000);
+                gs_mean[i / 8][i % 8] = gs_base[i / 8][i % 8] + gs_offset[n][i];
+            }
+            if (amg8833_drift_table_add(&gs_table, gs_thermistor[n], gs_mean, gs_base) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: drift table add failed.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        for (n = 0; n < 3; n++)
+        {
+            for (m = 0; m < 3; m++)
+            {
+                if (gs_table.thermistor[n] == gs_thermistor[m])
+                {
+                    break;
+                }
+            }
+            if ((m == 3) || ((n != 0) && (gs_table.thermistor[n] <= gs_table.thermistor[n - 1])) ||
+                (memcmp(gs_table.offset[n], gs_offset[m], sizeof(gs_offset[0])) != 0))
+            {
+                amg8833_interface_debug_print("amg8833: check table points error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        res = amg8833_drift_set_table(&gs_handle, &gs_table, 1);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: drift set table failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            gs_input[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+        }
+        a_drift_test_set_pixels(gs_input);
+        
+        /* every table point removes its own offsets exactly */
+        for (n = 0; n < 3; n++)
+        {
+            a_drift_test_set_thermistor(gs_table.thermistor[n]);
+            for (i = 0; i < 64; i++)
+            {
+                offset[i] = (float)gs_table.offset[n][i];
+            }
+            if ((a_drift_test_check(offset, NULL) != 0) ||
+                (amg8833_drift_get_thermistor(&gs_handle, &raw, &temp) != 0) ||
+                (raw != gs_table.thermistor[n]) || (temp != (float)raw * 0.0625f))
+            {
+                amg8833_interface_debug_print("amg8833: check table point error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        
+        /* between the points the offsets are linear */
+        n = (uint8_t)(rand() % 2);
+        th = (int16_t)(gs_table.thermistor[n] + 1 + rand() % (gs_table.thermistor[n + 1] - gs_table.thermistor[n]));
+        th = (th == gs_table.thermistor[n + 1]) ? (int16_t)(th - 1) : th;
+        a_drift_test_set_thermistor(th);
+        for (i = 0; i < 64; i++)
+        {
+            d = (float)(gs_table.offset[n + 1][i] - gs_table.offset[n][i]);
+            offset[i] = (float)gs_table.offset[n][i] + d * (float)(th - gs_table.thermistor[n]) /
+                        (float)(gs_table.thermistor[n + 1] - gs_table.thermistor[n]);
+            tolerance[i] = ((d < 0.0f) ? -d : d) / 256.0f + 1.0f;
+        }
+        if (a_drift_test_check(offset, tolerance) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check interpolation error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* outside the table the end points are kept */
+        a_drift_test_set_thermistor((int16_t)(gs_table.thermistor[0] - 1 - rand() % 100));
+        for (i = 0; i < 64; i++)
+        {
+            offset[i] = (float)gs_table.offset[0][i];
+        }
+        if (a_drift_test_check(offset, NULL) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check low clamp error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        a_drift_test_set_thermistor((int16_t)(gs_table.thermistor[2] + 1 + rand() % 100));
+        for (i = 0; i < 64; i++)
+        {
+            offset[i] = (float)gs_table.offset[2][i];
+        }
+        if (a_drift_test_check(offset, NULL) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check high clamp error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check interpolation ok.\n");
+    
+    /* period test */
+    amg8833_interface_debug_print("amg8833: period test.\n");
+    a_drift_test_set_thermistor(gs_table.thermistor[0]);
+    res = amg8833_drift_set_table(&gs_handle, &gs_table, 4);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: drift set table failed.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (n = 0; n < 9; n++)
+    {
+        /* the thermistor is read again every 4 frames */
+        for (i = 0; i < 64; i++)
+        {
+            offset[i] = (float)gs_table.offset[(n < 4) ? 0 : ((n < 8) ? 1 : 2)][i];
+        }
+        if (a_drift_test_check(offset, NULL) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check period error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        a_drift_test_set_thermistor(gs_table.thermistor[(n < 4) ? 1 : 2]);
+    }
+    amg8833_interface_debug_print("amg8833: check period ok.\n");
+    
+    /* disable test */
+    amg8833_interface_debug_print("amg8833: disable test.\n");
+    if ((amg8833_drift_set_table(&gs_handle, NULL, 1) != 0) || (a_drift_test_check(NULL, NULL) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check disable error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check disable ok.\n");
+    
+    /* finish drift test */
+    amg8833_interface_debug_print("amg8833: finish drift test.\n");
+    (void)amg8833_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_filter_test.c
+ * @brief     driver amg8833 filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_filter_test.h"
+#include <stdlib.h>
+
+static amg8833_filter_t gs_filter;        /**< filter */
+static int16_t gs_raw[8][8];              /**< raw buffer */
+static int16_t gs_out[8][8];              /**< filtered raw buffer */
+static float gs_temp[8][8];               /**< filtered temperature buffer */
+
+/**
+ * @brief     fill the raw buffer
+ * @param[in] value is the pixel value
+ * @param[in] noise is the noise amplitude
+ * @note      none
+ */
+static void a_filter_test_fill(int16_t value, int16_t noise)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        gs_raw[i / 8][i % 8] = value;
+        if (noise != 0)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] + rand() % (2 * noise + 1) - noise);
+        }
+    }
+}
+
+/**
+ * @brief     filter test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_filter_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t type;
+    uint8_t i;
+    uint32_t t;
+    uint32_t k;
+    int32_t d;
+    int32_t in_power;
+    int32_t out_power;
+    int16_t value;
+    float x;
+    
+    /* start filter test */
+    amg8833_interface_debug_print("amg8833: start filter test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_filter_init(&gs_filter, (amg8833_filter_type_t)3) != 5) ||
+        (amg8833_filter_init(NULL, AMG8833_FILTER_TYPE_IIR) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check init param error.\n");
+        
+        return 1;
+    }
+    res = amg8833_filter_init(&gs_filter, AMG8833_FILTER_TYPE_IIR);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: filter init failed.\n");
+        
+        return 1;
+    }
+    if ((amg8833_filter_set_gain(&gs_filter, 0, 32) != 5) || (amg8833_filter_set_gain(&gs_filter, 64, 257) != 5) ||
+        (amg8833_filter_set_noise(&gs_filter, 1, 0) != 5) || (amg8833_filter_update(&gs_filter, NULL, gs_out, NULL) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* step test */
+    amg8833_interface_debug_print("amg8833: step test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* the first frame seeds the state */
+        value = (int16_t)(rand() % 400 - 80);
+        (void)amg8833_filter_init(&gs_filter, AMG8833_FILTER_TYPE_IIR);
+        a_filter_test_fill(value, 0);
+        res = amg8833_filter_update(&gs_filter, gs_raw, gs_out, gs_temp);
+        if ((res != 0) || (gs_out[3][5] != value) || (gs_temp[3][5] != (float)value * 0.25f))
+        {
+            amg8833_interface_debug_print("amg8833: check seed error.\n");
+            
+            return 1;
+        }
+        
+        /* iir follows x += alpha * (z - x) */
+        x = (float)value;
+        value = (int16_t)(value + rand() % 200 - 100);
+        a_filter_test_fill(value, 0);
+        for (k = 0; k < 32; k++)
+        {
+            (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+            x += 0.25f * ((float)value - x);
+            d = (int32_t)gs_out[2][6] - (int32_t)(x + ((x < 0.0f) ? -0.5f : 0.5f));
+            if ((d < -1) || (d > 1))
+            {
+                amg8833_interface_debug_print("amg8833: check iir step error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check step ok.\n");
+    
+    /* noise test */
+    amg8833_interface_debug_print("amg8833: noise test.\n");
+    for (type = 0; type < 3; type++)
+    {
+        for (t = 0; t < times; t++)
+        {
+            (void)amg8833_filter_init(&gs_filter, (amg8833_filter_type_t)type);
+            a_filter_test_fill(200, 0);
+            (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+            in_power = 0;
+            out_power = 0;
+            for (k = 0; k < 64; k++)
+            {
+                a_filter_test_fill(200, 16);
+                (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+                for (i = 0; i < 64; i++)
+                {
+                    in_power += (gs_raw[i / 8][i % 8] - 200) * (gs_raw[i / 8][i % 8] - 200);
+                    out_power += (gs_out[i / 8][i % 8] - 200) * (gs_out[i / 8][i % 8] - 200);
+                }
+            }
+            if (out_power * 2 > in_power)
+            {
+                amg8833_interface_debug_print("amg8833: check type %d noise error.\n", type);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check noise ok.\n");
+    
+    /* ramp test */
+    amg8833_interface_debug_print("amg8833: ramp test.\n");
+    (void)amg8833_filter_init(&gs_filter, AMG8833_FILTER_TYPE_ALPHA_BETA);
+    for (k = 0; k < 64; k++)
+    {
+        a_filter_test_fill((int16_t)(k * 4), 0);
+        (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+    }
+    d = gs_out[0][0] - 63 * 4;
+    if ((d < -1) || (d > 1))
+    {
+        amg8833_interface_debug_print("amg8833: check alpha beta ramp error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check ramp ok.\n");
+    
+    /* motion test */
+    amg8833_interface_debug_print("amg8833: motion test.\n");
+    for (type = 0; type < 3; type++)
+    {
+        (void)amg8833_filter_init(&gs_filter, (amg8833_filter_type_t)type);
+        (void)amg8833_filter_set_motion_threshold(&gs_filter, 10);
+        a_filter_test_fill(100, 0);
+        (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+        (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+        a_filter_test_fill(200, 0);
+        (void)amg8833_filter_update(&gs_filter, gs_raw, gs_out, NULL);
+        if (gs_out[7][7] != 200)
+        {
+            amg8833_interface_debug_print("amg8833: check type %d motion error.\n", type);
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check motion ok.\n");
+    
+    /* finish filter test */
+    amg8833_interface_debug_print("amg8833: finish filter test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,393 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_governor_test.c
+ * @brief     driver amg8833 governor test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_governor_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief register address definition
+ */
+#define GOVERNOR_TEST_REG_PCTL        0x00        /**< power control register */
+#define GOVERNOR_TEST_REG_FPSC        0x02        /**< frame rate register */
+
+static amg8833_handle_t gs_handle;            /**< amg8833 handle */
+static amg8833_governor_t gs_governor;        /**< governor */
+static uint8_t gs_reg[256];                   /**< fake register file */
+static uint32_t gs_write;                     /**< register write count */
+static uint8_t gs_fail;                       /**< fail the bus */
+static int16_t gs_raw[8][8];                  /**< raw buffer */
+
+/**
+ * @brief  fake iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_governor_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_governor_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      fake iic read from the register file
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_governor_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    if (gs_fail != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = gs_reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write to the register file
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_governor_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    if (gs_fail != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        gs_reg[(uint8_t)(reg + i)] = buf[i];
+    }
+    gs_write++;
+    
+    return 0;
+}
+
+/**
+ * @brief     fake delay
+ * @param[in] ms is the delay time in ms
+ * @note      none
+ */
+static void a_governor_test_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     fake receive callback
+ * @param[in] type is the interrupt type
+ * @note      none
+ */
+static void a_governor_test_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     check the chip registers of a level
+ * @param[in] level is the governor level
+ * @param[in] reserved is the reserved fpsc bits
+ * @return    1 if the registers match
+ * @note      none
+ */
+static uint8_t a_governor_test_check_reg(uint8_t level, uint8_t reserved)
+{
+    switch (level)
+    {
+        case AMG8833_GOVERNOR_LEVEL_ACTIVE :
+        {
+            return (uint8_t)((gs_reg[GOVERNOR_TEST_REG_PCTL] == AMG8833_MODE_NORMAL) &&
+                             (gs_reg[GOVERNOR_TEST_REG_FPSC] == (reserved | AMG8833_FRAME_RATE_10_FPS)));
+        }
+        case AMG8833_GOVERNOR_LEVEL_IDLE :
+        {
+            return (uint8_t)((gs_reg[GOVERNOR_TEST_REG_PCTL] == AMG8833_MODE_NORMAL) &&
+                             (gs_reg[GOVERNOR_TEST_REG_FPSC] == (reserved | AMG8833_FRAME_RATE_1_FPS)));
+        }
+        case AMG8833_GOVERNOR_LEVEL_STAND_BY_10S :
+        {
+            return (uint8_t)(gs_reg[GOVERNOR_TEST_REG_PCTL] == AMG8833_MODE_STAND_BY_10S);
+        }
+        default :
+        {
+            return (uint8_t)(gs_reg[GOVERNOR_TEST_REG_PCTL] == AMG8833_MODE_STAND_BY_60S);
+        }
+    }
+}
+
+/**
+ * @brief     governor test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_governor_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t reserved;
+    uint8_t deepest;
+    uint8_t level;
+    uint8_t next;
+    uint8_t seeded;
+    uint8_t pixels;
+    uint8_t changed;
+    uint8_t active;
+    uint8_t frame;
+    uint8_t i;
+    uint32_t t;
+    uint32_t k;
+    uint32_t latency;
+    uint32_t hold;
+    uint32_t quiet;
+    uint32_t period;
+    uint32_t write;
+    int16_t delta;
+    amg8833_bool_t interrupt;
+    amg8833_governor_level_t level_check;
+    const uint32_t latency_list[4] = {100, 1000, 10000, 60000};
+    const uint32_t hold_list[5] = {0, 300, 1000, 2500, 20000};
+    
+    /* start governor test */
+    amg8833_interface_debug_print("amg8833: start governor test.\n");
+    
+    /* link the fake register file */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, a_governor_test_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, a_governor_test_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, a_governor_test_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, a_governor_test_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_governor_test_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_governor_test_receive_callback);
+    gs_fail = 0;
+    res = amg8833_init(&gs_handle);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_governor_init(NULL, &gs_handle, 1000, 1000, 8, 2) != 2) ||
+        (amg8833_governor_init(&gs_governor, NULL, 1000, 1000, 8, 2) != 2) ||
+        (amg8833_governor_init(&gs_governor, &gs_handle, 99, 1000, 8, 2) != 5) ||
+        (amg8833_governor_init(&gs_governor, &gs_handle, 1000, 1000, 0, 2) != 5) ||
+        (amg8833_governor_init(&gs_governor, &gs_handle, 1000, 1000, 8, 0) != 5) ||
+        (amg8833_governor_init(&gs_governor, &gs_handle, 1000, 1000, 8, 65) != 5) ||
+        (amg8833_governor_init(&gs_governor, &gs_handle, 1000, 1000, 8, 2) != 0) ||
+        (amg8833_governor_update(&gs_governor, NULL, AMG8833_BOOL_FALSE, NULL) != 2) ||
+        (amg8833_governor_get_level(&gs_governor, NULL) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* level test */
+    amg8833_interface_debug_print("amg8833: level test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* the reserved fpsc bits survive the read-modify-write */
+        reserved = (uint8_t)(rand() % 256) & 0xFE;
+        gs_reg[GOVERNOR_TEST_REG_PCTL] = 0xFF;
+        gs_reg[GOVERNOR_TEST_REG_FPSC] = (uint8_t)(reserved | 0x01);
+        latency = (uint32_t)(rand() % 100001);
+        latency = (latency < 100) ? latency_list[rand() % 4] : latency;
+        hold = hold_list[rand() % 5];
+        delta = (int16_t)(rand() % 20 + 1);
+        pixels = (uint8_t)(rand() % 8 + 1);
+        res = amg8833_governor_init(&gs_governor, &gs_handle, latency, hold, delta, pixels);
+        if ((res != 0) || (a_governor_test_check_reg(AMG8833_GOVERNOR_LEVEL_ACTIVE, reserved) == 0))
+        {
+            amg8833_interface_debug_print("amg8833: check init level error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        deepest = 0;
+        for (i = 1; i < 4; i++)
+        {
+            deepest = (latency_list[i] <= latency) ? i : deepest;
+        }
+        
+        /* quiet frames, changed pixels and interrupts against the reference */
+        level = AMG8833_GOVERNOR_LEVEL_ACTIVE;
+        quiet = 0;
+        seeded = 0;
+        for (k = 0; k < 64; k++)
+        {
+            frame = (uint8_t)((rand() % 4) != 0);
+            changed = 0;
+            if (frame != 0)
+            {
+                for (i = 0; i < 64; i++)
+                {
+                    if ((rand() % 32) == 0)
+                    {
+                        gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] +
+                                                         (((rand() % 2) == 0) ? 1 : -1) * (delta + 1 + rand() % 20));
+                        changed++;
+                    }
+                    else
+                    {
+                        gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] + rand() % (2 * delta + 1) - delta);
+                    }
+                }
+            }
+            interrupt = ((rand() % 16) == 0) ? AMG8833_BOOL_TRUE : AMG8833_BOOL_FALSE;
+            active = (uint8_t)((interrupt == AMG8833_BOOL_TRUE) || ((frame != 0) && (seeded != 0) && (changed >= pixels)));
+            seeded = (uint8_t)(seeded | frame);
+            next = level;
+            if (active != 0)
+            {
+                next = AMG8833_GOVERNOR_LEVEL_ACTIVE;
+                quiet = 0;
+            }
+            else
+            {
+                quiet += latency_list[level];
+                if ((quiet >= hold) && (level < deepest))
+                {
+                    next = (uint8_t)(level + 1);
+                    quiet = 0;
+                }
+            }
+            write = gs_write;
+            res = amg8833_governor_update(&gs_governor, (frame != 0) ? gs_raw : NULL, interrupt, &period);
+            if ((res != 0) || (period != latency_list[next]))
+            {
+                amg8833_interface_debug_print("amg8833: check period error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if ((amg8833_governor_get_level(&gs_governor, &level_check) != 0) || (level_check != next) ||
+                (a_governor_test_check_reg(next, reserved) == 0))
+            {
+                amg8833_interface_debug_print("amg8833: check level error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+            
+            /* registers are only written on a level change */
+            if ((gs_write - write) != ((next == level) ? 0 : ((next < 2) ? 2 : 1)))
+            {
+                amg8833_interface_debug_print("amg8833: check register writes error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+            level = next;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check level ok.\n");
+    
+    /* bus failure test */
+    amg8833_interface_debug_print("amg8833: bus failure test.\n");
+    res = amg8833_governor_init(&gs_governor, &gs_handle, 1000, 0, 8, 2);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: governor init failed.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_fail = 1;
+    res = amg8833_governor_update(&gs_governor, NULL, AMG8833_BOOL_FALSE, &period);
+    gs_fail = 0;
+    if ((res != 1) || (amg8833_governor_get_level(&gs_governor, &level_check) != 0) ||
+        (level_check != AMG8833_GOVERNOR_LEVEL_ACTIVE))
+    {
+        amg8833_interface_debug_print("amg8833: check bus failure error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check bus failure ok.\n");
+    
+    /* finish governor test */
+    amg8833_interface_debug_print("amg8833: finish governor test.\n");
+    (void)amg8833_deinit(&gs_handle);
+    
+    return 0;
+}
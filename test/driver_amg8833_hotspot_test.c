@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_hotspot_test.c
+ * @brief     driver amg8833 hotspot test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_hotspot_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+static amg8833_hotspot_t gs_hotspot[64];        /**< hotspot buffer */
+static int16_t gs_raw[8][8];                    /**< raw buffer */
+
+/**
+ * @brief     find the local maxima with a per pixel scan
+ * @param[in] threshold is the raw data threshold
+ * @return    local maxima mask
+ * @note      neighbours before the pixel must be lower and neighbours after it must not be higher
+ */
+static uint64_t a_hotspot_test_mask(int16_t threshold)
+{
+    uint64_t mask;
+    uint8_t ok;
+    uint8_t i;
+    int8_t dr;
+    int8_t dc;
+    int8_t r;
+    int8_t c;
+    int16_t v;
+    int16_t n;
+    
+    mask = 0;
+    for (i = 0; i < 64; i++)
+    {
+        v = gs_raw[i / 8][i % 8];
+        ok = (uint8_t)(v > threshold);
+        for (dr = -1; dr <= 1; dr++)
+        {
+            for (dc = -1; dc <= 1; dc++)
+            {
+                r = (int8_t)(i / 8 + dr);
+                c = (int8_t)(i % 8 + dc);
+                if (((dr == 0) && (dc == 0)) || (r < 0) || (r > 7) || (c < 0) || (c > 7))
+                {
+                    continue;
+                }
+                n = gs_raw[r][c];
+                if ((r * 8 + c) < i)
+                {
+                    ok &= (uint8_t)(v > n);
+                }
+                else
+                {
+                    ok &= (uint8_t)(v >= n);
+                }
+            }
+        }
+        mask |= (uint64_t)ok << i;
+    }
+    
+    return mask;
+}
+
+/**
+ * @brief     hotspot test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_hotspot_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t total;
+    uint8_t k;
+    uint8_t i;
+    uint32_t t;
+    int16_t threshold;
+    uint64_t mask;
+    uint64_t mask_check;
+    float r0;
+    float c0;
+    float dr;
+    float dc;
+    
+    /* start hotspot test */
+    amg8833_interface_debug_print("amg8833: start hotspot test.\n");
+    
+    /* local maxima test */
+    amg8833_interface_debug_print("amg8833: local maxima test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* a small range makes many plateaus */
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % 6);
+        }
+        threshold = (int16_t)(rand() % 4 - 1);
+        res = amg8833_hotspot_find_mask(gs_raw, threshold, &mask);
+        mask_check = a_hotspot_test_mask(threshold);
+        if ((res != 0) || (mask != mask_check))
+        {
+            amg8833_interface_debug_print("amg8833: check local maxima error.\n");
+            
+            return 1;
+        }
+        
+        /* the top k are sorted from the hottest */
+        total = 0;
+        for (i = 0; i < 64; i++)
+        {
+            total = (uint8_t)(total + ((mask >> i) & 1));
+        }
+        k = (uint8_t)(rand() % 8 + 1);
+        res = amg8833_hotspot_find(gs_raw, threshold, gs_hotspot, k, &count);
+        if ((res != 0) || (count != ((total < k) ? total : k)))
+        {
+            amg8833_interface_debug_print("amg8833: check hotspot count error.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < count; i++)
+        {
+            if ((((mask >> (gs_hotspot[i].row * 8 + gs_hotspot[i].col)) & 1) == 0) ||
+                (gs_hotspot[i].raw != gs_raw[gs_hotspot[i].row][gs_hotspot[i].col]) ||
+                ((i > 0) && (gs_hotspot[i].raw > gs_hotspot[i - 1].raw)))
+            {
+                amg8833_interface_debug_print("amg8833: check hotspot order error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check local maxima ok.\n");
+    
+    /* sub pixel test */
+    amg8833_interface_debug_print("amg8833: sub pixel test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* a paraboloid inside the frame */
+        r0 = 1.5f + (float)(rand() % 400) / 100.0f;
+        c0 = 1.5f + (float)(rand() % 400) / 100.0f;
+        for (i = 0; i < 64; i++)
+        {
+            dr = (float)(i / 8) - r0;
+            dc = (float)(i % 8) - c0;
+            gs_raw[i / 8][i % 8] = (int16_t)(400.0f - 8.0f * (dr * dr + dc * dc) + 0.5f);
+        }
+        res = amg8833_hotspot_find(gs_raw, 0, gs_hotspot, 4, &count);
+        if ((res != 0) || (count != 1))
+        {
+            amg8833_interface_debug_print("amg8833: check paraboloid count error.\n");
+            
+            return 1;
+        }
+        if ((fabsf(gs_hotspot[0].sub_row - r0) > 0.1f) || (fabsf(gs_hotspot[0].sub_col - c0) > 0.1f) ||
+            (fabsf(gs_hotspot[0].peak - 100.0f) > 0.5f))
+        {
+            amg8833_interface_debug_print("amg8833: check sub pixel error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check sub pixel ok.\n");
+    
+    /* finish hotspot test */
+    amg8833_interface_debug_print("amg8833: finish hotspot test.\n");
+    
+    return 0;
+}
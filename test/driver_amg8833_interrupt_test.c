@@ -76,6 +76,7 @@ uint8_t amg8833_interrupt_test(amg8833_address_t addr_pin,
                                float hysteresis_level, uint32_t times)
 {
     uint32_t i;
+    uint32_t elapsed;
     uint8_t res;
     int16_t level;
     amg8833_info_t info;
@@ -89,6 +90,8 @@ uint8_t amg8833_interrupt_test(amg8833_address_t addr_pin,
     DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, amg8833_interface_delay_ms);
     DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
     DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, amg8833_interface_receive_callback);
+    DRIVER_AMG8833_LINK_LOCK(&gs_handle, amg8833_interface_lock);
+    DRIVER_AMG8833_LINK_UNLOCK(&gs_handle, amg8833_interface_unlock);
     
     /* get information */
     res = amg8833_info(&info);
@@ -253,8 +256,16 @@ uint8_t amg8833_interrupt_test(amg8833_address_t addr_pin,
         return 1;
     }
     
-    /* delay 1000 ms */
-    amg8833_interface_delay_ms(1000);
+    /* wait the first frames, 2 frames at 1 fps */
+    res = amg8833_wait_frame_ready(&gs_handle, 2, 100, 5000, &elapsed);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: wait frame ready failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: first frame after %d ms.\n", elapsed);
     
     for (i = 0; i < times; i++)
     {
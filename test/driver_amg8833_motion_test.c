@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_motion_test.c
+ * @brief     driver amg8833 motion test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_motion_test.h"
+#include <stdlib.h>
+
+static int16_t gs_prev[8][8];                                 /**< previous frame */
+static int16_t gs_cur[8][8];                                  /**< current frame */
+static amg8833_blob_t gs_blob[AMG8833_BLOB_MAX];              /**< blob buffer */
+static amg8833_motion_t gs_motion[AMG8833_BLOB_MAX];          /**< motion buffer */
+
+/**
+ * @brief direction of each shift sign, indexed by [row sign + 1][col sign + 1]
+ */
+static const amg8833_motion_direction_t gs_direction[3][3] =
+{
+    {AMG8833_MOTION_DIRECTION_UP_LEFT, AMG8833_MOTION_DIRECTION_UP, AMG8833_MOTION_DIRECTION_UP_RIGHT},
+    {AMG8833_MOTION_DIRECTION_LEFT, AMG8833_MOTION_DIRECTION_NONE, AMG8833_MOTION_DIRECTION_RIGHT},
+    {AMG8833_MOTION_DIRECTION_DOWN_LEFT, AMG8833_MOTION_DIRECTION_DOWN, AMG8833_MOTION_DIRECTION_DOWN_RIGHT},
+};
+
+/**
+ * @brief     motion test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_motion_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t i;
+    int8_t dr;
+    int8_t dc;
+    int8_t r;
+    int8_t c;
+    uint32_t t;
+    int32_t e;
+    uint64_t mask;
+    amg8833_motion_t motion;
+    
+    /* start motion test */
+    amg8833_interface_debug_print("amg8833: start motion test.\n");
+    
+    /* frame shift test */
+    amg8833_interface_debug_print("amg8833: frame shift test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* shift a random texture, new pixels enter at the border */
+        dr = (int8_t)(rand() % (2 * AMG8833_MOTION_RANGE + 1) - AMG8833_MOTION_RANGE);
+        dc = (int8_t)(rand() % (2 * AMG8833_MOTION_RANGE + 1) - AMG8833_MOTION_RANGE);
+        for (i = 0; i < 64; i++)
+        {
+            gs_prev[i / 8][i % 8] = (int16_t)(rand() % 1000);
+        }
+        for (i = 0; i < 64; i++)
+        {
+            r = (int8_t)(i / 8 - dr);
+            c = (int8_t)(i % 8 - dc);
+            if ((r < 0) || (r > 7) || (c < 0) || (c > 7))
+            {
+                gs_cur[i / 8][i % 8] = (int16_t)(rand() % 1000);
+            }
+            else
+            {
+                gs_cur[i / 8][i % 8] = gs_prev[r][c];
+            }
+        }
+        res = amg8833_motion_estimate(gs_prev, gs_cur, 0, &motion);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: estimate failed.\n");
+            
+            return 1;
+        }
+        e = (int32_t)motion.row - dr * 256;
+        if ((e < -128) || (e > 128))
+        {
+            amg8833_interface_debug_print("amg8833: check row shift error.\n");
+            
+            return 1;
+        }
+        e = (int32_t)motion.col - dc * 256;
+        if ((e < -128) || (e > 128))
+        {
+            amg8833_interface_debug_print("amg8833: check col shift error.\n");
+            
+            return 1;
+        }
+        if ((motion.direction != gs_direction[(dr > 0) - (dr < 0) + 1][(dc > 0) - (dc < 0) + 1]) ||
+            (motion.cost != 0) || (motion.contrast == 0))
+        {
+            amg8833_interface_debug_print("amg8833: check direction error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check frame shift ok.\n");
+    
+    /* blob motion test */
+    amg8833_interface_debug_print("amg8833: blob motion test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* a warm 3x3 object moves one pixel right */
+        memset(gs_prev, 0, sizeof(gs_prev));
+        memset(gs_cur, 0, sizeof(gs_cur));
+        r = (int8_t)(rand() % 4 + 1);
+        c = (int8_t)(rand() % 3 + 1);
+        for (i = 0; i < 9; i++)
+        {
+            gs_prev[r + i / 3][c + i % 3] = (int16_t)(200 + rand() % 100);
+            gs_cur[r + i / 3][c + 1 + i % 3] = gs_prev[r + i / 3][c + i % 3];
+        }
+        (void)amg8833_blob_mask_from_raw(gs_cur, 100, &mask);
+        (void)amg8833_blob_label(mask, AMG8833_BLOB_CONNECTIVITY_8, gs_cur, gs_blob, AMG8833_BLOB_MAX, &count);
+        res = amg8833_motion_estimate_blobs(gs_prev, gs_cur, gs_blob, count, gs_motion);
+        if ((res != 0) || (count != 1))
+        {
+            amg8833_interface_debug_print("amg8833: estimate blobs failed.\n");
+            
+            return 1;
+        }
+        if ((gs_motion[0].row < -128) || (gs_motion[0].row > 128) ||
+            (gs_motion[0].col < 128) || (gs_motion[0].col > 384) ||
+            (gs_motion[0].direction != AMG8833_MOTION_DIRECTION_RIGHT))
+        {
+            amg8833_interface_debug_print("amg8833: check blob motion error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check blob motion ok.\n");
+    
+    /* finish motion test */
+    amg8833_interface_debug_print("amg8833: finish motion test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_nuc_test.c
+ * @brief     driver amg8833 nuc test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_nuc_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief register address definition
+ */
+#define NUC_TEST_REG_T01L        0x80        /**< pixel 1 output value lower level register */
+
+static amg8833_handle_t gs_handle;        /**< amg8833 handle */
+static uint8_t gs_reg[256];               /**< fake register file */
+static int16_t gs_input[8][8];            /**< pixel register data */
+static int16_t gs_raw[8][8];              /**< raw buffer */
+static float gs_temp[8][8];               /**< temperature buffer */
+static int32_t gs_offset[8][8];           /**< offset table */
+static uint16_t gs_gain[8][8];            /**< gain table */
+static int32_t gs_offset_check[8][8];     /**< offset table check */
+static uint16_t gs_gain_check[8][8];      /**< gain table check */
+
+/**
+ * @brief  fake iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_nuc_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_nuc_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      fake iic read from the register file
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_nuc_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = gs_reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write to the register file
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_nuc_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    for (i = 0; i < len; i++)
+    {
+        gs_reg[(uint8_t)(reg + i)] = buf[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake delay
+ * @param[in] ms is the delay time in ms
+ * @note      none
+ */
+static void a_nuc_test_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     fake receive callback
+ * @param[in] type is the interrupt type
+ * @note      none
+ */
+static void a_nuc_test_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     write a frame to the pixel registers
+ * @param[in] raw is the raw array in amg8833_read_temperature_array order
+ * @note      pixel_01 is stored at raw[7][7] and pixel_64 is stored at raw[0][0]
+ */
+static void a_nuc_test_set_pixels(int16_t raw[8][8])
+{
+    uint8_t p;
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        p = (uint8_t)(63 - i);
+        gs_reg[NUC_TEST_REG_T01L + p * 2 + 0] = (uint8_t)((uint16_t)raw[i / 8][i % 8] & 0xFF);
+        gs_reg[NUC_TEST_REG_T01L + p * 2 + 1] = (uint8_t)((uint16_t)raw[i / 8][i % 8] >> 8);
+    }
+}
+
+/**
+ * @brief     nuc test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_nuc_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t t;
+    int32_t k;
+    float expect;
+    float err;
+    amg8833_bool_t enable;
+    
+    /* start nuc test */
+    amg8833_interface_debug_print("amg8833: start nuc test.\n");
+    
+    /* link the fake register file */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, a_nuc_test_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, a_nuc_test_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, a_nuc_test_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, a_nuc_test_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_nuc_test_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_nuc_test_receive_callback);
+    res = amg8833_init(&gs_handle);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_nuc_set_table(&gs_handle, NULL, gs_gain) != 2) ||
+        (amg8833_nuc_set_table(&gs_handle, gs_offset, NULL) != 2) ||
+        (amg8833_nuc_set_enable(NULL, AMG8833_BOOL_TRUE) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* identity test */
+    amg8833_interface_debug_print("amg8833: identity test.\n");
+    for (i = 0; i < 64; i++)
+    {
+        gs_offset[i / 8][i % 8] = 0;
+        gs_gain[i / 8][i % 8] = 16384;
+    }
+    if ((amg8833_nuc_set_table(&gs_handle, gs_offset, gs_gain) != 0) ||
+        (amg8833_nuc_set_enable(&gs_handle, AMG8833_BOOL_TRUE) != 0) ||
+        (amg8833_nuc_get_enable(&gs_handle, &enable) != 0) || (enable != AMG8833_BOOL_TRUE))
+    {
+        amg8833_interface_debug_print("amg8833: check nuc enable error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        /* gain 1.0 and no offset keep every pixel */
+        for (i = 0; i < 64; i++)
+        {
+            gs_input[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+        }
+        a_nuc_test_set_pixels(gs_input);
+        res = amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            if ((gs_raw[i / 8][i % 8] != gs_input[i / 8][i % 8]) ||
+                (gs_temp[i / 8][i % 8] != (float)gs_input[i / 8][i % 8] * 0.25f))
+            {
+                amg8833_interface_debug_print("amg8833: check identity error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check identity ok.\n");
+    
+    /* offset test */
+    amg8833_interface_debug_print("amg8833: offset test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* whole raw offsets with gain 1.0 are exact */
+        for (i = 0; i < 64; i++)
+        {
+            gs_input[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+            gs_offset[i / 8][i % 8] = (rand() % 201 - 100) * 256;
+            gs_gain[i / 8][i % 8] = 16384;
+        }
+        a_nuc_test_set_pixels(gs_input);
+        if ((amg8833_nuc_set_table(&gs_handle, gs_offset, gs_gain) != 0) ||
+            (amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            k = gs_input[i / 8][i % 8] - gs_offset[i / 8][i % 8] / 256;
+            if ((gs_raw[i / 8][i % 8] != k) || (gs_temp[i / 8][i % 8] != (float)k * 0.25f))
+            {
+                amg8833_interface_debug_print("amg8833: check offset error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check offset ok.\n");
+    
+    /* gain test */
+    amg8833_interface_debug_print("amg8833: gain test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* fractional offsets and gains round to the nearest raw and keep 1/256 raw in the temperature */
+        for (i = 0; i < 64; i++)
+        {
+            gs_input[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+            gs_offset[i / 8][i % 8] = rand() % 40001 - 20000;
+            gs_gain[i / 8][i % 8] = (uint16_t)(rand() % 24577 + 8192);
+        }
+        a_nuc_test_set_pixels(gs_input);
+        if ((amg8833_nuc_set_table(&gs_handle, gs_offset, gs_gain) != 0) ||
+            (amg8833_nuc_get_table(&gs_handle, gs_offset_check, gs_gain_check) != 0) ||
+            (memcmp(gs_offset, gs_offset_check, sizeof(gs_offset)) != 0) ||
+            (memcmp(gs_gain, gs_gain_check, sizeof(gs_gain)) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: check table error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            expect = ((float)gs_input[i / 8][i % 8] - (float)gs_offset[i / 8][i % 8] / 256.0f) *
+                     (float)gs_gain[i / 8][i % 8] / 16384.0f;
+            err = (float)gs_raw[i / 8][i % 8] - expect;
+            if ((err > 0.51f) || (err < -0.51f))
+            {
+                amg8833_interface_debug_print("amg8833: check gain raw error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+            err = gs_temp[i / 8][i % 8] - expect * 0.25f;
+            if ((err > 0.002f) || (err < -0.002f))
+            {
+                amg8833_interface_debug_print("amg8833: check gain temperature error.\n");
+                
+                (void)amg8833_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check gain ok.\n");
+    
+    /* disable test */
+    amg8833_interface_debug_print("amg8833: disable test.\n");
+    if ((amg8833_nuc_set_enable(&gs_handle, AMG8833_BOOL_FALSE) != 0) ||
+        (amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 64; i++)
+    {
+        if (gs_raw[i / 8][i % 8] != gs_input[i / 8][i % 8])
+        {
+            amg8833_interface_debug_print("amg8833: check disable error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check disable ok.\n");
+    
+    /* finish nuc test */
+    amg8833_interface_debug_print("amg8833: finish nuc test.\n");
+    (void)amg8833_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_protocol_test.c
+ * @brief     driver amg8833 protocol test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "driver_amg8833_protocol_test.h"
+#include <stdlib.h>
+
+static amg8833_protocol_decoder_t gs_decoder;                   /**< protocol decoder */
+static uint8_t gs_buf[AMG8833_PROTOCOL_MAX_PACKET_SIZE * 2];    /**< packet buffer */
+
+/**
+ * @brief     protocol test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_protocol_test(uint32_t times)
+{
+    uint8_t res;
+    uint16_t len;
+    uint16_t len2;
+    uint16_t used;
+    uint16_t seq;
+    uint16_t i;
+    uint32_t t;
+    uint32_t frame_count;
+    uint32_t lost_count;
+    uint32_t error_count;
+    amg8833_frame_t frame;
+    amg8833_frame_t frame_check;
+    
+    /* start protocol test */
+    amg8833_interface_debug_print("amg8833: start protocol test.\n");
+    
+    /* init the decoder */
+    res = amg8833_protocol_decoder_init(&gs_decoder);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: decoder init failed.\n");
+        
+        return 1;
+    }
+    
+    /* round trip test */
+    amg8833_interface_debug_print("amg8833: round trip test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* random frame with many zeros */
+        for (i = 0; i < 128; i++)
+        {
+            frame.raw[i] = ((rand() % 4) == 0) ? 0x00 : (uint8_t)(rand() % 256);
+        }
+        frame.thermistor = (int16_t)(rand() % 4096);
+        frame.status = (uint8_t)(rand() % 16);
+        
+        /* encode */
+        res = amg8833_protocol_encode(&frame, (uint16_t)t, gs_buf, sizeof(gs_buf), &len);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: encode failed.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < len - 1; i++)
+        {
+            if (gs_buf[i] == 0x00)
+            {
+                amg8833_interface_debug_print("amg8833: delimiter found inside the packet.\n");
+                
+                return 1;
+            }
+        }
+        
+        /* decode in two pieces */
+        res = amg8833_protocol_decode(&gs_decoder, gs_buf, len / 2, &used, &frame_check, &seq);
+        if (res != 1)
+        {
+            amg8833_interface_debug_print("amg8833: decode half packet failed.\n");
+            
+            return 1;
+        }
+        res = amg8833_protocol_decode(&gs_decoder, &gs_buf[len / 2], len - len / 2, &used, &frame_check, &seq);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: decode failed.\n");
+            
+            return 1;
+        }
+        if ((seq != (uint16_t)t) || (frame_check.status != frame.status) ||
+            (frame_check.thermistor != frame.thermistor) || (memcmp(frame_check.raw, frame.raw, 128) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: check frame error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check frame ok.\n");
+    
+    /* lost frame test */
+    amg8833_interface_debug_print("amg8833: lost frame test.\n");
+    (void)amg8833_protocol_decoder_init(&gs_decoder);
+    (void)amg8833_protocol_encode(&frame, 100, gs_buf, sizeof(gs_buf), &len);
+    (void)amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    (void)amg8833_protocol_encode(&frame, 103, gs_buf, sizeof(gs_buf), &len);
+    (void)amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    (void)amg8833_protocol_get_statistics(&gs_decoder, &frame_count, &lost_count, &error_count);
+    if ((frame_count != 2) || (lost_count != 2) || (error_count != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check lost frame error.\n");
+        
+        return 1;
+    }
+    
+    /* the encoder restarts at 0 */
+    (void)amg8833_protocol_encode(&frame, 0, gs_buf, sizeof(gs_buf), &len);
+    (void)amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    (void)amg8833_protocol_encode(&frame, 1, gs_buf, sizeof(gs_buf), &len);
+    (void)amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    (void)amg8833_protocol_get_statistics(&gs_decoder, &frame_count, &lost_count, &error_count);
+    if ((frame_count != 4) || (lost_count != 2) || (error_count != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check sequence restart error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check lost frame ok.\n");
+    
+    /* corrupted packet test */
+    amg8833_interface_debug_print("amg8833: corrupted packet test.\n");
+    (void)amg8833_protocol_encode(&frame, 104, gs_buf, sizeof(gs_buf), &len);
+    gs_buf[len / 2] = (gs_buf[len / 2] == 0x55) ? 0xAA : 0x55;
+    res = amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    if ((res != 4) && (res != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check corrupted packet error.\n");
+        
+        return 1;
+    }
+    
+    /* resync after a truncated packet */
+    (void)amg8833_protocol_encode(&frame, 105, gs_buf, sizeof(gs_buf), &len);
+    (void)amg8833_protocol_encode(&frame, 106, &gs_buf[len - 10], (uint16_t)(sizeof(gs_buf) - (len - 10)), &len2);
+    res = amg8833_protocol_decode(&gs_decoder, gs_buf, (uint16_t)(len - 10 + len2), &used, &frame_check, &seq);
+    if ((res != 4) && (res != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check truncated packet error.\n");
+        
+        return 1;
+    }
+    (void)amg8833_protocol_encode(&frame, 107, gs_buf, sizeof(gs_buf), &len);
+    res = amg8833_protocol_decode(&gs_decoder, gs_buf, len, &used, &frame_check, &seq);
+    if ((res != 0) || (seq != 107))
+    {
+        amg8833_interface_debug_print("amg8833: check resync error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check corrupted packet ok.\n");
+    
+    /* finish protocol test */
+    amg8833_interface_debug_print("amg8833: finish protocol test.\n");
+    
+    return 0;
+}
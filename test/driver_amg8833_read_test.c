@@ -52,6 +52,7 @@ static float gs_temp[8][8];               /**< temperature buffer */
 uint8_t amg8833_read_test(amg8833_address_t addr_pin, uint32_t times)
 {
     uint32_t i, j, k;
+    uint32_t elapsed;
     uint8_t res;
     amg8833_info_t info;
     
@@ -148,8 +149,16 @@ uint8_t amg8833_read_test(amg8833_address_t addr_pin, uint32_t times)
         return 1;
     }
     
-    /* delay 1000 ms */
-    amg8833_interface_delay_ms(1000);
+    /* wait the first frames */
+    res = amg8833_wait_frame_ready(&gs_handle, 2, 10, 2000, &elapsed);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: wait frame ready failed.\n");
+        (void)amg8833_deinit(&gs_handle);
+       
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: first frame after %d ms.\n", elapsed);
     
     for (i = 0; i < times; i++)
     {
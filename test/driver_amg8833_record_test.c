@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_record_test.c
+ * @brief     driver amg8833 record test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_record_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+#define RECORD_TEST_BLOCK_FRAMES        8         /**< frames per block */
+#define RECORD_TEST_FRAMES              45        /**< frames per recording */
+#define RECORD_TEST_FILE_SIZE           12288     /**< recording buffer size */
+
+static amg8833_record_writer_t gs_writer;                                                                  /**< record writer */
+static amg8833_record_reader_t gs_reader;                                                                  /**< record reader */
+static amg8833_record_block_t gs_block[8];                                                                 /**< block index */
+static uint8_t gs_block_buf[AMG8833_RECORD_HEADER_SIZE + RECORD_TEST_BLOCK_FRAMES * AMG8833_RECORD_FRAME_SIZE];    /**< block buffer */
+static uint8_t gs_file[RECORD_TEST_FILE_SIZE];                                                             /**< recording buffer */
+static uint32_t gs_file_size;                                                                              /**< recording size */
+static int16_t gs_pixel[RECORD_TEST_FRAMES][64];                                                           /**< recorded pixels */
+static uint32_t gs_found;                                                                                  /**< found frames */
+static uint64_t gs_found_time;                                                                             /**< found frames timestamp xor */
+
+/**
+ * @brief     write the recording
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_record_test_write(const uint8_t *buf, uint32_t len)
+{
+    if (gs_file_size + len > RECORD_TEST_FILE_SIZE)
+    {
+        return 1;
+    }
+    memcpy(&gs_file[gs_file_size], buf, len);
+    gs_file_size += len;
+    
+    return 0;
+}
+
+/**
+ * @brief      read the recording
+ * @param[in]  offset is the data offset
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the recording
+ * @note       none
+ */
+static uint8_t a_record_test_read(uint64_t offset, uint8_t *buf, uint32_t len)
+{
+    if (offset + len > gs_file_size)
+    {
+        return 1;
+    }
+    memcpy(buf, &gs_file[offset], len);
+    
+    return 0;
+}
+
+/**
+ * @brief     threshold query callback
+ * @param[in] *frame points to a frame
+ * @note      none
+ */
+static void a_record_test_callback(const amg8833_frame_t *frame)
+{
+    gs_found++;
+    gs_found_time ^= frame->timestamp;
+}
+
+/**
+ * @brief     record test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_record_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t row;
+    uint8_t col;
+    uint32_t t;
+    uint32_t k;
+    uint32_t count;
+    uint32_t first;
+    uint32_t last;
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+    int16_t min_check;
+    int16_t max_check;
+    int16_t threshold;
+    int16_t frame_max;
+    uint64_t time_check;
+    float mean;
+    amg8833_frame_t frame;
+    amg8833_frame_t frame_check;
+    
+    /* start record test */
+    amg8833_interface_debug_print("amg8833: start record test.\n");
+    
+    /* frame record test */
+    amg8833_interface_debug_print("amg8833: frame record test.\n");
+    for (t = 0; t < times; t++)
+    {
+        frame.timestamp = ((uint64_t)(uint32_t)rand() << 24) ^ (uint32_t)rand();
+        for (i = 0; i < 128; i++)
+        {
+            frame.raw[i] = (uint8_t)(rand() % 256);
+        }
+        frame.thermistor = (int16_t)(rand() % 4096);
+        frame.status = (uint8_t)(rand() % 16);
+        frame.addr = (uint8_t)(0x68 + rand() % 2);
+        for (i = 0; i < 8; i++)
+        {
+            frame.interrupt[i] = (uint8_t)(rand() % 256);
+        }
+        amg8833_record_encode_frame(&frame, gs_block_buf);
+        amg8833_record_decode_frame(gs_block_buf, &frame_check);
+        if ((frame.timestamp != frame_check.timestamp) || (frame.thermistor != frame_check.thermistor) ||
+            (frame.status != frame_check.status) || (frame.addr != frame_check.addr) ||
+            (memcmp(frame.raw, frame_check.raw, 128) != 0) || (memcmp(frame.interrupt, frame_check.interrupt, 8) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: check frame record error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check frame record ok.\n");
+    
+    /* query test */
+    amg8833_interface_debug_print("amg8833: query test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* write a recording with a partial last block */
+        gs_file_size = 0;
+        res = amg8833_record_writer_init(&gs_writer, gs_block_buf, RECORD_TEST_BLOCK_FRAMES, a_record_test_write);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: writer init failed.\n");
+            
+            return 1;
+        }
+        memset(&frame, 0, sizeof(amg8833_frame_t));
+        for (k = 0; k < RECORD_TEST_FRAMES; k++)
+        {
+            frame.timestamp = (uint64_t)k * 100;
+            for (i = 0; i < 64; i++)
+            {
+                gs_pixel[k][i] = (int16_t)(rand() % 400 - 80);
+                frame.raw[127 - i * 2] = (uint8_t)((uint16_t)gs_pixel[k][i] >> 8);
+                frame.raw[126 - i * 2] = (uint8_t)((uint16_t)gs_pixel[k][i] >> 0);
+            }
+            res = amg8833_record_write(&gs_writer, &frame);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: write failed.\n");
+                
+                return 1;
+            }
+        }
+        res = amg8833_record_flush(&gs_writer);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: flush failed.\n");
+            
+            return 1;
+        }
+        
+        /* index the recording */
+        res = amg8833_record_reader_init(&gs_reader, gs_block, 8, gs_block_buf, sizeof(gs_block_buf), a_record_test_read);
+        if ((res != 0) || (gs_reader.block_count != (RECORD_TEST_FRAMES + RECORD_TEST_BLOCK_FRAMES - 1) / RECORD_TEST_BLOCK_FRAMES))
+        {
+            amg8833_interface_debug_print("amg8833: reader init failed.\n");
+            
+            return 1;
+        }
+        
+        /* random pixel range */
+        first = (uint32_t)(rand() % RECORD_TEST_FRAMES);
+        last = first + (uint32_t)(rand() % (RECORD_TEST_FRAMES - first));
+        row = (uint8_t)(rand() % 8);
+        col = (uint8_t)(rand() % 8);
+        min_check = 32767;
+        max_check = -32768;
+        sum = 0;
+        for (k = first; k <= last; k++)
+        {
+            min_check = (gs_pixel[k][row * 8 + col] < min_check) ? gs_pixel[k][row * 8 + col] : min_check;
+            max_check = (gs_pixel[k][row * 8 + col] > max_check) ? gs_pixel[k][row * 8 + col] : max_check;
+            sum += gs_pixel[k][row * 8 + col];
+        }
+        res = amg8833_record_query_pixel(&gs_reader, (uint64_t)first * 100, (uint64_t)last * 100 + 50,
+                                         row, col, &min, &max, &mean);
+        if ((res != 0) || (min != min_check) || (max != max_check) ||
+            (fabsf(mean - (float)sum / (float)(last - first + 1)) > 0.01f))
+        {
+            amg8833_interface_debug_print("amg8833: check pixel query error.\n");
+            
+            return 1;
+        }
+        if (gs_reader.decoded_blocks > 2)
+        {
+            amg8833_interface_debug_print("amg8833: check decoded blocks error.\n");
+            
+            return 1;
+        }
+        
+        /* random threshold range */
+        threshold = (int16_t)(rand() % 60 + 260);
+        count = 0;
+        time_check = 0;
+        for (k = first; k <= last; k++)
+        {
+            frame_max = -32768;
+            for (i = 0; i < 64; i++)
+            {
+                frame_max = (gs_pixel[k][i] > frame_max) ? gs_pixel[k][i] : frame_max;
+            }
+            if (frame_max > threshold)
+            {
+                count++;
+                time_check ^= (uint64_t)k * 100;
+            }
+        }
+        gs_found = 0;
+        gs_found_time = 0;
+        res = amg8833_record_query_threshold(&gs_reader, (uint64_t)first * 100, (uint64_t)last * 100,
+                                             threshold, a_record_test_callback);
+        if ((res != 0) || (gs_found != count) || (gs_found_time != time_check))
+        {
+            amg8833_interface_debug_print("amg8833: check threshold query error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check query ok.\n");
+    
+    /* whole recording test */
+    amg8833_interface_debug_print("amg8833: whole recording test.\n");
+    res = amg8833_record_query_pixel(&gs_reader, 0, (uint64_t)RECORD_TEST_FRAMES * 100, 0, 0, &min, &max, &mean);
+    if ((res != 0) || (gs_reader.decoded_blocks != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check summary answer error.\n");
+        
+        return 1;
+    }
+    res = amg8833_record_query_pixel(&gs_reader, (uint64_t)RECORD_TEST_FRAMES * 100, (uint64_t)RECORD_TEST_FRAMES * 200,
+                                     0, 0, &min, &max, &mean);
+    if (res != 4)
+    {
+        amg8833_interface_debug_print("amg8833: check empty range error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check whole recording ok.\n");
+    
+    /* finish record test */
+    amg8833_interface_debug_print("amg8833: finish record test.\n");
+    
+    return 0;
+}
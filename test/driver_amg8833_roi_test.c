@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_roi_test.c
+ * @brief     driver amg8833 roi test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_roi_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+#define ROI_TEST_MAX        8        /**< max rois */
+
+static amg8833_roi_set_t gs_set;                                 /**< roi set */
+static amg8833_roi_t gs_roi[ROI_TEST_MAX];                       /**< roi buffer */
+static amg8833_roi_result_t gs_result[ROI_TEST_MAX];             /**< result buffer */
+static uint8_t gs_index[ROI_TEST_MAX * 64];                      /**< pixel index pool */
+static uint8_t gs_weight_pool[ROI_TEST_MAX * 64];                /**< pixel weight pool */
+static uint8_t gs_weight[ROI_TEST_MAX][8][8];                    /**< roi weights */
+static int16_t gs_threshold[ROI_TEST_MAX];                       /**< roi thresholds */
+static int16_t gs_raw[8][8];                                     /**< raw buffer */
+
+/**
+ * @brief     roi test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_roi_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t n;
+    uint8_t k;
+    uint8_t i;
+    uint8_t count;
+    uint16_t id;
+    uint32_t t;
+    uint32_t weight_sum;
+    int32_t sum;
+    int16_t max;
+    uint64_t mask;
+    
+    /* start roi test */
+    amg8833_interface_debug_print("amg8833: start roi test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    res = amg8833_roi_init(&gs_set, gs_roi, ROI_TEST_MAX, gs_index, gs_weight_pool, 100);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: roi init failed.\n");
+        
+        return 1;
+    }
+    if ((amg8833_roi_add_mask(&gs_set, 0, 0, &id) != 5) ||
+        (amg8833_roi_add_mask(&gs_set, 0xFFFFFFFFFFFFFFFFULL, 0, &id) != 0) ||
+        (amg8833_roi_add_mask(&gs_set, 0xFFFFFFFFFFFFFFFFULL, 0, &id) != 4))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* evaluate test */
+    amg8833_interface_debug_print("amg8833: evaluate test.\n");
+    (void)amg8833_roi_init(&gs_set, gs_roi, ROI_TEST_MAX, gs_index, gs_weight_pool, ROI_TEST_MAX * 64);
+    for (t = 0; t < times; t++)
+    {
+        /* random mask and weighted rois */
+        (void)amg8833_roi_clear(&gs_set);
+        n = (uint8_t)(rand() % ROI_TEST_MAX + 1);
+        for (k = 0; k < n; k++)
+        {
+            gs_threshold[k] = (int16_t)(rand() % 200);
+            mask = 0;
+            for (i = 0; i < 64; i++)
+            {
+                gs_weight[k][i / 8][i % 8] = ((rand() % 3) == 0) ? (uint8_t)(rand() % 256) : 0;
+                mask |= (uint64_t)(gs_weight[k][i / 8][i % 8] != 0) << i;
+            }
+            if (mask == 0)
+            {
+                gs_weight[k][3][3] = 1;
+                mask = (uint64_t)1 << 27;
+            }
+            if ((k % 2) == 0)
+            {
+                for (i = 0; i < 64; i++)
+                {
+                    gs_weight[k][i / 8][i % 8] = (uint8_t)((mask >> i) & 1);
+                }
+                res = amg8833_roi_add_mask(&gs_set, mask, gs_threshold[k], &id);
+            }
+            else
+            {
+                res = amg8833_roi_add_weight(&gs_set, gs_weight[k], gs_threshold[k], &id);
+            }
+            if ((res != 0) || (id != k))
+            {
+                amg8833_interface_debug_print("amg8833: add roi failed.\n");
+                
+                return 1;
+            }
+        }
+        
+        /* compare with a dense pass */
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % 400 - 80);
+        }
+        res = amg8833_roi_evaluate(&gs_set, gs_raw, gs_result);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: evaluate failed.\n");
+            
+            return 1;
+        }
+        for (k = 0; k < n; k++)
+        {
+            sum = 0;
+            weight_sum = 0;
+            max = INT16_MIN;
+            count = 0;
+            for (i = 0; i < 64; i++)
+            {
+                if (gs_weight[k][i / 8][i % 8] == 0)
+                {
+                    continue;
+                }
+                sum += (int32_t)gs_weight[k][i / 8][i % 8] * gs_raw[i / 8][i % 8];
+                weight_sum += gs_weight[k][i / 8][i % 8];
+                max = (gs_raw[i / 8][i % 8] > max) ? gs_raw[i / 8][i % 8] : max;
+                count = (uint8_t)(count + (gs_raw[i / 8][i % 8] > gs_threshold[k]));
+            }
+            if ((gs_result[k].max != max) || (gs_result[k].count != count) ||
+                (fabsf(gs_result[k].mean - (float)sum / (float)weight_sum * 0.25f) > 0.01f))
+            {
+                amg8833_interface_debug_print("amg8833: check roi %d error.\n", k);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check evaluate ok.\n");
+    
+    /* finish roi test */
+    amg8833_interface_debug_print("amg8833: finish roi test.\n");
+    
+    return 0;
+}
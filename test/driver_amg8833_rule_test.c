@@ -0,0 +1,398 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_rule_test.c
+ * @brief     driver amg8833 rule test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_rule_test.h"
+#include <stdlib.h>
+
+static amg8833_rule_engine_t gs_engine;        /**< rule engine */
+static amg8833_rule_t gs_rule[4];              /**< rule table */
+static int32_t gs_value[10];                   /**< value vector for 2 rois */
+static int16_t gs_raw[8][8];                   /**< raw buffer */
+static amg8833_roi_result_t gs_result[2];      /**< roi results */
+
+/**
+ * @brief     reference compare
+ * @param[in] op is the rule operator
+ * @param[in] value is the value in fixed point
+ * @param[in] threshold is the threshold in the same fixed point
+ * @return    1 if the value passes
+ * @note      none
+ */
+static uint8_t a_rule_test_compare(amg8833_rule_operator_t op, int64_t value, int64_t threshold)
+{
+    switch (op)
+    {
+        case AMG8833_RULE_OPERATOR_GREATER :
+        {
+            return (uint8_t)(value > threshold);
+        }
+        case AMG8833_RULE_OPERATOR_GREATER_EQUAL :
+        {
+            return (uint8_t)(value >= threshold);
+        }
+        case AMG8833_RULE_OPERATOR_LESS :
+        {
+            return (uint8_t)(value < threshold);
+        }
+        default :
+        {
+            return (uint8_t)(value <= threshold);
+        }
+    }
+}
+
+/**
+ * @brief     rule test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_rule_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t pass;
+    uint8_t counter;
+    uint16_t id;
+    uint16_t fired;
+    uint16_t hold;
+    uint16_t period;
+    uint16_t i;
+    uint32_t t;
+    uint32_t k;
+    int16_t step;
+    int16_t max;
+    int16_t min;
+    int32_t sum;
+    int32_t level[4];
+    uint8_t check[4];
+    amg8833_rule_operator_t op[4];
+    const uint16_t period_list[5] = {100, 125, 250, 500, 1000};
+    
+    /* start rule test */
+    amg8833_interface_debug_print("amg8833: start rule test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 3, 100) != 5) ||
+        (amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, 0) != 5) ||
+        (amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, 100) != 0) ||
+        (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                          AMG8833_RULE_OPERATOR_GREATER, 30.0f, 0, &id) != 5) ||
+        (amg8833_rule_add(&gs_engine, (amg8833_rule_source_t)7, 0,
+                          AMG8833_RULE_OPERATOR_GREATER, 30.0f, 1, &id) != 5) ||
+        (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                          (amg8833_rule_operator_t)4, 30.0f, 1, &id) != 5) ||
+        (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_ROI_MEAN, 2,
+                          AMG8833_RULE_OPERATOR_GREATER, 30.0f, 1, &id) != 5) ||
+        (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                          AMG8833_RULE_OPERATOR_GREATER, 3.0e6f, 1, &id) != 5) ||
+        (amg8833_rule_evaluate(&gs_engine, gs_raw, gs_result, 3, &fired) != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        if ((amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                              AMG8833_RULE_OPERATOR_GREATER, 30.0f, 1, &id) != 0) || (id != i))
+        {
+            amg8833_interface_debug_print("amg8833: check rule id error.\n");
+            
+            return 1;
+        }
+    }
+    if (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                         AMG8833_RULE_OPERATOR_GREATER, 30.0f, 1, &id) != 4)
+    {
+        amg8833_interface_debug_print("amg8833: check full table error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* frame test */
+    amg8833_interface_debug_print("amg8833: frame test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* quarter degree thresholds hit the edges exactly */
+        res = amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, 100);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: rule init failed.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < 3; i++)
+        {
+            op[i] = (amg8833_rule_operator_t)(rand() % 4);
+            level[i] = rand() % 401 - 100;
+            res = amg8833_rule_add(&gs_engine, (amg8833_rule_source_t)i, 0, op[i],
+                                   (float)level[i] / 4.0f, 1, &id);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: rule add failed.\n");
+                
+                return 1;
+            }
+        }
+        for (k = 0; k < 16; k++)
+        {
+            max = -32768;
+            min = 32767;
+            sum = 0;
+            for (i = 0; i < 64; i++)
+            {
+                gs_raw[i / 8][i % 8] = (int16_t)(level[rand() % 3] + rand() % 9 - 4);
+                max = (gs_raw[i / 8][i % 8] > max) ? gs_raw[i / 8][i % 8] : max;
+                min = (gs_raw[i / 8][i % 8] < min) ? gs_raw[i / 8][i % 8] : min;
+                sum += gs_raw[i / 8][i % 8];
+            }
+            check[0] = a_rule_test_compare(op[0], (int64_t)max * 64, (int64_t)level[0] * 64);
+            check[1] = a_rule_test_compare(op[1], (int64_t)min * 64, (int64_t)level[1] * 64);
+            check[2] = a_rule_test_compare(op[2], sum, (int64_t)level[2] * 64);
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, NULL, 0, &fired);
+            if ((res != 0) || (fired != check[0] + check[1] + check[2]))
+            {
+                amg8833_interface_debug_print("amg8833: check fired count error.\n");
+                
+                return 1;
+            }
+            for (i = 0; i < 3; i++)
+            {
+                if (gs_rule[i].fired != check[i])
+                {
+                    amg8833_interface_debug_print("amg8833: check frame source %d error.\n", i);
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check frame ok.\n");
+    
+    /* hold test */
+    amg8833_interface_debug_print("amg8833: hold test.\n");
+    for (t = 0; t < times; t++)
+    {
+        res = amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, 100);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: rule init failed.\n");
+            
+            return 1;
+        }
+        hold = (uint16_t)(rand() % 5 + 1);
+        res = amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_FRAME_MAX, 0,
+                               AMG8833_RULE_OPERATOR_GREATER, 30.0f, hold, &id);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: rule add failed.\n");
+            
+            return 1;
+        }
+        counter = 0;
+        for (k = 0; k < 64; k++)
+        {
+            /* runs of hot frames broken by cold ones */
+            pass = (uint8_t)((rand() % 4) != 0);
+            for (i = 0; i < 64; i++)
+            {
+                gs_raw[i / 8][i % 8] = 100;
+            }
+            gs_raw[rand() % 8][rand() % 8] = (int16_t)(pass ? 121 : 120);
+            counter = pass ? (uint8_t)(counter + 1) : 0;
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, NULL, 0, &fired);
+            if ((res != 0) || (fired != (counter >= hold)) || (gs_rule[0].fired != fired))
+            {
+                amg8833_interface_debug_print("amg8833: check hold %d error.\n", hold);
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check hold ok.\n");
+    
+    /* rate test */
+    amg8833_interface_debug_print("amg8833: rate test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* a ramp of step raw per period rises step * 250 / period C/s */
+        period = period_list[rand() % 5];
+        step = (int16_t)(rand() % 8 + 1);
+        res = amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, period);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: rule init failed.\n");
+            
+            return 1;
+        }
+        if ((amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_RATE_MAX, 0, AMG8833_RULE_OPERATOR_GREATER_EQUAL,
+                              (float)step * 250.0f / (float)period, 1, &id) != 0) ||
+            (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_RATE_MAX, 0, AMG8833_RULE_OPERATOR_GREATER,
+                              (float)step * 250.0f / (float)period, 1, &id) != 0) ||
+            (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_RATE_MAX, 0, AMG8833_RULE_OPERATOR_LESS_EQUAL,
+                              0.0f, 1, &id) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: rule add failed.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % 41 + 80);
+        }
+        i = (uint16_t)(rand() % 64);
+        for (k = 0; k < 24; k++)
+        {
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, NULL, 0, &fired);
+            if ((res != 0) || (gs_rule[0].fired != (k != 0)) || (gs_rule[1].fired != 0) ||
+                (gs_rule[2].fired != (k == 0)))
+            {
+                amg8833_interface_debug_print("amg8833: check ramp rate error.\n");
+                
+                return 1;
+            }
+            gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] + step);
+        }
+        
+        /* a flat scene drops to zero once the ring has turned over */
+        for (k = 0; k < AMG8833_RULE_RATE_FRAMES + 1; k++)
+        {
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, NULL, 0, &fired);
+            if ((res != 0) || (gs_rule[2].fired != (k == AMG8833_RULE_RATE_FRAMES)))
+            {
+                amg8833_interface_debug_print("amg8833: check flat rate error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check rate ok.\n");
+    
+    /* roi test */
+    amg8833_interface_debug_print("amg8833: roi test.\n");
+    for (t = 0; t < times; t++)
+    {
+        res = amg8833_rule_init(&gs_engine, gs_rule, 4, gs_value, 10, 100);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: rule init failed.\n");
+            
+            return 1;
+        }
+        for (i = 0; i < 4; i++)
+        {
+            op[i] = (amg8833_rule_operator_t)(rand() % 4);
+            level[i] = (i == 2) ? (rand() % 65) : (rand() % 401 - 100);
+        }
+        if ((amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_ROI_MEAN, 0, op[0],
+                              (float)level[0] / 4.0f, 1, &id) != 0) ||
+            (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_ROI_MAX, 1, op[1],
+                              (float)level[1] / 4.0f, 1, &id) != 0) ||
+            (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_ROI_COUNT, 1, op[2],
+                              (float)level[2], 1, &id) != 0) ||
+            (amg8833_rule_add(&gs_engine, AMG8833_RULE_SOURCE_ROI_COUNT, 1,
+                              AMG8833_RULE_OPERATOR_LESS, 100.0f, 1, &id) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: rule add failed.\n");
+            
+            return 1;
+        }
+        for (k = 0; k < 16; k++)
+        {
+            for (i = 0; i < 64; i++)
+            {
+                gs_raw[i / 8][i % 8] = 100;
+            }
+            gs_result[0].mean = (float)(level[rand() % 2] + rand() % 5 - 2) / 4.0f;
+            gs_result[0].max = (int16_t)(rand() % 401 - 100);
+            gs_result[0].count = (uint8_t)(rand() % 65);
+            gs_result[1].mean = (float)(rand() % 401 - 100) / 4.0f;
+            gs_result[1].max = (int16_t)(level[rand() % 2] + rand() % 5 - 2);
+            gs_result[1].count = (uint8_t)(level[2] + rand() % 5 - 2);
+            if (gs_result[1].count > 64)
+            {
+                gs_result[1].count = 0;
+            }
+            check[0] = a_rule_test_compare(op[0], (int64_t)(gs_result[0].mean * 4.0f), level[0]);
+            check[1] = a_rule_test_compare(op[1], gs_result[1].max, level[1]);
+            check[2] = a_rule_test_compare(op[2], gs_result[1].count, level[2]);
+            check[3] = 1;
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, gs_result, 2, &fired);
+            if ((res != 0) || (fired != check[0] + check[1] + check[2] + check[3]))
+            {
+                amg8833_interface_debug_print("amg8833: check fired count error.\n");
+                
+                return 1;
+            }
+            for (i = 0; i < 4; i++)
+            {
+                if (gs_rule[i].fired != check[i])
+                {
+                    amg8833_interface_debug_print("amg8833: check roi rule %d error.\n", i);
+                    
+                    return 1;
+                }
+            }
+            
+            /* rules on a missing roi never pass */
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, gs_result, 1, &fired);
+            if ((res != 0) || (fired != check[0]) || (gs_rule[1].fired != 0) ||
+                (gs_rule[2].fired != 0) || (gs_rule[3].fired != 0))
+            {
+                amg8833_interface_debug_print("amg8833: check missing roi error.\n");
+                
+                return 1;
+            }
+            res = amg8833_rule_evaluate(&gs_engine, gs_raw, NULL, 2, &fired);
+            if ((res != 0) || (fired != 0))
+            {
+                amg8833_interface_debug_print("amg8833: check no roi error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check roi ok.\n");
+    
+    /* finish rule test */
+    amg8833_interface_debug_print("amg8833: finish rule test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_serializer_test.c
+ * @brief     driver amg8833 serializer test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_serializer_test.h"
+#include <stdlib.h>
+
+static amg8833_serializer_decoder_t gs_decoder;                  /**< serializer decoder */
+static uint8_t gs_buf[AMG8833_SERIALIZER_MAX_SIZE * 3];          /**< item buffer */
+static amg8833_frame_t gs_frame[3];                              /**< frame buffer */
+
+/**
+ * @brief     make a random frame
+ * @param[in] *frame points to a frame buffer
+ * @note      none
+ */
+static void a_serializer_test_frame(amg8833_frame_t *frame)
+{
+    uint8_t i;
+    
+    frame->timestamp = ((uint64_t)(uint32_t)rand() << 20) ^ (uint32_t)rand();
+    for (i = 0; i < 128; i++)
+    {
+        frame->raw[i] = (uint8_t)(rand() % 256);
+    }
+    frame->thermistor = (int16_t)(rand() % 2047 + 1);
+    if ((rand() % 2) == 0)
+    {
+        frame->thermistor |= 0x800;
+    }
+    frame->status = (uint8_t)(rand() % 16);
+    frame->addr = (uint8_t)(0x68 + rand() % 2);
+    for (i = 0; i < 8; i++)
+    {
+        frame->interrupt[i] = (uint8_t)(rand() % 256);
+    }
+}
+
+/**
+ * @brief     compare two frames
+ * @param[in] *a points to a frame
+ * @param[in] *b points to a frame
+ * @return    0 if they are equal
+ * @note      none
+ */
+static uint8_t a_serializer_test_compare(const amg8833_frame_t *a, const amg8833_frame_t *b)
+{
+    if ((a->timestamp != b->timestamp) || (a->thermistor != b->thermistor) ||
+        (a->status != b->status) || (a->addr != b->addr) ||
+        (memcmp(a->raw, b->raw, 128) != 0) || (memcmp(a->interrupt, b->interrupt, 8) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     serializer test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_serializer_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t k;
+    uint8_t f;
+    uint16_t len;
+    uint16_t total;
+    uint16_t pos;
+    uint16_t chunk;
+    uint16_t used;
+    uint32_t t;
+    amg8833_frame_t frame_check;
+    amg8833_serializer_format_t format;
+    
+    /* start serializer test */
+    amg8833_interface_debug_print("amg8833: start serializer test.\n");
+    
+    /* round trip test */
+    amg8833_interface_debug_print("amg8833: round trip test.\n");
+    for (f = 0; f < 2; f++)
+    {
+        format = (f == 0) ? AMG8833_SERIALIZER_FORMAT_CBOR : AMG8833_SERIALIZER_FORMAT_MSGPACK;
+        res = amg8833_serializer_decoder_init(&gs_decoder, format);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: decoder init failed.\n");
+            
+            return 1;
+        }
+        for (t = 0; t < times; t++)
+        {
+            a_serializer_test_frame(&gs_frame[0]);
+            res = amg8833_serializer_encode(format, &gs_frame[0], gs_buf, AMG8833_SERIALIZER_MAX_SIZE, &len);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: encode failed.\n");
+                
+                return 1;
+            }
+            
+            /* a map of six entries */
+            if (gs_buf[0] != ((format == AMG8833_SERIALIZER_FORMAT_CBOR) ? 0xA6 : 0x86))
+            {
+                amg8833_interface_debug_print("amg8833: check map head error.\n");
+                
+                return 1;
+            }
+            
+            /* decode in two pieces */
+            res = amg8833_serializer_decode(&gs_decoder, gs_buf, len / 2, &used, &frame_check);
+            if ((res != 1) || (used != len / 2))
+            {
+                amg8833_interface_debug_print("amg8833: decode half item failed.\n");
+                
+                return 1;
+            }
+            res = amg8833_serializer_decode(&gs_decoder, &gs_buf[len / 2], len - len / 2, &used, &frame_check);
+            if ((res != 0) || (used != len - len / 2))
+            {
+                amg8833_interface_debug_print("amg8833: decode failed.\n");
+                
+                return 1;
+            }
+            if (a_serializer_test_compare(&gs_frame[0], &frame_check) != 0)
+            {
+                amg8833_interface_debug_print("amg8833: check frame error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check frame ok.\n");
+    
+    /* stream test */
+    amg8833_interface_debug_print("amg8833: stream test.\n");
+    for (t = 0; t < times; t++)
+    {
+        format = ((t % 2) == 0) ? AMG8833_SERIALIZER_FORMAT_CBOR : AMG8833_SERIALIZER_FORMAT_MSGPACK;
+        (void)amg8833_serializer_decoder_init(&gs_decoder, format);
+        total = 0;
+        for (k = 0; k < 3; k++)
+        {
+            a_serializer_test_frame(&gs_frame[k]);
+            (void)amg8833_serializer_encode(format, &gs_frame[k], &gs_buf[total], AMG8833_SERIALIZER_MAX_SIZE, &len);
+            total = (uint16_t)(total + len);
+        }
+        
+        /* feed random chunks */
+        pos = 0;
+        k = 0;
+        while (pos < total)
+        {
+            chunk = (uint16_t)(rand() % 32 + 1);
+            if (chunk > total - pos)
+            {
+                chunk = (uint16_t)(total - pos);
+            }
+            res = amg8833_serializer_decode(&gs_decoder, &gs_buf[pos], chunk, &used, &frame_check);
+            if ((res != 0) && (res != 1))
+            {
+                amg8833_interface_debug_print("amg8833: decode stream failed.\n");
+                
+                return 1;
+            }
+            if (res == 0)
+            {
+                if ((k >= 3) || (a_serializer_test_compare(&gs_frame[k], &frame_check) != 0))
+                {
+                    amg8833_interface_debug_print("amg8833: check stream frame error.\n");
+                    
+                    return 1;
+                }
+                k++;
+            }
+            pos = (uint16_t)(pos + used);
+        }
+        if (k != 3)
+        {
+            amg8833_interface_debug_print("amg8833: check stream frame count error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check stream ok.\n");
+    
+    /* error test */
+    amg8833_interface_debug_print("amg8833: error test.\n");
+    res = amg8833_serializer_encode(AMG8833_SERIALIZER_FORMAT_CBOR, &gs_frame[0], gs_buf, 100, &len);
+    if (res != 1)
+    {
+        amg8833_interface_debug_print("amg8833: check small buffer error.\n");
+        
+        return 1;
+    }
+    res = amg8833_serializer_encode((amg8833_serializer_format_t)2, &gs_frame[0], gs_buf, sizeof(gs_buf), &len);
+    if (res != 5)
+    {
+        amg8833_interface_debug_print("amg8833: check format error.\n");
+        
+        return 1;
+    }
+    (void)amg8833_serializer_decoder_init(&gs_decoder, AMG8833_SERIALIZER_FORMAT_CBOR);
+    gs_buf[0] = 0x01;
+    res = amg8833_serializer_decode(&gs_decoder, gs_buf, 1, &used, &frame_check);
+    if (res != 4)
+    {
+        amg8833_interface_debug_print("amg8833: check invalid item error.\n");
+        
+        return 1;
+    }
+    
+    /* the decoder is reset after the invalid item */
+    (void)amg8833_serializer_encode(AMG8833_SERIALIZER_FORMAT_CBOR, &gs_frame[0], gs_buf, sizeof(gs_buf), &len);
+    res = amg8833_serializer_decode(&gs_decoder, gs_buf, len, &used, &frame_check);
+    if ((res != 0) || (a_serializer_test_compare(&gs_frame[0], &frame_check) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check reset error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check error ok.\n");
+    
+    /* finish serializer test */
+    amg8833_interface_debug_print("amg8833: finish serializer test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,481 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_snapshot_test.c
+ * @brief     driver amg8833 snapshot test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_snapshot_test.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief register address definition
+ */
+#define SNAPSHOT_TEST_REG_T01L        0x80        /**< pixel 1 output value lower level register */
+
+static amg8833_handle_t gs_handle;              /**< amg8833 handle */
+static amg8833_snapshot_t gs_snapshot;          /**< snapshot */
+static uint8_t gs_reg[256];                     /**< fake register file */
+static uint8_t gs_locked;                       /**< bus lock flag */
+static uint32_t gs_lock;                        /**< lock counter */
+static uint32_t gs_unlock;                      /**< unlock counter */
+static uint32_t gs_lock_error;                  /**< nested lock or unmatched unlock counter */
+static uint32_t gs_access;                      /**< bus access counter */
+static uint32_t gs_unlocked_access;             /**< bus access without the lock counter */
+static int16_t gs_raw[8][8];                    /**< raw buffer */
+static float gs_temp[8][8];                     /**< temperature buffer */
+static int16_t gs_model_raw[8][8];              /**< latest published raw */
+static float gs_model_temp[8][8];               /**< latest published temperature */
+static int16_t gs_held_raw[8][8];               /**< acquired raw copy */
+static float gs_held_temp[8][8];                /**< acquired temperature copy */
+
+/**
+ * @brief fake bus lock
+ * @note  none
+ */
+static void a_snapshot_test_lock(void)
+{
+    if (gs_locked != 0)
+    {
+        gs_lock_error++;
+    }
+    gs_locked = 1;
+    gs_lock++;
+}
+
+/**
+ * @brief fake bus unlock
+ * @note  none
+ */
+static void a_snapshot_test_unlock(void)
+{
+    if (gs_locked == 0)
+    {
+        gs_lock_error++;
+    }
+    gs_locked = 0;
+    gs_unlock++;
+}
+
+/**
+ * @brief  fake iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_snapshot_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_snapshot_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      fake iic read from the register file
+ * @param[in]  addr is the iic device write address
+ * @param[in]  reg is the iic register address
+ * @param[out] *buf points to a data buffer
+ * @param[in]  len is the length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_snapshot_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    gs_access++;
+    if (gs_locked == 0)
+    {
+        gs_unlocked_access++;
+    }
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = gs_reg[(uint8_t)(reg + i)];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write to the register file
+ * @param[in] addr is the iic device write address
+ * @param[in] reg is the iic register address
+ * @param[in] *buf points to a data buffer
+ * @param[in] len is the length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_snapshot_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    gs_access++;
+    if (gs_locked == 0)
+    {
+        gs_unlocked_access++;
+    }
+    for (i = 0; i < len; i++)
+    {
+        gs_reg[(uint8_t)(reg + i)] = buf[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake delay
+ * @param[in] ms is the delay time in ms
+ * @note      none
+ */
+static void a_snapshot_test_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     fake receive callback
+ * @param[in] type is the interrupt type
+ * @note      none
+ */
+static void a_snapshot_test_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     fill a frame with random data
+ * @param[in] raw is the raw array
+ * @param[in] temp is the temperature array
+ * @note      none
+ */
+static void a_snapshot_test_random_frame(int16_t raw[8][8], float temp[8][8])
+{
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        raw[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+        temp[i / 8][i % 8] = (float)(rand() % 100001) / 100.0f - 500.0f;
+    }
+}
+
+/**
+ * @brief     write a frame to the pixel registers
+ * @param[in] raw is the raw array in amg8833_read_temperature_array order
+ * @note      pixel_01 is stored at raw[7][7] and pixel_64 is stored at raw[0][0]
+ */
+static void a_snapshot_test_set_pixels(int16_t raw[8][8])
+{
+    uint8_t p;
+    uint8_t i;
+    
+    for (i = 0; i < 64; i++)
+    {
+        p = (uint8_t)(63 - i);
+        gs_reg[SNAPSHOT_TEST_REG_T01L + p * 2 + 0] = (uint8_t)((uint16_t)raw[i / 8][i % 8] & 0xFF);
+        gs_reg[SNAPSHOT_TEST_REG_T01L + p * 2 + 1] = (uint8_t)((uint16_t)raw[i / 8][i % 8] >> 8);
+    }
+}
+
+/**
+ * @brief     check a frame against the expected data
+ * @param[in] *frame points to a snapshot frame
+ * @param[in] sequence is the expected sequence
+ * @param[in] raw is the expected raw array
+ * @param[in] temp is the expected temperature array
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_snapshot_test_check_frame(const amg8833_snapshot_frame_t *frame, uint32_t sequence,
+                                           int16_t raw[8][8], float temp[8][8])
+{
+    if ((frame->sequence != sequence) ||
+        (memcmp(frame->raw, raw, sizeof(frame->raw)) != 0) ||
+        (memcmp(frame->temp, temp, sizeof(frame->temp)) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     snapshot test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_snapshot_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t is_new;
+    uint32_t t;
+    uint32_t sequence;
+    uint32_t held_sequence;
+    const amg8833_snapshot_frame_t *frame;
+    const amg8833_snapshot_frame_t *held;
+    
+    /* start snapshot test */
+    amg8833_interface_debug_print("amg8833: start snapshot test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_snapshot_init(NULL) != 2) ||
+        (amg8833_set_snapshot(NULL, &gs_snapshot) != 2) ||
+        (amg8833_snapshot_publish(NULL, gs_raw, gs_temp) != 2) ||
+        (amg8833_snapshot_publish(&gs_snapshot, NULL, gs_temp) != 2) ||
+        (amg8833_snapshot_publish(&gs_snapshot, gs_raw, NULL) != 2) ||
+        (amg8833_snapshot_acquire(NULL, &frame) != 2) ||
+        (amg8833_snapshot_acquire(&gs_snapshot, NULL) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* publish test */
+    amg8833_interface_debug_print("amg8833: publish test.\n");
+    if (amg8833_snapshot_init(&gs_snapshot) != 0)
+    {
+        amg8833_interface_debug_print("amg8833: snapshot init failed.\n");
+        
+        return 1;
+    }
+    if ((amg8833_snapshot_acquire(&gs_snapshot, &held) != 1) || (held->sequence != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check acquire before publish error.\n");
+        
+        return 1;
+    }
+    a_snapshot_test_random_frame(gs_model_raw, gs_model_temp);
+    if ((amg8833_snapshot_publish(&gs_snapshot, gs_model_raw, gs_model_temp) != 0) ||
+        (amg8833_snapshot_acquire(&gs_snapshot, &held) != 0) ||
+        (a_snapshot_test_check_frame(held, 1, gs_model_raw, gs_model_temp) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check acquire after publish error.\n");
+        
+        return 1;
+    }
+    if ((amg8833_snapshot_acquire(&gs_snapshot, &frame) != 1) || (frame != held) ||
+        (a_snapshot_test_check_frame(frame, 1, gs_model_raw, gs_model_temp) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check acquire without publish error.\n");
+        
+        return 1;
+    }
+    for (sequence = 2; sequence < 6; sequence++)
+    {
+        a_snapshot_test_random_frame(gs_model_raw, gs_model_temp);
+        (void)amg8833_snapshot_publish(&gs_snapshot, gs_model_raw, gs_model_temp);
+    }
+    if ((amg8833_snapshot_acquire(&gs_snapshot, &frame) != 0) ||
+        (a_snapshot_test_check_frame(frame, 5, gs_model_raw, gs_model_temp) != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check acquire the latest error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check publish ok.\n");
+    
+    /* interleave test */
+    amg8833_interface_debug_print("amg8833: interleave test.\n");
+    (void)amg8833_snapshot_init(&gs_snapshot);
+    sequence = 0;
+    is_new = 0;
+    (void)amg8833_snapshot_acquire(&gs_snapshot, &held);
+    held_sequence = 0;
+    memcpy(gs_held_raw, held->raw, sizeof(gs_held_raw));
+    memcpy(gs_held_temp, held->temp, sizeof(gs_held_temp));
+    for (t = 0; t < times * 16; t++)
+    {
+        if ((rand() % 2) == 0)
+        {
+            /* publish a new frame */
+            a_snapshot_test_random_frame(gs_model_raw, gs_model_temp);
+            (void)amg8833_snapshot_publish(&gs_snapshot, gs_model_raw, gs_model_temp);
+            sequence++;
+            is_new = 1;
+        }
+        else
+        {
+            /* acquire the latest frame */
+            res = amg8833_snapshot_acquire(&gs_snapshot, &frame);
+            if (is_new != 0)
+            {
+                if ((res != 0) || (a_snapshot_test_check_frame(frame, sequence, gs_model_raw, gs_model_temp) != 0))
+                {
+                    amg8833_interface_debug_print("amg8833: check acquire new frame error.\n");
+                    
+                    return 1;
+                }
+                held = frame;
+                held_sequence = sequence;
+                memcpy(gs_held_raw, frame->raw, sizeof(gs_held_raw));
+                memcpy(gs_held_temp, frame->temp, sizeof(gs_held_temp));
+                is_new = 0;
+            }
+            else
+            {
+                if ((res != 1) || (frame != held))
+                {
+                    amg8833_interface_debug_print("amg8833: check acquire old frame error.\n");
+                    
+                    return 1;
+                }
+            }
+        }
+        
+        /* the held frame is never written by the publisher */
+        if (a_snapshot_test_check_frame(held, held_sequence, gs_held_raw, gs_held_temp) != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check held frame error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check interleave ok.\n");
+    
+    /* link the fake register file with the lock hooks */
+    DRIVER_AMG8833_LINK_INIT(&gs_handle, amg8833_handle_t);
+    DRIVER_AMG8833_LINK_IIC_INIT(&gs_handle, a_snapshot_test_iic_init);
+    DRIVER_AMG8833_LINK_IIC_DEINIT(&gs_handle, a_snapshot_test_iic_deinit);
+    DRIVER_AMG8833_LINK_IIC_READ(&gs_handle, a_snapshot_test_iic_read);
+    DRIVER_AMG8833_LINK_IIC_WRITE(&gs_handle, a_snapshot_test_iic_write);
+    DRIVER_AMG8833_LINK_DELAY_MS(&gs_handle, a_snapshot_test_delay_ms);
+    DRIVER_AMG8833_LINK_DEBUG_PRINT(&gs_handle, amg8833_interface_debug_print);
+    DRIVER_AMG8833_LINK_RECEIVE_CALLBACK(&gs_handle, a_snapshot_test_receive_callback);
+    DRIVER_AMG8833_LINK_LOCK(&gs_handle, a_snapshot_test_lock);
+    DRIVER_AMG8833_LINK_UNLOCK(&gs_handle, a_snapshot_test_unlock);
+    gs_locked = 0;
+    gs_lock = 0;
+    gs_unlock = 0;
+    gs_lock_error = 0;
+    gs_access = 0;
+    gs_unlocked_access = 0;
+    res = amg8833_init(&gs_handle);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* read test */
+    amg8833_interface_debug_print("amg8833: read test.\n");
+    (void)amg8833_snapshot_init(&gs_snapshot);
+    res = amg8833_set_snapshot(&gs_handle, &gs_snapshot);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: set snapshot failed.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        for (i = 0; i < 64; i++)
+        {
+            gs_model_raw[i / 8][i % 8] = (int16_t)(rand() % 4001 - 2000);
+        }
+        a_snapshot_test_set_pixels(gs_model_raw);
+        res = amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: read temperature array failed.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if ((amg8833_snapshot_acquire(&gs_snapshot, &frame) != 0) ||
+            (a_snapshot_test_check_frame(frame, t + 1, gs_raw, gs_temp) != 0) ||
+            (memcmp(gs_raw, gs_model_raw, sizeof(gs_raw)) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: check read publish error.\n");
+            
+            (void)amg8833_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    (void)amg8833_set_snapshot(&gs_handle, NULL);
+    (void)amg8833_read_temperature_array(&gs_handle, gs_raw, gs_temp);
+    if (amg8833_snapshot_acquire(&gs_snapshot, &frame) != 1)
+    {
+        amg8833_interface_debug_print("amg8833: check snapshot disable error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check read ok.\n");
+    
+    /* lock test */
+    amg8833_interface_debug_print("amg8833: lock test.\n");
+    if ((gs_access == 0) || (gs_unlocked_access != 0) || (gs_lock_error != 0) ||
+        (gs_lock != gs_access) || (gs_unlock != gs_lock) || (gs_locked != 0))
+    {
+        amg8833_interface_debug_print("amg8833: check lock error.\n");
+        
+        (void)amg8833_deinit(&gs_handle);
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check lock ok.\n");
+    
+    /* finish snapshot test */
+    amg8833_interface_debug_print("amg8833: finish snapshot test.\n");
+    (void)amg8833_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_softint_test.c
+ * @brief     driver amg8833 softint test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_softint_test.h"
+#include <stdlib.h>
+
+static amg8833_softint_t gs_softint;        /**< software interrupt */
+static int16_t gs_raw[8][8];                /**< raw buffer */
+static int16_t gs_prev[64];                 /**< previous raw data */
+static int16_t gs_high[64];                 /**< high levels */
+static int16_t gs_low[64];                  /**< low levels */
+static int16_t gs_hysteresis[64];           /**< hysteresis levels */
+static uint8_t gs_high_active[64];          /**< reference high state */
+static uint8_t gs_low_active[64];           /**< reference low state */
+
+/**
+ * @brief     softint test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_softint_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t table[8][1];
+    uint8_t m;
+    uint8_t i;
+    uint32_t t;
+    uint32_t k;
+    int32_t v;
+    int16_t high;
+    int16_t low;
+    int16_t hysteresis;
+    uint64_t zone;
+    uint64_t mask;
+    uint64_t mask_check;
+    amg8833_interrupt_mode_t mode;
+    
+    /* start softint test */
+    amg8833_interface_debug_print("amg8833: start softint test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_softint_init(&gs_softint, (amg8833_interrupt_mode_t)2, 100, 0, 4) != 5) ||
+        (amg8833_softint_init(&gs_softint, AMG8833_INTERRUPT_MODE_ABSOLUTE, 0, 100, 4) != 5) ||
+        (amg8833_softint_init(&gs_softint, AMG8833_INTERRUPT_MODE_ABSOLUTE, 100, 0, -1) != 5) ||
+        (amg8833_softint_update(NULL, gs_raw, NULL, &mask) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* hysteresis test */
+    amg8833_interface_debug_print("amg8833: hysteresis test.\n");
+    for (m = 0; m < 2; m++)
+    {
+        mode = (m == 0) ? AMG8833_INTERRUPT_MODE_ABSOLUTE : AMG8833_INTERRUPT_MODE_DIFFERENCE;
+        for (t = 0; t < times; t++)
+        {
+            /* two zones with their own levels */
+            zone = 0;
+            for (i = 0; i < 64; i++)
+            {
+                zone |= (uint64_t)(rand() % 2) << i;
+            }
+            res = amg8833_softint_init(&gs_softint, mode, 40, -40, 8);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: softint init failed.\n");
+                
+                return 1;
+            }
+            high = (int16_t)(rand() % 40);
+            low = (int16_t)(-(rand() % 40));
+            hysteresis = (int16_t)(rand() % 12);
+            res = amg8833_softint_set_level(&gs_softint, zone, high, low, hysteresis);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: set level failed.\n");
+                
+                return 1;
+            }
+            for (i = 0; i < 64; i++)
+            {
+                gs_high[i] = (((zone >> i) & 1) != 0) ? high : 40;
+                gs_low[i] = (((zone >> i) & 1) != 0) ? low : -40;
+                gs_hysteresis[i] = (((zone >> i) & 1) != 0) ? hysteresis : 8;
+                gs_high_active[i] = 0;
+                gs_low_active[i] = 0;
+            }
+            
+            /* random walk around the levels */
+            for (i = 0; i < 64; i++)
+            {
+                gs_raw[i / 8][i % 8] = (int16_t)(rand() % 81 - 40);
+                gs_prev[i] = gs_raw[i / 8][i % 8];
+            }
+            for (k = 0; k < 32; k++)
+            {
+                mask_check = 0;
+                for (i = 0; i < 64; i++)
+                {
+                    gs_raw[i / 8][i % 8] = (int16_t)(gs_raw[i / 8][i % 8] + rand() % 31 - 15);
+                    if (gs_raw[i / 8][i % 8] > 80)
+                    {
+                        gs_raw[i / 8][i % 8] = 80;
+                    }
+                    if (gs_raw[i / 8][i % 8] < -80)
+                    {
+                        gs_raw[i / 8][i % 8] = -80;
+                    }
+                    v = gs_raw[i / 8][i % 8];
+                    if (mode == AMG8833_INTERRUPT_MODE_DIFFERENCE)
+                    {
+                        v = (k == 0) ? 0 : (v - gs_prev[i]);
+                    }
+                    gs_prev[i] = gs_raw[i / 8][i % 8];
+                    if (gs_high_active[i] != 0)
+                    {
+                        gs_high_active[i] = (uint8_t)(v >= gs_high[i] - gs_hysteresis[i]);
+                    }
+                    else
+                    {
+                        gs_high_active[i] = (uint8_t)(v > gs_high[i]);
+                    }
+                    if (gs_low_active[i] != 0)
+                    {
+                        gs_low_active[i] = (uint8_t)(v <= gs_low[i] + gs_hysteresis[i]);
+                    }
+                    else
+                    {
+                        gs_low_active[i] = (uint8_t)(v < gs_low[i]);
+                    }
+                    mask_check |= (uint64_t)(gs_high_active[i] | gs_low_active[i]) << i;
+                }
+                res = amg8833_softint_update(&gs_softint, gs_raw, table, &mask);
+                if ((res != 0) || (mask != mask_check))
+                {
+                    amg8833_interface_debug_print("amg8833: check mode %d mask error.\n", m);
+                    
+                    return 1;
+                }
+                
+                /* the table has col 0 at bit 7 */
+                for (i = 0; i < 64; i++)
+                {
+                    if (((table[i / 8][0] >> (7 - i % 8)) & 1) != ((mask >> i) & 1))
+                    {
+                        amg8833_interface_debug_print("amg8833: check table error.\n");
+                        
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check hysteresis ok.\n");
+    
+    /* finish softint test */
+    amg8833_interface_debug_print("amg8833: finish softint test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stats_test.c
+ * @brief     driver amg8833 stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_stats_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+#define STATS_TEST_WINDOW_SIZE        5        /**< window size */
+
+static amg8833_stats_t gs_stats;                                      /**< stats */
+static amg8833_stats_window_t gs_window;                              /**< stats window */
+static int16_t gs_window_frame[STATS_TEST_WINDOW_SIZE][8][8];         /**< window ring buffer */
+static int16_t gs_history[STATS_TEST_WINDOW_SIZE][8][8];              /**< last frames */
+static int16_t gs_raw[8][8];                                          /**< raw buffer */
+static int16_t gs_sort[64];                                           /**< sorted pixels */
+static float gs_mean[8][8];                                           /**< mean buffer */
+static float gs_variance[8][8];                                       /**< variance buffer */
+
+/**
+ * @brief     compare two pixels
+ * @param[in] *a points to a pixel
+ * @param[in] *b points to a pixel
+ * @return    compare result
+ * @note      none
+ */
+static int a_stats_test_compare(const void *a, const void *b)
+{
+    return (int)(*(const int16_t *)a) - (int)(*(const int16_t *)b);
+}
+
+/**
+ * @brief     stats test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_stats_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t argmin;
+    uint8_t argmax;
+    uint16_t rank;
+    uint16_t percent;
+    uint16_t n;
+    uint16_t k;
+    uint32_t t;
+    int32_t sum;
+    int16_t range;
+    int16_t value;
+    float mean;
+    float variance;
+    float d;
+    
+    /* start stats test */
+    amg8833_interface_debug_print("amg8833: start stats test.\n");
+    
+    /* frame stats test */
+    amg8833_interface_debug_print("amg8833: frame stats test.\n");
+    res = amg8833_stats_init(&gs_stats);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: stats init failed.\n");
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        /* random range, the histogram is not cleared between frames */
+        range = (int16_t)(rand() % 2000 + 1);
+        argmin = 0;
+        argmax = 0;
+        sum = 0;
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % (2 * range + 1) - range);
+            gs_sort[i] = gs_raw[i / 8][i % 8];
+            argmin = (gs_sort[i] < gs_sort[argmin]) ? i : argmin;
+            argmax = (gs_sort[i] > gs_sort[argmax]) ? i : argmax;
+            sum += gs_sort[i];
+        }
+        mean = (float)sum / 64.0f;
+        variance = 0.0f;
+        for (i = 0; i < 64; i++)
+        {
+            d = (float)gs_sort[i] - mean;
+            variance += d * d / 64.0f;
+        }
+        qsort(gs_sort, 64, sizeof(int16_t), a_stats_test_compare);
+        res = amg8833_stats_update(&gs_stats, gs_raw);
+        if ((res != 0) || (gs_stats.min != gs_sort[0]) || (gs_stats.max != gs_sort[63]) ||
+            (gs_stats.argmin != argmin) || (gs_stats.argmax != argmax) || (gs_stats.sum != sum))
+        {
+            amg8833_interface_debug_print("amg8833: check min max error.\n");
+            
+            return 1;
+        }
+        if ((fabsf(gs_stats.mean - mean * 0.25f) > 0.01f) ||
+            (fabsf(gs_stats.variance - variance * 0.0625f) > 0.001f * variance + 0.01f))
+        {
+            amg8833_interface_debug_print("amg8833: check mean variance error.\n");
+            
+            return 1;
+        }
+        
+        /* nearest rank percentiles */
+        for (percent = 0; percent <= 100; percent++)
+        {
+            rank = (uint16_t)((percent * 64 + 99) / 100);
+            rank = (rank == 0) ? 1 : rank;
+            res = amg8833_stats_get_percentile(&gs_stats, (float)percent, &value);
+            if ((res != 0) || (value != gs_sort[rank - 1]))
+            {
+                amg8833_interface_debug_print("amg8833: check percentile error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    if (amg8833_stats_get_percentile(&gs_stats, 100.5f, &value) != 5)
+    {
+        amg8833_interface_debug_print("amg8833: check percent param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check frame stats ok.\n");
+    
+    /* window test */
+    amg8833_interface_debug_print("amg8833: window test.\n");
+    if (amg8833_stats_window_init(&gs_window, gs_window_frame, 0) != 5)
+    {
+        amg8833_interface_debug_print("amg8833: check window size error.\n");
+        
+        return 1;
+    }
+    res = amg8833_stats_window_init(&gs_window, gs_window_frame, STATS_TEST_WINDOW_SIZE);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: window init failed.\n");
+        
+        return 1;
+    }
+    if (amg8833_stats_window_get(&gs_window, gs_mean, gs_variance) != 4)
+    {
+        amg8833_interface_debug_print("amg8833: check empty window error.\n");
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[i / 8][i % 8] = (int16_t)(rand() % 1024 - 256);
+        }
+        memcpy(gs_history[t % STATS_TEST_WINDOW_SIZE], gs_raw, sizeof(gs_raw));
+        res = amg8833_stats_window_update(&gs_window, gs_raw);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: window update failed.\n");
+            
+            return 1;
+        }
+        res = amg8833_stats_window_get(&gs_window, gs_mean, gs_variance);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: window get failed.\n");
+            
+            return 1;
+        }
+        
+        /* compare with the last frames */
+        n = (uint16_t)((t + 1 < STATS_TEST_WINDOW_SIZE) ? (t + 1) : STATS_TEST_WINDOW_SIZE);
+        for (i = 0; i < 64; i++)
+        {
+            mean = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                mean += (float)gs_history[k][i / 8][i % 8] / (float)n;
+            }
+            variance = 0.0f;
+            for (k = 0; k < n; k++)
+            {
+                d = (float)gs_history[k][i / 8][i % 8] - mean;
+                variance += d * d / (float)n;
+            }
+            if ((fabsf(gs_mean[i / 8][i % 8] - mean * 0.25f) > 0.01f) ||
+                (fabsf(gs_variance[i / 8][i % 8] - variance * 0.0625f) > 0.001f * variance + 0.01f))
+            {
+                amg8833_interface_debug_print("amg8833: check window stats error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check window ok.\n");
+    
+    /* finish stats test */
+    amg8833_interface_debug_print("amg8833: finish stats test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_stitch_test.c
+ * @brief     driver amg8833 stitch test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_stitch_test.h"
+#include <stdlib.h>
+
+static amg8833_stitch_t gs_stitch;                 /**< stitch */
+static amg8833_stitch_sensor_t gs_sensor[3];       /**< sensor geometry */
+static uint32_t gs_start[16 * 16 + 1];             /**< start array */
+static amg8833_stitch_tap_t gs_tap[16 * 16 * 12];  /**< tap array */
+static int16_t gs_raw[3][8][8];                    /**< raw frames */
+static int16_t gs_out[16 * 16];                    /**< raw mosaic */
+static float gs_temp[16 * 16];                     /**< temperature mosaic */
+
+/**
+ * @brief     check if a sensor has positive weight at a mosaic pixel
+ * @param[in] *sensor points to a sensor geometry
+ * @param[in] y is the mosaic row
+ * @param[in] x is the mosaic col
+ * @return    1 if covered
+ * @note      the rotation keeps the sensor square, so only the offset and the scale matter
+ */
+static uint8_t a_stitch_test_covered(const amg8833_stitch_sensor_t *sensor, uint16_t y, uint16_t x)
+{
+    float a;
+    float b;
+    
+    a = ((float)y - sensor->row) / sensor->scale;
+    b = ((float)x - sensor->col) / sensor->scale;
+    
+    return (uint8_t)((a > -0.5f) && (a < 7.5f) && (b > -0.5f) && (b < 7.5f));
+}
+
+/**
+ * @brief     stitch test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_stitch_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t covered;
+    uint8_t s;
+    uint8_t r;
+    uint16_t x;
+    uint16_t y;
+    uint16_t u;
+    uint16_t v;
+    uint32_t t;
+    uint32_t p;
+    uint32_t i;
+    uint32_t sum;
+    int16_t gr;
+    int16_t gc;
+    int16_t base;
+    int16_t min;
+    int16_t max;
+    int16_t c;
+    float expect;
+    const float scale_list[3] = {0.5f, 1.0f, 2.0f};
+    
+    /* start stitch test */
+    amg8833_interface_debug_print("amg8833: start stitch test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    gs_sensor[0].row = 0.0f;
+    gs_sensor[0].col = 0.0f;
+    gs_sensor[0].scale = 1.0f;
+    gs_sensor[0].rotation = AMG8833_STITCH_ROTATION_0;
+    gs_sensor[1] = gs_sensor[0];
+    gs_sensor[1].scale = 0.0f;
+    gs_sensor[2] = gs_sensor[0];
+    gs_sensor[2].rotation = (amg8833_stitch_rotation_t)4;
+    if ((amg8833_stitch_init(&gs_stitch, gs_start, 16 * 16 + 1, gs_tap, 16 * 16 * 12) != 0) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, 0, 8, 8) != 5) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, AMG8833_STITCH_MAX_SENSORS + 1, 8, 8) != 5) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, 1, 0, 8) != 5) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, 2, 8, 8) != 5) ||
+        (amg8833_stitch_compile(&gs_stitch, &gs_sensor[2], 1, 8, 8) != 5) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, 1, 16, 17) != 4) ||
+        (amg8833_stitch_run(&gs_stitch, NULL, gs_out, NULL, 0) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    if ((amg8833_stitch_init(&gs_stitch, gs_start, 16 * 16 + 1, gs_tap, 63) != 0) ||
+        (amg8833_stitch_compile(&gs_stitch, gs_sensor, 1, 8, 8) != 4))
+    {
+        amg8833_interface_debug_print("amg8833: check full tap array error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* rotation test */
+    amg8833_interface_debug_print("amg8833: rotation test.\n");
+    res = amg8833_stitch_init(&gs_stitch, gs_start, 16 * 16 + 1, gs_tap, 16 * 16 * 12);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: stitch init failed.\n");
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        /* one sensor on its own grid copies the rotated frame */
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[0][i / 8][i % 8] = (int16_t)(rand() % 1001 - 200);
+        }
+        for (r = 0; r < 4; r++)
+        {
+            gs_sensor[0].rotation = (amg8833_stitch_rotation_t)r;
+            res = amg8833_stitch_compile(&gs_stitch, gs_sensor, 1, 8, 8);
+            if ((res != 0) || (gs_stitch.tap_count != 64))
+            {
+                amg8833_interface_debug_print("amg8833: check rotation %d tap count error.\n", r * 90);
+                
+                return 1;
+            }
+            res = amg8833_stitch_run(&gs_stitch, gs_raw, gs_out, gs_temp, 0);
+            if (res != 0)
+            {
+                amg8833_interface_debug_print("amg8833: stitch run failed.\n");
+                
+                return 1;
+            }
+            for (y = 0; y < 8; y++)
+            {
+                for (x = 0; x < 8; x++)
+                {
+                    u = (r == 0) ? y : ((r == 1) ? (uint16_t)(7 - x) : ((r == 2) ? (uint16_t)(7 - y) : x));
+                    v = (r == 0) ? x : ((r == 1) ? y : ((r == 2) ? (uint16_t)(7 - x) : (uint16_t)(7 - y)));
+                    if ((gs_out[y * 8 + x] != gs_raw[0][u][v]) ||
+                        (gs_temp[y * 8 + x] != (float)gs_raw[0][u][v] * 0.25f))
+                    {
+                        amg8833_interface_debug_print("amg8833: check rotation %d error.\n", r * 90);
+                        
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+    gs_sensor[0].rotation = AMG8833_STITCH_ROTATION_0;
+    amg8833_interface_debug_print("amg8833: check rotation ok.\n");
+    
+    /* interpolation test */
+    amg8833_interface_debug_print("amg8833: interpolation test.\n");
+    gs_sensor[0].scale = 2.0f;
+    res = amg8833_stitch_compile(&gs_stitch, gs_sensor, 1, 16, 16);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: stitch compile failed.\n");
+        
+        return 1;
+    }
+    for (t = 0; t < times; t++)
+    {
+        /* bilinear sampling keeps a plane */
+        gr = (int16_t)(rand() % 41 - 20);
+        gc = (int16_t)(rand() % 41 - 20);
+        base = (int16_t)(rand() % 201);
+        for (i = 0; i < 64; i++)
+        {
+            gs_raw[0][i / 8][i % 8] = (int16_t)(base + gr * (int16_t)(i / 8) + gc * (int16_t)(i % 8));
+        }
+        res = amg8833_stitch_run(&gs_stitch, gs_raw, gs_out, NULL, -1000);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: stitch run failed.\n");
+            
+            return 1;
+        }
+        for (y = 0; y < 16; y++)
+        {
+            for (x = 0; x < 16; x++)
+            {
+                if ((y == 15) || (x == 15))
+                {
+                    if (gs_out[y * 16 + x] != -1000)
+                    {
+                        amg8833_interface_debug_print("amg8833: check empty pixel error.\n");
+                        
+                        return 1;
+                    }
+                    continue;
+                }
+                expect = (float)base + (float)gr * (float)y * 0.5f + (float)gc * (float)x * 0.5f;
+                if (((float)gs_out[y * 16 + x] - expect > 1.0f) || (expect - (float)gs_out[y * 16 + x] > 1.0f))
+                {
+                    amg8833_interface_debug_print("amg8833: check interpolation error.\n");
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check interpolation ok.\n");
+    
+    /* mosaic test */
+    amg8833_interface_debug_print("amg8833: mosaic test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* random overlapping sensors */
+        count = (uint8_t)(rand() % 3 + 1);
+        for (s = 0; s < count; s++)
+        {
+            gs_sensor[s].row = (float)(rand() % 65 - 16) / 4.0f;
+            gs_sensor[s].col = (float)(rand() % 65 - 16) / 4.0f;
+            gs_sensor[s].scale = scale_list[rand() % 3];
+            gs_sensor[s].rotation = (amg8833_stitch_rotation_t)(rand() % 4);
+        }
+        res = amg8833_stitch_compile(&gs_stitch, gs_sensor, count, 16, 16);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: stitch compile failed.\n");
+            
+            return 1;
+        }
+        
+        /* every covered pixel has weights of exactly 16384 */
+        if ((gs_stitch.start[0] != 0) || (gs_stitch.start[16 * 16] != gs_stitch.tap_count))
+        {
+            amg8833_interface_debug_print("amg8833: check start error.\n");
+            
+            return 1;
+        }
+        for (p = 0; p < 16 * 16; p++)
+        {
+            covered = 0;
+            for (s = 0; s < count; s++)
+            {
+                covered |= a_stitch_test_covered(&gs_sensor[s], (uint16_t)(p / 16), (uint16_t)(p % 16));
+            }
+            if ((gs_stitch.start[p + 1] < gs_stitch.start[p]) ||
+                (gs_stitch.start[p + 1] - gs_stitch.start[p] > 4 * (uint32_t)count) ||
+                ((gs_stitch.start[p + 1] != gs_stitch.start[p]) != covered))
+            {
+                amg8833_interface_debug_print("amg8833: check coverage error.\n");
+                
+                return 1;
+            }
+            sum = 0;
+            for (i = gs_stitch.start[p]; i < gs_stitch.start[p + 1]; i++)
+            {
+                if (gs_stitch.tap[i].src >= (uint32_t)count * 64)
+                {
+                    amg8833_interface_debug_print("amg8833: check tap source error.\n");
+                    
+                    return 1;
+                }
+                sum += gs_stitch.tap[i].weight;
+            }
+            if ((covered != 0) && (sum != 16384))
+            {
+                amg8833_interface_debug_print("amg8833: check weight sum error.\n");
+                
+                return 1;
+            }
+        }
+        
+        /* a flat scene stays flat */
+        c = (int16_t)(rand() % 1001 - 200);
+        for (i = 0; i < (uint32_t)count * 64; i++)
+        {
+            gs_raw[i / 64][(i % 64) / 8][i % 8] = c;
+        }
+        res = amg8833_stitch_run(&gs_stitch, gs_raw, gs_out, NULL, -1000);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: stitch run failed.\n");
+            
+            return 1;
+        }
+        for (p = 0; p < 16 * 16; p++)
+        {
+            if (gs_out[p] != ((gs_stitch.start[p + 1] != gs_stitch.start[p]) ? c : -1000))
+            {
+                amg8833_interface_debug_print("amg8833: check flat mosaic error.\n");
+                
+                return 1;
+            }
+        }
+        
+        /* any scene stays inside its range */
+        min = 32767;
+        max = -32768;
+        for (i = 0; i < (uint32_t)count * 64; i++)
+        {
+            gs_raw[i / 64][(i % 64) / 8][i % 8] = (int16_t)(rand() % 1001 - 200);
+            min = (gs_raw[i / 64][(i % 64) / 8][i % 8] < min) ? gs_raw[i / 64][(i % 64) / 8][i % 8] : min;
+            max = (gs_raw[i / 64][(i % 64) / 8][i % 8] > max) ? gs_raw[i / 64][(i % 64) / 8][i % 8] : max;
+        }
+        res = amg8833_stitch_run(&gs_stitch, gs_raw, gs_out, NULL, -1000);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: stitch run failed.\n");
+            
+            return 1;
+        }
+        for (p = 0; p < 16 * 16; p++)
+        {
+            if ((gs_stitch.start[p + 1] != gs_stitch.start[p]) && ((gs_out[p] < min) || (gs_out[p] > max)))
+            {
+                amg8833_interface_debug_print("amg8833: check mosaic range error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check mosaic ok.\n");
+    
+    /* finish stitch test */
+    amg8833_interface_debug_print("amg8833: finish stitch test.\n");
+    
+    return 0;
+}
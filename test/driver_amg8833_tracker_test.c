@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_tracker_test.c
+ * @brief     driver amg8833 tracker test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_tracker_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+static amg8833_tracker_t gs_tracker;                               /**< tracker */
+static amg8833_track_t gs_track[AMG8833_TRACKER_MAX_TRACKS];       /**< track buffer */
+static int16_t gs_raw[8][8];                                       /**< raw buffer */
+
+/**
+ * @brief      draw a 2x2 object
+ * @param[in]  row is the first row
+ * @param[in]  col is the first col
+ * @param[out] *mask points to a mask buffer
+ * @note       the object pixels are set in the raw buffer and the mask
+ */
+static void a_tracker_test_draw(uint8_t row, uint8_t col, uint64_t *mask)
+{
+    uint8_t r;
+    uint8_t c;
+    
+    for (r = row; r < row + 2; r++)
+    {
+        for (c = col; c < col + 2; c++)
+        {
+            gs_raw[r][c] = (int16_t)(100 + rand() % 20);
+            *mask |= (uint64_t)1 << (r * 8 + c);
+        }
+    }
+}
+
+/**
+ * @brief     tracker test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_tracker_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t count;
+    uint8_t row;
+    uint8_t col;
+    uint8_t i;
+    uint16_t id;
+    uint16_t id_left;
+    uint32_t t;
+    uint32_t count_in;
+    uint32_t count_out;
+    uint64_t mask;
+    
+    /* start tracker test */
+    amg8833_interface_debug_print("amg8833: start tracker test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    res = amg8833_tracker_init(&gs_tracker);
+    if (res != 0)
+    {
+        amg8833_interface_debug_print("amg8833: tracker init failed.\n");
+        
+        return 1;
+    }
+    if ((amg8833_tracker_set_param(&gs_tracker, 0.0f, 1, 2, 3) != 5) || (amg8833_tracker_set_param(&gs_tracker, 2.0f, 0, 2, 3) != 5) ||
+        (amg8833_tracker_set_line(&gs_tracker, 1.0f, 1.0f, 1.0f, 1.0f, 0.5f) != 5) ||
+        (amg8833_tracker_update(&gs_tracker, NULL, 0) != 2))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* crossing test */
+    amg8833_interface_debug_print("amg8833: crossing test.\n");
+    for (t = 0; t < times; t++)
+    {
+        (void)amg8833_tracker_init(&gs_tracker);
+        
+        /* the wide gate keeps the track through the turn */
+        res = amg8833_tracker_set_param(&gs_tracker, 4.0f, 1, 2, 3);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: set param failed.\n");
+            
+            return 1;
+        }
+        res = amg8833_tracker_set_line(&gs_tracker, 0.0f, 3.5f, 7.0f, 3.5f, 0.5f);
+        if (res != 0)
+        {
+            amg8833_interface_debug_print("amg8833: set line failed.\n");
+            
+            return 1;
+        }
+        
+        /* one object walks right and back */
+        row = (uint8_t)(rand() % 7);
+        id = 0;
+        for (i = 0; i < 14; i++)
+        {
+            col = (uint8_t)((i < 7) ? i : (13 - i));
+            memset(gs_raw, 0, sizeof(gs_raw));
+            mask = 0;
+            a_tracker_test_draw(row, col, &mask);
+            (void)amg8833_tracker_update(&gs_tracker, gs_raw, mask);
+            (void)amg8833_tracker_get_tracks(&gs_tracker, gs_track, AMG8833_TRACKER_MAX_TRACKS, &count);
+            if (i == 0)
+            {
+                if (count != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: check unconfirmed track error.\n");
+                    
+                    return 1;
+                }
+                continue;
+            }
+            if (count != 1)
+            {
+                amg8833_interface_debug_print("amg8833: check track count error.\n");
+                
+                return 1;
+            }
+            if ((id != 0) && (gs_track[0].id != id))
+            {
+                amg8833_interface_debug_print("amg8833: check track id error.\n");
+                
+                return 1;
+            }
+            id = gs_track[0].id;
+            if ((fabsf(gs_track[0].row - ((float)row + 0.5f)) > 0.01f) || ((i < 7) && (fabsf(gs_track[0].col - ((float)col + 0.5f)) > 1.0f)))
+            {
+                amg8833_interface_debug_print("amg8833: check track position error.\n");
+                
+                return 1;
+            }
+            if (((i == 6) && (gs_track[0].vcol < 0.5f)) || ((i == 13) && (gs_track[0].vcol > -0.5f)))
+            {
+                amg8833_interface_debug_print("amg8833: check track velocity error.\n");
+                
+                return 1;
+            }
+            
+            /* one crossing each way */
+            (void)amg8833_tracker_get_count(&gs_tracker, &count_in, &count_out);
+            if ((i == 6) && (count_in + count_out != 1))
+            {
+                amg8833_interface_debug_print("amg8833: check first crossing error.\n");
+                
+                return 1;
+            }
+        }
+        if ((count_in != 1) || (count_out != 1))
+        {
+            amg8833_interface_debug_print("amg8833: check crossing count error.\n");
+            
+            return 1;
+        }
+        
+        /* the track is dropped after max misses */
+        memset(gs_raw, 0, sizeof(gs_raw));
+        for (i = 0; i < 4; i++)
+        {
+            (void)amg8833_tracker_update(&gs_tracker, gs_raw, 0);
+        }
+        (void)amg8833_tracker_get_tracks(&gs_tracker, gs_track, AMG8833_TRACKER_MAX_TRACKS, &count);
+        if (count != 0)
+        {
+            amg8833_interface_debug_print("amg8833: check dropped track error.\n");
+            
+            return 1;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check crossing ok.\n");
+    
+    /* two objects test */
+    amg8833_interface_debug_print("amg8833: two objects test.\n");
+    (void)amg8833_tracker_init(&gs_tracker);
+    id_left = 0;
+    for (i = 0; i < 7; i++)
+    {
+        memset(gs_raw, 0, sizeof(gs_raw));
+        mask = 0;
+        a_tracker_test_draw(0, i, &mask);
+        a_tracker_test_draw(6, (uint8_t)(6 - i), &mask);
+        (void)amg8833_tracker_update(&gs_tracker, gs_raw, mask);
+        (void)amg8833_tracker_get_tracks(&gs_tracker, gs_track, AMG8833_TRACKER_MAX_TRACKS, &count);
+        if ((i > 0) && (count != 2))
+        {
+            amg8833_interface_debug_print("amg8833: check two tracks error.\n");
+            
+            return 1;
+        }
+        if (count == 2)
+        {
+            id = (gs_track[0].row < 3.0f) ? gs_track[0].id : gs_track[1].id;
+            if ((id_left != 0) && (id != id_left))
+            {
+                amg8833_interface_debug_print("amg8833: check track swap error.\n");
+                
+                return 1;
+            }
+            id_left = id;
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check two objects ok.\n");
+    
+    /* finish tracker test */
+    amg8833_interface_debug_print("amg8833: finish tracker test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_amg8833_upscale_test.c
+ * @brief     driver amg8833 upscale test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_amg8833_upscale_test.h"
+#include <stdlib.h>
+
+static float gs_temp[8][8];            /**< temperature buffer */
+static int16_t gs_raw[8][8];           /**< raw buffer */
+static float gs_out[64 * 64];          /**< temperature output */
+static int16_t gs_out_raw[64 * 64];    /**< raw output */
+static int32_t gs_sum[64];             /**< q10 weight sums */
+
+/**
+ * @brief     get the source position of an output pixel
+ * @param[in] size is the output size
+ * @param[in] j is the output pixel
+ * @return    source position
+ * @note      pixel centers are aligned
+ */
+static float a_upscale_test_position(uint8_t size, uint8_t j)
+{
+    return ((float)j + 0.5f) * 8.0f / (float)size - 0.5f;
+}
+
+/**
+ * @brief     check if an output pixel is inside the kernel support
+ * @param[in] method is the upscale method
+ * @param[in] s is the source position
+ * @return    1 if no tap is clamped at the border
+ * @note      none
+ */
+static uint8_t a_upscale_test_interior(amg8833_upscale_method_t method, float s)
+{
+    if (method == AMG8833_UPSCALE_METHOD_BILINEAR)
+    {
+        return (uint8_t)((s >= 0.0f) && (s <= 7.0f));
+    }
+    else
+    {
+        return (uint8_t)((s >= 1.0f) && (s < 6.0f));
+    }
+}
+
+/**
+ * @brief     upscale test
+ * @param[in] times is the test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test needs no chip and runs on any platform
+ */
+uint8_t amg8833_upscale_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t m;
+    uint8_t z;
+    uint8_t n;
+    uint8_t c;
+    uint8_t x;
+    uint8_t y;
+    uint32_t t;
+    int16_t v;
+    int16_t gx;
+    int16_t gy;
+    int16_t base;
+    float expect;
+    float err;
+    amg8833_upscale_method_t method;
+    const amg8833_upscale_size_t size_list[3] = {AMG8833_UPSCALE_SIZE_16, AMG8833_UPSCALE_SIZE_32, AMG8833_UPSCALE_SIZE_64};
+    
+    /* start upscale test */
+    amg8833_interface_debug_print("amg8833: start upscale test.\n");
+    
+    /* param test */
+    amg8833_interface_debug_print("amg8833: param test.\n");
+    if ((amg8833_upscale(AMG8833_UPSCALE_METHOD_BILINEAR, AMG8833_UPSCALE_SIZE_16, NULL, gs_out) != 2) ||
+        (amg8833_upscale(AMG8833_UPSCALE_METHOD_BILINEAR, AMG8833_UPSCALE_SIZE_16, gs_temp, NULL) != 2) ||
+        (amg8833_upscale((amg8833_upscale_method_t)2, AMG8833_UPSCALE_SIZE_16, gs_temp, gs_out) != 5) ||
+        (amg8833_upscale(AMG8833_UPSCALE_METHOD_BICUBIC, (amg8833_upscale_size_t)8, gs_temp, gs_out) != 5) ||
+        (amg8833_upscale_raw(AMG8833_UPSCALE_METHOD_BILINEAR, AMG8833_UPSCALE_SIZE_16, NULL, gs_out_raw) != 2) ||
+        (amg8833_upscale_raw((amg8833_upscale_method_t)2, AMG8833_UPSCALE_SIZE_16, gs_raw, gs_out_raw) != 5) ||
+        (amg8833_upscale_raw(AMG8833_UPSCALE_METHOD_BICUBIC, (amg8833_upscale_size_t)48, gs_raw, gs_out_raw) != 5))
+    {
+        amg8833_interface_debug_print("amg8833: check param error.\n");
+        
+        return 1;
+    }
+    amg8833_interface_debug_print("amg8833: check param ok.\n");
+    
+    /* kernel test */
+    amg8833_interface_debug_print("amg8833: kernel test.\n");
+    for (m = 0; m < 2; m++)
+    {
+        method = (amg8833_upscale_method_t)m;
+        for (z = 0; z < 3; z++)
+        {
+            /* a column impulse of 1024 outputs the q10 weight of that column */
+            n = (uint8_t)size_list[z];
+            memset(gs_sum, 0, sizeof(gs_sum));
+            for (c = 0; c < 8; c++)
+            {
+                for (y = 0; y < 8; y++)
+                {
+                    for (x = 0; x < 8; x++)
+                    {
+                        gs_raw[y][x] = (int16_t)((x == c) ? 1024 : 0);
+                    }
+                }
+                res = amg8833_upscale_raw(method, size_list[z], gs_raw, gs_out_raw);
+                if (res != 0)
+                {
+                    amg8833_interface_debug_print("amg8833: upscale raw failed.\n");
+                    
+                    return 1;
+                }
+                for (x = 0; x < n; x++)
+                {
+                    gs_sum[x] += gs_out_raw[x];
+                }
+            }
+            for (x = 0; x < n; x++)
+            {
+                if (gs_sum[x] != 1024)
+                {
+                    amg8833_interface_debug_print("amg8833: check method %d size %d weight sum error.\n", m, n);
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check kernel ok.\n");
+    
+    /* constant test */
+    amg8833_interface_debug_print("amg8833: constant test.\n");
+    for (t = 0; t < times; t++)
+    {
+        method = (amg8833_upscale_method_t)(rand() % 2);
+        z = (uint8_t)(rand() % 3);
+        n = (uint8_t)size_list[z];
+        v = (int16_t)(rand() % 4001 - 2000);
+        for (y = 0; y < 8; y++)
+        {
+            for (x = 0; x < 8; x++)
+            {
+                gs_raw[y][x] = v;
+                gs_temp[y][x] = (float)v * 0.25f;
+            }
+        }
+        if ((amg8833_upscale(method, size_list[z], gs_temp, gs_out) != 0) ||
+            (amg8833_upscale_raw(method, size_list[z], gs_raw, gs_out_raw) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: upscale failed.\n");
+            
+            return 1;
+        }
+        for (x = 0; x < n; x++)
+        {
+            for (y = 0; y < n; y++)
+            {
+                err = gs_out[y * n + x] - (float)v * 0.25f;
+                if ((gs_out_raw[y * n + x] != v) || (err > 0.001f) || (err < -0.001f))
+                {
+                    amg8833_interface_debug_print("amg8833: check constant error.\n");
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check constant ok.\n");
+    
+    /* ramp test */
+    amg8833_interface_debug_print("amg8833: ramp test.\n");
+    for (t = 0; t < times; t++)
+    {
+        /* inside the kernel support both methods reproduce a plane */
+        method = (amg8833_upscale_method_t)(rand() % 2);
+        z = (uint8_t)(rand() % 3);
+        n = (uint8_t)size_list[z];
+        gx = (int16_t)(rand() % 81 - 40);
+        gy = (int16_t)(rand() % 81 - 40);
+        base = (int16_t)(rand() % 401 - 200);
+        for (y = 0; y < 8; y++)
+        {
+            for (x = 0; x < 8; x++)
+            {
+                gs_raw[y][x] = (int16_t)(base + gx * x + gy * y);
+                gs_temp[y][x] = (float)gs_raw[y][x] * 0.25f;
+            }
+        }
+        if ((amg8833_upscale(method, size_list[z], gs_temp, gs_out) != 0) ||
+            (amg8833_upscale_raw(method, size_list[z], gs_raw, gs_out_raw) != 0))
+        {
+            amg8833_interface_debug_print("amg8833: upscale failed.\n");
+            
+            return 1;
+        }
+        for (y = 0; y < n; y++)
+        {
+            if (a_upscale_test_interior(method, a_upscale_test_position(n, y)) == 0)
+            {
+                continue;
+            }
+            for (x = 0; x < n; x++)
+            {
+                if (a_upscale_test_interior(method, a_upscale_test_position(n, x)) == 0)
+                {
+                    continue;
+                }
+                expect = (float)base + (float)gx * a_upscale_test_position(n, x) +
+                         (float)gy * a_upscale_test_position(n, y);
+                err = gs_out[y * n + x] - expect * 0.25f;
+                if ((err > 0.001f) || (err < -0.001f))
+                {
+                    amg8833_interface_debug_print("amg8833: check method %d float ramp error.\n", method);
+                    
+                    return 1;
+                }
+                err = (float)gs_out_raw[y * n + x] - expect;
+                if ((err > 1.0f) || (err < -1.0f))
+                {
+                    amg8833_interface_debug_print("amg8833: check method %d raw ramp error.\n", method);
+                    
+                    return 1;
+                }
+            }
+        }
+    }
+    amg8833_interface_debug_print("amg8833: check ramp ok.\n");
+    
+    /* finish upscale test */
+    amg8833_interface_debug_print("amg8833: finish upscale test.\n");
+    
+    return 0;
+}